@@ -0,0 +1,33 @@
+#include "../bench_registry.hpp"
+#include "../scene_generators.hpp"
+
+#include <span>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace toast;
+
+// Parsing a 10k-node level prefab from the binary (game) and text (editor) formats
+TOAST_BENCH_NAMED("assets", "assets/01-prefab_load", bench_assets_01_prefab_load) {
+	const assets::Prefab level = bench::scenes::widePrefab(10000);
+	const std::size_t nodes = level.nodes.size();
+
+	const std::vector<uint8_t> binary = level.toBinary();
+	state.runCapped("from binary (10k nodes)", nodes, 50, [&] {
+		assets::Prefab parsed {std::span<const uint8_t>(binary)};
+		toast::bench::doNotOptimize(parsed.nodes.data());
+	});
+
+	const std::string text = level.toFile();
+	state.runCapped("from text (10k nodes)", nodes, 20, [&] {
+		std::istringstream stream(text);
+		assets::Prefab parsed(stream);
+		toast::bench::doNotOptimize(parsed.nodes.data());
+	});
+
+	state.runCapped("to binary (10k nodes)", nodes, 50, [&] {
+		auto bytes = level.toBinary();
+		toast::bench::doNotOptimize(bytes.data());
+	});
+}
@@ -0,0 +1,27 @@
+#include "../bench_registry.hpp"
+#include "../scene_generators.hpp"
+
+#include <random>
+#include <toast/assets/pack.hpp>
+
+// Mounting a pack and reading entries out of it, the path every packaged asset load takes
+TOAST_BENCH_NAMED("assets", "assets/02-pack_read", bench_assets_02_pack_read) {
+	constexpr std::size_t file_count = 4096;
+	constexpr std::size_t file_size = 4096;
+	const toast::bench::scenes::PackFixture pack(file_count, file_size);
+
+	state.runCapped("mount (4096 entries)", file_count, 200, [&] {
+		assets::PackArchive archive(pack.path());
+		toast::bench::doNotOptimize(archive.entryCount());
+	});
+
+	const assets::PackArchive archive(pack.path());
+	std::mt19937 rng(7);
+	std::uniform_int_distribution<std::size_t> pick(0, file_count - 1);
+	state.runCapped("random read (4 KiB entries)", 64, 500, [&] {
+		for (int i = 0; i < 64; ++i) {
+			auto bytes = archive.read(pack.files()[pick(rng)]);
+			toast::bench::doNotOptimize(bytes);
+		}
+	});
+}
@@ -0,0 +1,184 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+namespace toast::bench {
+
+/// One measured case; a benchmark function may record several (e.g. one per hierarchy depth)
+struct Result {
+	std::string label;
+	std::size_t iterations = 0;
+	std::size_t items_per_iteration = 1;
+	double total_ns = 0.0;
+	std::vector<double> samples;    ///< ns per item of each timed batch
+
+	[[nodiscard]]
+	auto nsPerItem() const -> double {
+		const auto items = static_cast<double>(iterations * items_per_iteration);
+		return items > 0.0 ? total_ns / items : 0.0;
+	}
+
+	/// Median of the samples; what reports and baselines compare, since one preempted batch can't move it
+	[[nodiscard]]
+	auto median() const -> double {
+		if (samples.empty()) {
+			return nsPerItem();
+		}
+		std::vector<double> sorted = samples;
+		std::ranges::sort(sorted);
+		const std::size_t mid = sorted.size() / 2;
+		return sorted.size() % 2 ? sorted[mid] : (sorted[mid - 1] + sorted[mid]) * 0.5;
+	}
+
+	[[nodiscard]]
+	auto stddev() const -> double {
+		if (samples.size() < 2) {
+			return 0.0;
+		}
+		double mean = 0.0;
+		for (const double sample : samples) {
+			mean += sample;
+		}
+		mean /= static_cast<double>(samples.size());
+
+		double sum_sq = 0.0;
+		for (const double sample : samples) {
+			sum_sq += (sample - mean) * (sample - mean);
+		}
+		return std::sqrt(sum_sq / static_cast<double>(samples.size() - 1));
+	}
+
+	[[nodiscard]]
+	auto minimum() const -> double {
+		return samples.empty() ? nsPerItem() : std::ranges::min(samples);
+	}
+
+	[[nodiscard]]
+	auto maximum() const -> double {
+		return samples.empty() ? nsPerItem() : std::ranges::max(samples);
+	}
+};
+
+class State {
+public:
+	explicit State(std::size_t iterations) : m_iterations(iterations) { }
+
+	[[nodiscard]]
+	auto iterations() const -> std::size_t {
+		return m_iterations;
+	}
+
+	/**
+	 * @brief Times body() over iterations() runs after a short warmup and records the result
+	 * @param label Suffix shown next to the benchmark name
+	 * @param items Number of operations body() performs per call, used to report ns per item
+	 */
+	template<typename F>
+	void run(std::string_view label, std::size_t items, F&& body) {
+		measure(label, items, m_iterations, body);
+	}
+
+	template<typename F>
+	void run(std::string_view label, F&& body) {
+		run(label, 1, std::forward<F>(body));
+	}
+
+	/// Same as run() but never exceeds max_iterations; for bodies that build whole levels
+	template<typename F>
+	void runCapped(std::string_view label, std::size_t items, std::size_t max_iterations, F&& body) {
+		measure(label, items, std::min(m_iterations, max_iterations), body);
+	}
+
+	/// Records a duration the benchmark derived itself (e.g. a critical path) as a single iteration
+	void record(std::string_view label, double ns) {
+		m_results.push_back(Result {.label = std::string(label), .iterations = 1, .total_ns = ns, .samples = {ns}});
+	}
+
+	[[nodiscard]]
+	auto results() const -> const std::vector<Result>& {
+		return m_results;
+	}
+
+private:
+	/// Timed batches per result; the statistics are taken over these
+	static constexpr std::size_t sample_count = 15;
+
+	template<typename F>
+	void measure(std::string_view label, std::size_t items, std::size_t iterations, F& body) {
+		const std::size_t warmup = iterations / 10 + 1;
+		for (std::size_t i = 0; i < warmup; ++i) {
+			body();
+		}
+
+		const std::size_t samples = std::min(iterations, sample_count);
+		const std::size_t batch = iterations / samples;
+
+		Result result {.label = std::string(label), .iterations = batch * samples, .items_per_iteration = items};
+		result.samples.reserve(samples);
+		for (std::size_t s = 0; s < samples; ++s) {
+			const auto start = std::chrono::steady_clock::now();
+			for (std::size_t i = 0; i < batch; ++i) {
+				body();
+			}
+			const auto end = std::chrono::steady_clock::now();
+
+			const double ns = std::chrono::duration<double, std::nano>(end - start).count();
+			result.total_ns += ns;
+			result.samples.push_back(ns / static_cast<double>(batch * items));
+		}
+		m_results.push_back(std::move(result));
+	}
+
+	std::size_t m_iterations;
+	std::vector<Result> m_results;
+};
+
+/// Keeps the compiler from discarding a value computed inside a measured body
+template<typename T>
+inline void doNotOptimize(const T& value) {
+#if defined(_MSC_VER) && !defined(__clang__)
+	static volatile const void* sink;
+	sink = &value;
+	_ReadWriteBarrier();
+#else
+	asm volatile("" : : "r,m"(value) : "memory");
+#endif
+}
+
+using BenchFn = void (*)(State&);
+
+struct BenchCase {
+	std::string name;
+	std::string group;
+	BenchFn fn;
+};
+
+inline std::vector<BenchCase>& registry() {
+	static std::vector<BenchCase> cases;
+	return cases;
+}
+
+struct Registrar {
+	Registrar(const char* name, const char* group, BenchFn fn) {
+		registry().push_back(BenchCase {std::string(name), std::string(group), fn});
+	}
+};
+
+} // namespace toast::bench
+
+#define TOAST_BENCH_NAMED(group, name_str, fn_name)                                              \
+	static void fn_name(toast::bench::State&);                                                     \
+	static const toast::bench::Registrar fn_name##_registrar(name_str, group, &fn_name);            \
+	static void fn_name(toast::bench::State& state)
@@ -0,0 +1,202 @@
+#include "bench_registry.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <nlohmann/json.hpp>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <toast/reflect/reflect.hpp>
+#include <toast/world/world_test_access.hpp>
+
+namespace {
+
+void print_usage(const char* exe_name) {
+	std::cout << "Usage: " << exe_name
+	          << " [--list] [--bench <name>] [--filter <text>] [--iterations <n>]"
+	             " [--json <out.json>] [--baseline <in.json>] [--threshold <percent>] [--fail-on-regression]"
+	          << "\n";
+}
+
+auto resultKey(std::string_view bench_name, std::string_view label) -> std::string {
+	return std::string(bench_name) + " | " + std::string(label);
+}
+
+// Medians of a previous --json run, by resultKey()
+auto loadBaseline(const std::string& path) -> std::optional<std::map<std::string, double>> {
+	std::ifstream file(path);
+	if (!file.is_open()) {
+		std::cerr << "Cannot open baseline " << path << "\n";
+		return std::nullopt;
+	}
+
+	const auto json = nlohmann::json::parse(file, nullptr, false);
+	if (json.is_discarded() || !json.contains("results")) {
+		std::cerr << "Baseline " << path << " is not a toast_bench JSON file\n";
+		return std::nullopt;
+	}
+
+	std::map<std::string, double> medians;
+	for (const auto& entry : json["results"]) {
+		medians[resultKey(entry.value("bench", ""), entry.value("label", ""))] = entry.value("median_ns", 0.0);
+	}
+	return medians;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+	toast::NodeRegistry reflection_registry;
+	toast::registerEngineTypes();
+	toast::_detail::WorldTestAccess::initThreadPool();
+
+	std::string_view requested_bench;
+	std::string_view filter;
+	std::string json_path;
+	std::string baseline_path;
+	std::size_t iterations = 100000;
+	double threshold = 10.0;
+	bool list_only = false;
+	bool fail_on_regression = false;
+
+	for (int i = 1; i < argc; ++i) {
+		std::string_view arg = argv[i];
+		if (arg == "--list") {
+			list_only = true;
+		} else if (arg == "--fail-on-regression") {
+			fail_on_regression = true;
+		} else if (arg == "--bench" || arg == "--filter" || arg == "--iterations" || arg == "--json" || arg == "--baseline" ||
+		           arg == "--threshold") {
+			if (i + 1 >= argc) {
+				print_usage(argv[0]);
+				return 2;
+			}
+			std::string_view value = argv[++i];
+			if (arg == "--bench") {
+				requested_bench = value;
+			} else if (arg == "--filter") {
+				filter = value;
+			} else if (arg == "--json") {
+				json_path = value;
+			} else if (arg == "--baseline") {
+				baseline_path = value;
+			} else if (arg == "--threshold") {
+				auto [ptr, ec] = std::from_chars(value.data(), value.data() + value.size(), threshold);
+				if (ec != std::errc {} || threshold < 0.0) {
+					print_usage(argv[0]);
+					return 2;
+				}
+			} else {
+				auto [ptr, ec] = std::from_chars(value.data(), value.data() + value.size(), iterations);
+				if (ec != std::errc {} || iterations == 0) {
+					print_usage(argv[0]);
+					return 2;
+				}
+			}
+		} else if (arg == "--help" || arg == "-h") {
+			print_usage(argv[0]);
+			return 0;
+		}
+	}
+
+	const auto& cases = toast::bench::registry();
+	if (list_only) {
+		for (const auto& bench_case : cases) {
+			std::cout << bench_case.name << "\n";
+		}
+		return 0;
+	}
+
+	std::optional<std::map<std::string, double>> baseline;
+	if (!baseline_path.empty()) {
+		baseline = loadBaseline(baseline_path);
+		if (!baseline) {
+			return 2;
+		}
+	}
+
+	nlohmann::json json_results = nlohmann::json::array();
+	std::size_t regressions = 0;
+
+	auto run_case = [&](const toast::bench::BenchCase& bench_case) {
+		toast::bench::State state(iterations);
+		bench_case.fn(state);
+		for (const auto& result : state.results()) {
+			const double median = result.median();
+			const double spread = median > 0.0 ? result.stddev() / median * 100.0 : 0.0;
+			std::printf(
+			    "%-48s %-36s %12zu it %12.2f ns/op  +-%5.1f%%",
+			    bench_case.name.c_str(),
+			    result.label.c_str(),
+			    result.iterations,
+			    median,
+			    spread
+			);
+
+			// Slower than the baseline by more than the threshold counts as a regression
+			if (baseline) {
+				const auto it = baseline->find(resultKey(bench_case.name, result.label));
+				if (it != baseline->end() && it->second > 0.0) {
+					const double delta = (median - it->second) / it->second * 100.0;
+					const bool regressed = delta > threshold;
+					regressions += regressed ? 1 : 0;
+					std::printf("  %+7.1f%% vs baseline%s", delta, regressed ? "  REGRESSION" : "");
+				} else {
+					std::printf("  (new)");
+				}
+			}
+			std::printf("\n");
+
+			json_results.push_back({
+			    {"bench", bench_case.name},
+			    {"group", bench_case.group},
+			    {"label", result.label},
+			    {"iterations", result.iterations},
+			    {"items_per_iteration", result.items_per_iteration},
+			    {"median_ns", median},
+			    {"mean_ns", result.nsPerItem()},
+			    {"stddev_ns", result.stddev()},
+			    {"min_ns", result.minimum()},
+			    {"max_ns", result.maximum()},
+			    {"samples_ns", result.samples},
+			});
+		}
+	};
+
+	if (!requested_bench.empty()) {
+		auto it = std::find_if(cases.begin(), cases.end(), [&](const auto& bench_case) {
+			return bench_case.name == requested_bench;
+		});
+		if (it == cases.end()) {
+			std::cerr << "Unknown benchmark: " << requested_bench << "\n";
+			return 2;
+		}
+		run_case(*it);
+	} else {
+		for (const auto& bench_case : cases) {
+			if (filter.empty() || bench_case.name.find(filter) != std::string::npos) {
+				run_case(bench_case);
+			}
+		}
+	}
+
+	if (!json_path.empty()) {
+		std::ofstream out(json_path, std::ios::trunc);
+		if (!out.is_open()) {
+			std::cerr << "Cannot write " << json_path << "\n";
+			return 2;
+		}
+		const nlohmann::json document = {{"version", 1}, {"iterations", iterations}, {"results", json_results}};
+		out << document.dump(2) << "\n";
+	}
+
+	if (baseline && regressions > 0) {
+		std::printf("%zu result(s) regressed more than %.1f%% against %s\n", regressions, threshold, baseline_path.c_str());
+		return fail_on_regression ? 1 : 0;
+	}
+	return 0;
+}
@@ -0,0 +1,55 @@
+#include "../bench_registry.hpp"
+
+#include <chrono>
+#include <toast/stage_graph.hpp>
+
+using namespace toast;
+
+namespace {
+
+// Stand-in for a stage's work; spins so the numbers don't depend on the scheduler's sleep granularity
+void spinFor(std::chrono::microseconds duration) {
+	const auto end = std::chrono::steady_clock::now() + duration;
+	while (std::chrono::steady_clock::now() < end) { }
+}
+
+// Same stages and resources as Engine::registerFrameStages, with costs of a busy editor frame
+void addEngineStages(StageGraph& graph) {
+	using R = FrameResource;
+	using std::chrono_literals::operator""us;
+
+	graph.addStage("Audio", R::none, R::audio, [] { spinFor(300us); });
+	graph.addStage("UI", R::world | R::assets, R::ui, [] { spinFor(1200us); });
+	graph.addStage("Lua memory", R::time, R::lua, [] { spinFor(20us); });
+	graph.addStage("Asset upkeep", R::time, R::assets, [] { spinFor(50us); });
+	graph.addStage("Render build", R::world | R::assets | R::ui | R::time, R::render_frame, [] { spinFor(2000us); });
+}
+
+}
+
+TOAST_BENCH_NAMED("engine", "engine/01-frame_stages", bench_engine_01_frame_stages) {
+	using std::chrono_literals::operator""us;
+
+	// One frame is the post-simulation stages plus the next frame's window pump (500us on the main thread)
+	StageGraph serial;
+	addEngineStages(serial);
+	serial.setParallel(false);
+	state.runCapped("serial stages + window pump", 1, 200, [&] {
+		serial.run();
+		spinFor(500us);
+		serial.finish();
+	});
+
+	StageGraph staged;
+	addEngineStages(staged);
+	state.runCapped("stage graph + window pump", 1, 200, [&] {
+		staged.run();
+		spinFor(500us);
+		staged.finish();
+	});
+
+	// What the stages alone cost in the last frame, back to back vs. the slowest stage per wave;
+	// the gap is what the graph saves on a machine with enough cores
+	state.record("stages serial sum", staged.serialMs() * 1e6);
+	state.record("stages critical path", staged.criticalPathMs() * 1e6);
+}
@@ -0,0 +1,54 @@
+#include "../bench_registry.hpp"
+
+#include <string>
+#include <toast/log.hpp>
+#include <toast/log_capture.hpp>
+
+namespace {
+
+#pragma push_macro("TOAST_LOG_MIN_SEVERITY")
+#undef TOAST_LOG_MIN_SEVERITY
+#define TOAST_LOG_MIN_SEVERITY 1
+void compiledOutTrace(int i, float value) {
+	TOAST_TRACE("Bench", "step {} value {:.3f}", i, value);
+}
+#pragma pop_macro("TOAST_LOG_MIN_SEVERITY")
+
+}
+
+// Caller-side cost of a trace in a hot loop; the capture stands in for the Logger's queue so no
+// log server is needed, and its deferred entries are formatted separately like the drain job does
+TOAST_BENCH_NAMED("engine", "engine/02-logging", bench_engine_02_logging) {
+	constexpr std::size_t calls = 1000;
+	logging::LogCapture capture(calls);
+	const std::string name = "player";
+
+	state.run("compiled out", calls, [&] {
+		for (int i = 0; i < static_cast<int>(calls); ++i) {
+			compiledOutTrace(i, 0.5f);
+		}
+	});
+
+	logging::setLevel("BenchFiltered", 1);
+	state.run("filtered by sink level", calls, [&] {
+		for (int i = 0; i < static_cast<int>(calls); ++i) {
+			TOAST_TRACE("BenchFiltered", "step {} value {:.3f}", i, 0.5f);
+		}
+	});
+	logging::resetLevel("BenchFiltered");
+
+	// A string argument can't be deferred, so this formats on the calling thread
+	state.run("enabled, formatted", calls, [&] {
+		for (int i = 0; i < static_cast<int>(calls); ++i) {
+			TOAST_TRACE("Bench", "step {} value {:.3f} {}", i, 0.5f, name);
+		}
+	});
+
+	state.run("enabled, deferred", calls, [&] {
+		for (int i = 0; i < static_cast<int>(calls); ++i) {
+			TOAST_TRACE("Bench", "step {} value {:.3f} {}", i, 0.5f, 42);
+		}
+	});
+
+	state.run("format deferred entries", calls, [&] { toast::bench::doNotOptimize(capture.entries().data()); });
+}
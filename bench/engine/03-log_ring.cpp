@@ -0,0 +1,99 @@
+#include "../bench_registry.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <toast/log_file.hpp>
+#include <toast/log_ring.hpp>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t log_ring_producers = 4;
+constexpr std::size_t log_ring_pushes = 10000;
+
+auto benchRecord() -> std::vector<std::byte> {
+	std::vector<std::byte> record;
+	logging::encodeLogRecord({.timestamp = 1, .line = 42, .severity = 0, .sink = "Bench", .file = "bench.cpp", .message = "step 42 value 0.500"}, record);
+	return record;
+}
+
+}
+
+// Several threads logging at once while a drain thread empties what they push; the mutex and
+// deque stand in for the queue the Logger used before every thread got its own ring
+TOAST_BENCH_NAMED("engine", "engine/03-log_ring", bench_engine_03_log_ring) {
+	const std::vector<std::byte> record = benchRecord();
+	constexpr std::size_t items = log_ring_producers * log_ring_pushes;
+
+	state.run("4 threads, shared mutex queue", items, [&] {
+		std::mutex mutex;
+		std::deque<std::vector<std::byte>> queue;
+		std::atomic<std::size_t> running = log_ring_producers;
+
+		std::thread drain([&] {
+			std::deque<std::vector<std::byte>> pending;
+			while (running.load(std::memory_order_acquire) > 0 or not pending.empty()) {
+				pending.clear();
+				std::scoped_lock lock(mutex);
+				pending.swap(queue);
+			}
+		});
+		std::array<std::thread, log_ring_producers> producers;
+		for (auto& producer : producers) {
+			producer = std::thread([&] {
+				for (std::size_t i = 0; i < log_ring_pushes; ++i) {
+					std::scoped_lock lock(mutex);
+					queue.push_back(record);
+				}
+				running.fetch_sub(1, std::memory_order_release);
+			});
+		}
+		for (auto& producer : producers) {
+			producer.join();
+		}
+		drain.join();
+	});
+
+	state.run("4 threads, one ring each", items, [&] {
+		std::array<std::unique_ptr<logging::LogRing>, log_ring_producers> rings;
+		for (auto& ring : rings) {
+			ring = std::make_unique<logging::LogRing>(64 * 1024);
+		}
+
+		std::thread drain([&] {
+			std::vector<std::byte> payload;
+			logging::LogRing::Kind kind {};
+			uint64_t popped = 0;
+			bool retired = false;
+			while (not retired) {
+				retired = std::ranges::all_of(rings, [](const auto& ring) { return ring->retired(); });
+				for (auto& ring : rings) {
+					while (ring->pop(kind, payload)) {
+						++popped;
+					}
+					popped += ring->takeDropped();
+				}
+			}
+			toast::bench::doNotOptimize(popped);
+		});
+		std::array<std::thread, log_ring_producers> producers;
+		for (std::size_t p = 0; p < log_ring_producers; ++p) {
+			producers[p] = std::thread([&, p] {
+				for (std::size_t i = 0; i < log_ring_pushes; ++i) {
+					rings[p]->push(logging::LogRing::Kind::record, record);
+				}
+				rings[p]->retire();
+			});
+		}
+		for (auto& producer : producers) {
+			producer.join();
+		}
+		drain.join();
+	});
+}
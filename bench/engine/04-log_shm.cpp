@@ -0,0 +1,41 @@
+#include "../bench_registry.hpp"
+
+#include <cstddef>
+#include <filesystem>
+#include <toast/log_file.hpp>
+#include <toast/log_shm.hpp>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t log_shm_records = 10000;
+
+}
+
+// What the drain job pays per record when it logs to shared memory, and what a reader on the
+// other side pays to get them back out; no syscall or re-encode on either side
+TOAST_BENCH_NAMED("engine", "engine/04-log_shm", bench_engine_04_log_shm) {
+	const auto path = std::filesystem::temp_directory_path() / "toast_log_shm_bench" / "engine.tshm";
+	std::vector<std::byte> record;
+	logging::encodeLogRecord({.timestamp = 1, .line = 42, .severity = 0, .sink = "Bench", .file = "bench.cpp", .message = "step 42 value 0.500"}, record);
+
+	logging::LogShmWriter writer(path, 4 * 1024 * 1024);
+	logging::LogShmReader reader(path);
+	std::vector<std::byte> records;
+
+	state.runCapped("write, 10k records", log_shm_records, 2000, [&] {
+		for (std::size_t i = 0; i < log_shm_records; ++i) {
+			writer.write(record);
+		}
+	});
+
+	state.runCapped("write + read, 10k records", log_shm_records, 2000, [&] {
+		for (std::size_t i = 0; i < log_shm_records; ++i) {
+			writer.write(record);
+		}
+		records.clear();
+		toast::bench::doNotOptimize(reader.read(records));
+	});
+
+	std::filesystem::remove_all(path.parent_path());
+}
@@ -0,0 +1,40 @@
+#include "../bench_registry.hpp"
+
+#include <string>
+#include <toast/events/event.hpp>
+#include <toast/events/listener.hpp>
+#include <vector>
+
+namespace {
+
+struct BenchEvent : event::Event<BenchEvent> {
+	int value;
+
+	explicit BenchEvent(int v) : value(v) { }
+};
+
+}
+
+// One pollEvents() cycle: queue a batch of events, then dispatch them to every listener
+TOAST_BENCH_NAMED("events", "events/01-dispatch", bench_events_01_dispatch) {
+	constexpr std::size_t batch = 1000;
+
+	for (const std::size_t listener_count : {1uz, 10uz, 100uz}) {
+		std::vector<event::Listener> listeners(listener_count);
+		long sum = 0;
+		for (auto& listener : listeners) {
+			listener.subscribe<BenchEvent>([&sum](BenchEvent& e) {
+				sum += e.value;
+				return false;
+			});
+		}
+
+		state.runCapped("send + poll, " + std::to_string(listener_count) + " listeners", batch * listener_count, 2000, [&] {
+			for (std::size_t i = 0; i < batch; ++i) {
+				event::send<BenchEvent>(static_cast<int>(i));
+			}
+			event::pollEvents();
+			toast::bench::doNotOptimize(sum);
+		});
+	}
+}
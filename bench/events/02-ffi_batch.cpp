@@ -0,0 +1,80 @@
+#include "../bench_registry.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <ffi/events.h>
+#include <string>
+#include <toast/events/event.hpp>
+#include <toast/window/window_events.hpp>
+
+namespace {
+
+// Stand-ins for the C# side: they touch every byte they're given, like a parser would
+
+auto ffiBenchPerEvent(const char*, const uint8_t* data, uint32_t size, void* user_data) noexcept -> int {
+	auto& sum = *static_cast<uint64_t*>(user_data);
+	for (uint32_t i = 0; i < size; ++i) {
+		sum += data[i];
+	}
+	return 0;
+}
+
+void ffiBenchPerBatch(const event_batch* batch, void* user_data) noexcept {
+	auto& sum = *static_cast<uint64_t*>(user_data);
+	for (uint32_t r = 0; r < batch->count; ++r) {
+		const event_record& record = batch->records[r];
+		for (uint32_t i = 0; i < record.size; ++i) {
+			sum += batch->data[record.offset + i];
+		}
+	}
+	events_batch_release(batch->fence);
+}
+
+}
+
+// Events crossing to C#: one call and one serialization per event and handler, against one
+// serialization per event and one call per frame
+TOAST_BENCH_NAMED("events", "events/02-ffi_batch", bench_events_02_ffi_batch) {
+	constexpr std::size_t batch = 1000;
+	constexpr const char* name = "proto.events.WindowClose";
+	event::registerProtoEvents();
+
+	for (const std::size_t handler_count : {1uz, 10uz}) {
+		uint64_t sum = 0;
+		const uint32_t listener = events_listener_create();
+		for (std::size_t i = 0; i < handler_count; ++i) {
+			// Each C# handler had its own native callback
+			events_listener_subscribe(listener, name, &ffiBenchPerEvent, &sum, 0);
+		}
+
+		state.runCapped("per-event calls, " + std::to_string(handler_count) + " handlers", batch, 2000, [&] {
+			for (std::size_t i = 0; i < batch; ++i) {
+				event::send<event::WindowClose>(static_cast<uint32_t>(i));
+			}
+			event::pollEvents();
+			toast::bench::doNotOptimize(sum);
+		});
+		events_listener_destroy(listener);
+	}
+
+	for (const std::size_t handler_count : {1uz, 10uz}) {
+		uint64_t sum = 0;
+		events_batch_set_callback(&ffiBenchPerBatch, &sum);
+		for (std::size_t i = 0; i < handler_count; ++i) {
+			events_batch_subscribe(name);
+		}
+
+		state.runCapped("batched, " + std::to_string(handler_count) + " handlers", batch, 2000, [&] {
+			for (std::size_t i = 0; i < batch; ++i) {
+				event::send<event::WindowClose>(static_cast<uint32_t>(i));
+			}
+			event::pollEvents();
+			toast::bench::doNotOptimize(sum);
+		});
+
+		for (std::size_t i = 0; i < handler_count; ++i) {
+			events_batch_unsubscribe(name);
+		}
+		events_batch_set_callback(nullptr, nullptr);
+	}
+}
@@ -0,0 +1,62 @@
+#include "../bench_registry.hpp"
+
+#include <cstdint>
+#include <string>
+#include <toast/events/event.hpp>
+#include <toast/events/listener.hpp>
+#include <vector>
+
+namespace {
+
+struct EveryNodeChanged : event::Event<EveryNodeChanged> {
+	uint64_t uid;
+	int value;
+
+	EveryNodeChanged(uint64_t uid, int v) : uid(uid), value(v) { }
+};
+
+struct LatestNodeChanged : event::Event<LatestNodeChanged> {
+	static constexpr auto coalesce = event::Coalesce::by_key;
+
+	uint64_t uid;
+	int value;
+
+	LatestNodeChanged(uint64_t uid, int v) : uid(uid), value(v) { }
+
+	[[nodiscard]]
+	auto coalesceKey() const -> uint64_t {
+		return uid;
+	}
+};
+
+template<typename T>
+void benchNodeChanges(toast::bench::State& state, const std::string& label) {
+	constexpr std::size_t sends = 10000;
+	constexpr uint64_t nodes = 100;
+	constexpr std::size_t listener_count = 10;
+
+	std::vector<event::Listener> listeners(listener_count);
+	long sum = 0;
+	for (auto& listener : listeners) {
+		listener.subscribe<T>([&sum](T& e) {
+			sum += e.value;
+			return false;
+		});
+	}
+
+	state.runCapped(label, sends, 200, [&] {
+		for (std::size_t i = 0; i < sends; ++i) {
+			event::send<T>(i % nodes, static_cast<int>(i));
+		}
+		event::pollEvents();
+		toast::bench::doNotOptimize(sum);
+	});
+}
+
+}
+
+// A bulk edit: every node of a 100-node selection reports its state 100 times in one frame, to 10 listeners
+TOAST_BENCH_NAMED("events", "events/03-coalesce", bench_events_03_coalesce) {
+	benchNodeChanges<EveryNodeChanged>(state, "10k sends, every one dispatched");
+	benchNodeChanges<LatestNodeChanged>(state, "10k sends, latest per node");
+}
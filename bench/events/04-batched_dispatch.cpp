@@ -0,0 +1,55 @@
+#include "../bench_registry.hpp"
+
+#include <toast/events/event.hpp>
+#include <toast/events/listener.hpp>
+#include <vector>
+
+namespace {
+
+struct BatchedEvent : event::Event<BatchedEvent> {
+	int value;
+
+	explicit BatchedEvent(int v) : value(v) { }
+};
+
+struct InterleavedEvent : event::Event<InterleavedEvent> {
+	int value;
+
+	explicit InterleavedEvent(int v) : value(v) { }
+};
+
+}
+
+// 10k events x 100 listeners in one pollEvents(); items are callback invocations. One type is a
+// single run, alternating two types makes every run one event long
+TOAST_BENCH_NAMED("events", "events/04-batched_dispatch", bench_events_04_batched_dispatch) {
+	constexpr std::size_t events = 10'000;
+	constexpr std::size_t listener_count = 100;
+
+	std::vector<event::Listener> listeners(listener_count);
+	long sum = 0;
+	for (auto& listener : listeners) {
+		listener.subscribe<BatchedEvent>([&sum](BatchedEvent& e) { sum += e.value; });
+		listener.subscribe<InterleavedEvent>([&sum](InterleavedEvent& e) { sum -= e.value; });
+	}
+
+	state.runCapped("10k events, 100 listeners, one type", events * listener_count, 50, [&] {
+		for (std::size_t i = 0; i < events; ++i) {
+			event::send<BatchedEvent>(static_cast<int>(i));
+		}
+		event::pollEvents();
+		toast::bench::doNotOptimize(sum);
+	});
+
+	state.runCapped("10k events, 100 listeners, two types alternating", events * listener_count, 50, [&] {
+		for (std::size_t i = 0; i < events; ++i) {
+			if (i % 2 == 0) {
+				event::send<BatchedEvent>(static_cast<int>(i));
+			} else {
+				event::send<InterleavedEvent>(static_cast<int>(i));
+			}
+		}
+		event::pollEvents();
+		toast::bench::doNotOptimize(sum);
+	});
+}
@@ -0,0 +1,79 @@
+#include "../bench_registry.hpp"
+
+#include <cmath>
+#include <random>
+#include <string>
+#include <toast/physics/broadphase.hpp>
+#include <toast/physics/cpu_backend.hpp>
+#include <vector>
+
+using namespace physics;
+
+namespace {
+
+// Bodies spread so each one overlaps a handful of neighbours regardless of the count
+auto makeBodies(size_t count) -> std::vector<PhysicsBody> {
+	std::mt19937 rng(42);
+	const float side = std::cbrt(static_cast<float>(count)) * 2.5f;
+	std::uniform_real_distribution<float> coord(0.0f, side);
+	std::uniform_real_distribution<float> size(0.25f, 0.75f);
+	std::uniform_real_distribution<float> speed(-1.0f, 1.0f);
+
+	std::vector<PhysicsBody> bodies(count);
+	for (size_t i = 0; i < count; ++i) {
+		PhysicsBody& body = bodies[i];
+		body.position = {coord(rng), coord(rng), coord(rng)};
+		body.velocity = {speed(rng), speed(rng), speed(rng)};
+		body.shape = i % 2 ? ShapeType::box : ShapeType::sphere;
+		body.extents = body.shape == ShapeType::box ? glm::vec3 {size(rng), size(rng), size(rng)} : glm::vec3 {size(rng), 0.0f, 0.0f};
+		body.inv_mass = i % 8 ? 1.0f : 0.0f;
+	}
+	return bodies;
+}
+
+auto boundsOf(const std::vector<PhysicsBody>& bodies) -> std::vector<Aabb> {
+	std::vector<Aabb> bounds(bodies.size());
+	for (size_t i = 0; i < bodies.size(); ++i) {
+		bounds[i] = bodies[i].bounds();
+	}
+	return bounds;
+}
+
+}
+
+TOAST_BENCH_NAMED("physics", "physics/01-broadphase", bench_physics_01_broadphase) {
+	for (const size_t count : {10000uz, 50000uz, 100000uz}) {
+		const std::string suffix = " (" + std::to_string(count / 1000) + "k bodies)";
+		std::vector<PhysicsBody> bodies = makeBodies(count);
+		std::vector<Aabb> bounds = boundsOf(bodies);
+		std::vector<BroadphasePair> pairs;
+		SweepAndPrune sap;
+
+		state.runCapped("sap full sort" + suffix, count, 50, [&] {
+			sap.invalidate();
+			sap.findPairs(bounds, pairs);
+			toast::bench::doNotOptimize(pairs.data());
+		});
+
+		// Bodies drift a little every step, the common case the cached order is for
+		float drift = 0.01f;
+		state.runCapped("sap coherent" + suffix, count, 50, [&] {
+			for (Aabb& box : bounds) {
+				box.min.x += drift;
+				box.max.x += drift;
+			}
+			drift = -drift;
+			sap.findPairs(bounds, pairs);
+			toast::bench::doNotOptimize(pairs.data());
+		});
+
+		PhysicsState physics_state;
+		physics_state.bodies = bodies;
+		CpuPhysicsBackend backend;
+		state.runCapped("cpu backend step" + suffix, count, 20, [&] {
+			physics_state.contacts.clear();
+			backend.step(physics_state, 1.0f / 120.0f);
+			toast::bench::doNotOptimize(physics_state.contacts.data());
+		});
+	}
+}
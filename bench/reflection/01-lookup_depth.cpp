@@ -0,0 +1,68 @@
+#include "../bench_registry.hpp"
+
+#include <deque>
+#include <format>
+#include <map>
+#include <string_view>
+#include <toast/reflect/reflect_node.hpp>
+
+namespace {
+
+auto depthOf(const toast::NodeInfo* info) -> int {
+	int depth = 0;
+	for (const auto* cur = info; cur; cur = cur->base_type) {
+		++depth;
+	}
+	return depth;
+}
+
+/// Copies an inheritance chain with the generated lookup tables stripped, so lookups take the
+/// linear scan + base_type walk the registry used before the tables existed
+auto stripLookups(const toast::NodeInfo* info, std::deque<toast::NodeInfo>& storage) -> const toast::NodeInfo* {
+	if (!info) {
+		return nullptr;
+	}
+	const auto* base = stripLookups(info->base_type, storage);
+	auto& copy = storage.emplace_back(*info);
+	copy.base_type = base;
+	copy.field_lookup = {};
+	copy.method_lookup = {};
+	copy.lookup_base = nullptr;
+	return &copy;
+}
+
+/// Last field of the root type, the worst case for the old scan
+auto rootFieldName(const toast::NodeInfo* info) -> std::string_view {
+	while (info->base_type) {
+		info = info->base_type;
+	}
+	return info->all_fields.empty() ? std::string_view {} : info->all_fields.back().name;
+}
+
+}
+
+TOAST_BENCH_NAMED("reflection", "reflection/01-lookup_depth", bench_reflection_01_lookup_depth) {
+	// One representative type per hierarchy depth
+	std::map<int, const toast::NodeInfo*> by_depth;
+	toast::NodeRegistry::forEachType([&](const toast::NodeInfo* info) {
+		auto [it, inserted] = by_depth.emplace(depthOf(info), info);
+		if (!inserted && info->type < it->second->type) {
+			it->second = info;    // keep the pick stable between runs
+		}
+	});
+
+	std::deque<toast::NodeInfo> legacy_storage;
+	for (const auto& [depth, info] : by_depth) {
+		const auto* legacy = stripLookups(info, legacy_storage);
+		const std::string_view root_field = rootFieldName(info);
+		const std::string_view own_field = info->all_fields.empty() ? root_field : info->all_fields.back().name;
+		const std::string_view missing = "__not_a_field__";
+
+		state.run(std::format("d{} table root", depth), [&] { toast::bench::doNotOptimize(info->getField(root_field)); });
+		state.run(std::format("d{} scan  root", depth), [&] { toast::bench::doNotOptimize(legacy->getField(root_field)); });
+		state.run(std::format("d{} table own", depth), [&] { toast::bench::doNotOptimize(info->getField(own_field)); });
+		state.run(std::format("d{} scan  own", depth), [&] { toast::bench::doNotOptimize(legacy->getField(own_field)); });
+		state.run(std::format("d{} table miss", depth), [&] { toast::bench::doNotOptimize(info->getField(missing)); });
+		state.run(std::format("d{} scan  miss", depth), [&] { toast::bench::doNotOptimize(legacy->getField(missing)); });
+	}
+}
@@ -0,0 +1,18 @@
+#include "../bench_registry.hpp"
+
+#include <algorithm>
+#include <string_view>
+#include <toast/reflect/reflect_node.hpp>
+#include <vector>
+
+TOAST_BENCH_NAMED("reflection", "reflection/02-registry_reflect", bench_reflection_02_registry_reflect) {
+	std::vector<std::string_view> names;
+	toast::NodeRegistry::forEachType([&](const toast::NodeInfo* info) { names.push_back(info->type); });
+	std::ranges::sort(names);
+
+	state.run("all types", names.size(), [&] {
+		for (auto name : names) {
+			toast::bench::doNotOptimize(toast::NodeRegistry::reflect(name));
+		}
+	});
+}
@@ -0,0 +1,209 @@
+#pragma once
+
+#include "toast/world/world_test_access.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <string>
+#include <string_view>
+#include <toast/assets/prefab.hpp>
+#include <toast/assets/script.hpp>
+#include <toast/scripting/lua_state.hpp>
+#include <toast/world/node_3d.hpp>
+#include <tuple>
+#include <vector>
+
+// Procedural fixtures shared by the benchmarks; everything is built in memory or under the temp
+// directory so the runner needs no project, GPU or network
+namespace toast::bench::scenes {
+
+inline auto transformNode(std::string name, UID uid, UID parent) -> assets::Prefab::BasicNode {
+	assets::Prefab::BasicNode node {.name = std::move(name), .type = "toast::Node3D"};
+	node.fields.push_back({"m_uid", FieldType::uid_t, false, uid});
+	if (parent.data() != 0) {
+		node.fields.push_back({"m_parent", FieldType::uid_t, false, parent});
+	}
+	node.fields.push_back({"m_local_enabled", FieldType::bool_t, false, true});
+	node.fields.push_back({"position", FieldType::vec3_t, false, glm::vec3 {1.0f, 0.0f, 0.0f}});
+	node.fields.push_back({"rotation", FieldType::quaternion_t, false, glm::quat {1.0f, 0.0f, 0.0f, 0.0f}});
+	node.fields.push_back({"scale", FieldType::vec3_t, false, glm::vec3 {1.0f}});
+	return node;
+}
+
+/// A single chain of Node3Ds, each the child of the previous one; worst case for recursive walks
+inline auto deepPrefab(std::size_t depth) -> assets::Prefab {
+	assets::Prefab prefab;
+	for (std::size_t i = 0; i < depth; ++i) {
+		prefab.nodes.push_back(transformNode("deep_" + std::to_string(i), UID(0x1000 + i), UID(i == 0 ? 0 : 0x1000 + i - 1)));
+	}
+	return prefab;
+}
+
+/// One root with width direct children; worst case for per-parent child lists
+inline auto widePrefab(std::size_t width) -> assets::Prefab {
+	assets::Prefab prefab;
+	prefab.nodes.push_back(transformNode("wide_root", UID(0x1000), UID(0)));
+	for (std::size_t i = 0; i < width; ++i) {
+		prefab.nodes.push_back(transformNode("wide_" + std::to_string(i), UID(0x1001 + i), UID(0x1000)));
+	}
+	return prefab;
+}
+
+/// Instantiates a generated prefab into the world and makes it the world root
+inline auto instantiate(World& world, assets::Prefab& prefab) -> Box<Node> {
+	assets::Handle<assets::Prefab> handle(&prefab, UID(0xBE4C0000), "");
+	INodeOwner::InstantiateContext context;
+	context.resolver = [](UID) { return assets::Handle<assets::Prefab> {}; };
+	Box<Node> root = _detail::WorldTestAccess::instantiate(world, handle, context);
+	_detail::WorldTestAccess::setWorldRoot(world, *root);
+	return root;
+}
+
+/**
+ * @brief Ticking nodes wired into a random DAG, each with up to edges_per_node predecessors
+ *
+ * Edges only point from lower to higher indices, so there are no cycles and the wave count grows
+ * with the longest chain the dice produce
+ */
+inline auto dependencyWeb(World& world, std::size_t count, std::size_t edges_per_node, uint32_t seed = 42)
+    -> std::vector<Box<Node>> {
+	std::mt19937 rng(seed);
+	std::vector<Box<Node>> nodes;
+	nodes.reserve(count);
+	for (std::size_t i = 0; i < count; ++i) {
+		Box<Node> node = _detail::WorldTestAccess::createNode(world, "web_" + std::to_string(i));
+		_detail::WorldTestAccess::addTickStage(*node, TickFunctionList::early_tick | TickFunctionList::tick);
+		if (i > 0) {
+			std::uniform_int_distribution<std::size_t> pick(0, i - 1);
+			for (std::size_t e = 0; e < edges_per_node; ++e) {
+				_detail::WorldTestAccess::registerDependency(*nodes[pick(rng)], *node);
+			}
+		}
+		nodes.push_back(std::move(node));
+	}
+	return nodes;
+}
+
+/// One LuaState per process, created on first use
+inline auto luaState() -> ::scripting::LuaState& {
+	static auto state = ::scripting::LuaState::create();
+	return *state;
+}
+
+/// Nodes whose only tick is a small Lua script that keeps a counter
+inline auto scriptedNodes(World& world, std::size_t count) -> std::vector<Box<Node>> {
+	static constexpr std::string_view source = R"lua(
+local M = {}
+function M:tick()
+	self.ticks = (self.ticks or 0) + 1
+end
+return M
+)lua";
+	static assets::Script script(std::vector<uint8_t>(source.begin(), source.end()));
+	const assets::Handle<assets::Script> handle(&script, UID(0x5C817), "bench://counter.lua");
+
+	luaState();
+	std::vector<Box<Node>> nodes;
+	nodes.reserve(count);
+	for (std::size_t i = 0; i < count; ++i) {
+		Box<Node> node = _detail::WorldTestAccess::createNode(world, "scripted_" + std::to_string(i));
+		_detail::WorldTestAccess::attachScript(*node, handle);
+		nodes.push_back(std::move(node));
+	}
+	return nodes;
+}
+
+/**
+ * @brief A PACK v2 archive with generated entries, written to the temp directory and removed again
+ *
+ * Entries are stored uncompressed; the writer mirrors tools/asset_packer's layout otherwise
+ */
+class PackFixture {
+public:
+	PackFixture(std::size_t file_count, std::size_t file_size) {
+		m_path = std::filesystem::temp_directory_path() / ("toast_bench_" + std::to_string(file_count) + ".pak");
+
+		struct Entry {
+			uint64_t hash;
+			std::string path;
+			uint64_t offset;
+		};
+		std::vector<Entry> entries;
+		std::ofstream out(m_path, std::ios::binary | std::ios::trunc);
+
+		out.write("PACK\0\0", 6);
+		writeLe(out, uint16_t {2});
+		writeLe(out, static_cast<uint32_t>(file_count));
+		writeLe(out, uint64_t {0});    // table offset, patched below
+
+		std::vector<char> blob(file_size);
+		for (std::size_t i = 0; i < file_count; ++i) {
+			std::string path = "bench/file_" + std::to_string(i) + ".bin";
+			std::ranges::fill(blob, static_cast<char>(i));
+			entries.push_back({fnv1a64(path), path, static_cast<uint64_t>(out.tellp())});
+			out.write(blob.data(), static_cast<std::streamsize>(blob.size()));
+			m_files.push_back(std::move(path));
+		}
+
+		const auto table_offset = static_cast<uint64_t>(out.tellp());
+		std::ranges::sort(entries, [](const Entry& a, const Entry& b) { return std::tie(a.hash, a.path) < std::tie(b.hash, b.path); });
+		writeLe(out, static_cast<uint32_t>(file_count));
+		for (const Entry& entry : entries) {
+			writeLe(out, entry.hash);
+			writeLe(out, static_cast<uint32_t>(entry.path.size()));
+			out.write(entry.path.data(), static_cast<std::streamsize>(entry.path.size()));
+			writeLe(out, entry.offset);
+			writeLe(out, static_cast<uint64_t>(file_size));
+			writeLe(out, static_cast<uint64_t>(file_size));
+			writeLe(out, uint8_t {0});
+		}
+
+		out.seekp(12);
+		writeLe(out, table_offset);
+	}
+
+	~PackFixture() {
+		std::error_code ec;
+		std::filesystem::remove(m_path, ec);
+	}
+
+	PackFixture(const PackFixture&) = delete;
+	auto operator=(const PackFixture&) -> PackFixture& = delete;
+
+	[[nodiscard]]
+	auto path() const -> const std::filesystem::path& {
+		return m_path;
+	}
+
+	/// Relative paths of every entry, in write order
+	[[nodiscard]]
+	auto files() const -> const std::vector<std::string>& {
+		return m_files;
+	}
+
+private:
+	template<typename T>
+	static void writeLe(std::ofstream& out, T value) {
+		for (std::size_t i = 0; i < sizeof(T); ++i) {
+			out.put(static_cast<char>((static_cast<uint64_t>(value) >> (i * 8)) & 0xFF));
+		}
+	}
+
+	static auto fnv1a64(std::string_view s) -> uint64_t {
+		uint64_t hash = 14695981039346656037ull;
+		for (const char c : s) {
+			hash ^= static_cast<uint8_t>(c);
+			hash *= 1099511628211ull;
+		}
+		return hash;
+	}
+
+	std::filesystem::path m_path;
+	std::vector<std::string> m_files;
+};
+
+}
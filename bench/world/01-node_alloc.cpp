@@ -0,0 +1,66 @@
+#include "../bench_registry.hpp"
+#include "toast/world/world_test_access.hpp"
+
+#include <array>
+#include <toast/world/node_3d.hpp>
+#include <toast/world/node_pool.hpp>
+#include <vector>
+
+using namespace toast;
+using WorldTestAccess = toast::_detail::WorldTestAccess;
+
+// Allocates a burst of nodes and frees all of them, the shape of a level spawn followed by an unload
+TOAST_BENCH_NAMED("world", "world/01-node_alloc", bench_world_01_node_alloc) {
+	constexpr std::size_t burst = 256;
+	std::array<Node3D*, burst> objects {};
+
+	state.run("heap new/delete Node3D", burst, [&] {
+		for (auto& obj : objects) {
+			obj = new Node3D();
+		}
+		for (auto* obj : objects) {
+			delete obj;
+		}
+		bench::doNotOptimize(objects);
+	});
+
+	state.run("pool Node3D", burst, [&] {
+		for (auto& obj : objects) {
+			obj = _detail::poolNew<Node3D>();
+		}
+		for (auto* obj : objects) {
+			_detail::poolDelete(obj);
+		}
+		bench::doNotOptimize(objects);
+	});
+
+	state.run("pool Node3D, bulk release", burst, [&] {
+		for (auto& obj : objects) {
+			obj = _detail::poolNew<Node3D>();
+		}
+		_detail::NodePool::BulkRelease bulk;
+		for (auto* obj : objects) {
+			_detail::poolDelete(obj);
+		}
+		bench::doNotOptimize(objects);
+	});
+
+	// Full owner path: NodeRegistry lookup, pool, ControlBox slot, then freeNodes + reap
+	auto world = WorldTestAccess::createWorld();
+	std::vector<Box<Node>> boxes;
+	std::vector<Node*> victims;
+	boxes.reserve(burst);
+	victims.reserve(burst);
+
+	state.run("owner allocate/free Node3D", burst, [&] {
+		for (std::size_t i = 0; i < burst; ++i) {
+			boxes.push_back(WorldTestAccess::allocateNode(*world, "toast::Node3D"));
+		}
+		for (auto& b : boxes) {
+			victims.push_back(&*b);
+		}
+		boxes.clear();
+		WorldTestAccess::freeNodes(*world, victims);
+		victims.clear();
+	});
+}
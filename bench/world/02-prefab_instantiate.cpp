@@ -0,0 +1,63 @@
+#include "../bench_registry.hpp"
+#include "toast/world/world_test_access.hpp"
+
+#include <string>
+#include <toast/assets/prefab.hpp>
+#include <toast/world/node_3d.hpp>
+#include <vector>
+
+using namespace toast;
+using WorldTestAccess = toast::_detail::WorldTestAccess;
+
+namespace {
+
+// Root plus a flat row of transformed children, the usual shape of a prop or enemy prefab
+auto makeSource(std::size_t children) -> assets::Prefab {
+	assets::Prefab source;
+	const auto root_uid = UID(UID::fromString("BenchRoot00"));
+
+	assets::Prefab::BasicNode root {.name = "bench_root", .type = "toast::Node3D"};
+	root.fields.push_back({"m_uid", FieldType::uid_t, false, root_uid});
+	root.fields.push_back({"m_local_enabled", FieldType::bool_t, false, true});
+	source.nodes.push_back(std::move(root));
+
+	for (std::size_t i = 0; i < children; ++i) {
+		assets::Prefab::BasicNode child {.name = "bench_child_" + std::to_string(i), .type = "toast::Node3D"};
+		child.fields.push_back({"m_uid", FieldType::uid_t, false, UID(UID::fromString("BenchKid" + std::to_string(100 + i)))});
+		child.fields.push_back({"m_parent", FieldType::uid_t, false, root_uid});
+		child.fields.push_back({"m_local_enabled", FieldType::bool_t, false, true});
+		child.fields.push_back({"position", FieldType::vec3_t, false, glm::vec3 {static_cast<float>(i), 0.0f, 0.0f}});
+		child.fields.push_back({"rotation", FieldType::quaternion_t, false, glm::quat {1.0f, 0.0f, 0.0f, 0.0f}});
+		child.fields.push_back({"scale", FieldType::vec3_t, false, glm::vec3 {1.0f}});
+		source.nodes.push_back(std::move(child));
+	}
+	return source;
+}
+
+}
+
+TOAST_BENCH_NAMED("world", "world/02-prefab_instantiate", bench_world_02_prefab_instantiate) {
+	constexpr std::size_t children = 31;
+	assets::Prefab source = makeSource(children);
+	assets::Handle<assets::Prefab> handle(&source, UID::fromString("BenchSource"), "");
+	auto world = WorldTestAccess::createWorld();
+
+	std::vector<Node*> victims;
+	auto instance = [&](bool use_plans) {
+		INodeOwner::InstantiateContext context;
+		context.resolver = [](UID) { return assets::Handle<assets::Prefab> {}; };
+		context.use_plans = use_plans;
+
+		Box<Node> root = WorldTestAccess::instantiate(*world, handle, context);
+		victims.push_back(&*root);
+		for (const auto& child : WorldTestAccess::childrenOf(*root)) {
+			victims.push_back(const_cast<Node*>(&*child));
+		}
+		root = {};
+		WorldTestAccess::freeNodes(*world, victims);
+		victims.clear();
+	};
+
+	state.run("name matching", children + 1, [&] { instance(false); });
+	state.run("compiled plan", children + 1, [&] { instance(true); });
+}
@@ -0,0 +1,98 @@
+#include "../bench_registry.hpp"
+#include "toast/world/world_test_access.hpp"
+
+#include <string>
+#include <toast/assets/prefab.hpp>
+#include <toast/world/node_3d.hpp>
+#include <vector>
+
+using namespace toast;
+using WorldTestAccess = toast::_detail::WorldTestAccess;
+
+namespace {
+
+constexpr uint64_t bench_prop_asset = 0xBE4C;
+constexpr size_t prop_nodes = 16;
+constexpr size_t level_props = 2500;
+constexpr size_t level_loose = 10000;
+
+// Small transformed hierarchy, the kind of prop a level places thousands of times
+auto makeProp() -> assets::Prefab {
+	assets::Prefab prop;
+	for (size_t i = 0; i < prop_nodes; ++i) {
+		assets::Prefab::BasicNode node {.name = "part_" + std::to_string(i), .type = "toast::Node3D"};
+		node.fields.push_back({"m_uid", FieldType::uid_t, false, UID(0x100 + i)});
+		if (i > 0) {
+			node.fields.push_back({"m_parent", FieldType::uid_t, false, UID(0x100 + (i - 1) / 4)});
+		}
+		node.fields.push_back({"m_local_enabled", FieldType::bool_t, false, true});
+		node.fields.push_back({"position", FieldType::vec3_t, false, glm::vec3 {static_cast<float>(i), 0.0f, 0.0f}});
+		node.fields.push_back({"scale", FieldType::vec3_t, false, glm::vec3 {1.0f}});
+		prop.nodes.push_back(std::move(node));
+	}
+	return prop;
+}
+
+// ~50k nodes: prop instances plus loose transforms directly under the level root
+auto makeLevel() -> assets::Prefab {
+	assets::Prefab level;
+	const UID root_uid {0x1000000};
+
+	assets::Prefab::BasicNode root {.name = "bench_level", .type = "toast::Node"};
+	root.fields.push_back({"m_uid", FieldType::uid_t, false, root_uid});
+	level.nodes.push_back(std::move(root));
+
+	for (size_t i = 0; i < level_props; ++i) {
+		assets::Prefab::BasicNode placement {.name = "prop_" + std::to_string(i), .type = "toast::Node3D"};
+		placement.fields.push_back({"m_uid", FieldType::uid_t, false, UID(0x2000000 + i)});
+		placement.fields.push_back({"m_parent", FieldType::uid_t, false, root_uid});
+		placement.fields.push_back({"m_source_prefab", FieldType::uid_t, false, UID(bench_prop_asset)});
+		placement.fields.push_back({"position", FieldType::vec3_t, false, glm::vec3 {0.0f, static_cast<float>(i), 0.0f}});
+		level.nodes.push_back(std::move(placement));
+	}
+
+	for (size_t i = 0; i < level_loose; ++i) {
+		assets::Prefab::BasicNode node {.name = "loose_" + std::to_string(i), .type = "toast::Node3D"};
+		node.fields.push_back({"m_uid", FieldType::uid_t, false, UID(0x3000000 + i)});
+		node.fields.push_back({"m_parent", FieldType::uid_t, false, root_uid});
+		node.fields.push_back({"position", FieldType::vec3_t, false, glm::vec3 {static_cast<float>(i), 0.0f, 1.0f}});
+		level.nodes.push_back(std::move(node));
+	}
+	return level;
+}
+
+}
+
+TOAST_BENCH_NAMED("world", "world/03-parallel_instantiate", bench_world_03_parallel_instantiate) {
+	assets::Prefab prop = makeProp();
+	assets::Prefab level = makeLevel();
+	assets::Handle<assets::Prefab> handle(&level, UID(0xBE4D), "");
+	auto world = WorldTestAccess::createWorld();
+
+	constexpr size_t level_nodes = 1 + level_props * prop_nodes + level_loose;
+	std::vector<Node*> victims;
+	victims.reserve(level_nodes);
+
+	auto load = [&](bool parallel) {
+		INodeOwner::InstantiateContext context;
+		context.resolver = [&prop](UID uid) {
+			return uid.data() == bench_prop_asset ? assets::Handle<assets::Prefab>(&prop, uid, "") : assets::Handle<assets::Prefab> {};
+		};
+		context.parallel = parallel;
+
+		Box<Node> root = WorldTestAccess::instantiate(*world, handle, context);
+		auto collect = [&victims](this auto&& self, Node& node) -> void {
+			victims.push_back(&node);
+			for (const auto& child : WorldTestAccess::childrenOf(node)) {
+				self(const_cast<Node&>(*child));
+			}
+		};
+		collect(*root);
+		root = {};
+		WorldTestAccess::freeNodes(*world, victims);
+		victims.clear();
+	};
+
+	state.runCapped("serial", level_nodes, 10, [&] { load(false); });
+	state.runCapped("thread pool", level_nodes, 10, [&] { load(true); });
+}
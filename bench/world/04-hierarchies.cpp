@@ -0,0 +1,32 @@
+#include "../bench_registry.hpp"
+#include "../scene_generators.hpp"
+
+#include <string>
+
+using namespace toast;
+using WorldTestAccess = toast::_detail::WorldTestAccess;
+
+// Transform propagation and a full world tick over the two extreme tree shapes
+TOAST_BENCH_NAMED("world", "world/04-hierarchies", bench_world_04_hierarchies) {
+	struct Shape {
+		const char* name;
+		assets::Prefab prefab;
+	};
+	Shape shapes[] = {
+		{"deep 512", bench::scenes::deepPrefab(512)},
+		{"wide 10k", bench::scenes::widePrefab(10000)},
+	};
+
+	for (Shape& shape : shapes) {
+		auto world = WorldTestAccess::createWorld();
+		Box<Node> root = bench::scenes::instantiate(*world, shape.prefab);
+		WorldTestAccess::computeDependencyGraph(*world);
+		const std::size_t nodes = shape.prefab.nodes.size();
+
+		state.runCapped(std::string("updateTransforms, ") + shape.name, nodes, 2000, [&] {
+			WorldTestAccess::updateTransforms(*root);
+		});
+
+		state.runCapped(std::string("World::tick, ") + shape.name, nodes, 2000, [&] { world->tick(); });
+	}
+}
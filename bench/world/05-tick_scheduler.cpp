@@ -0,0 +1,28 @@
+#include "../bench_registry.hpp"
+#include "../scene_generators.hpp"
+
+#include <string>
+
+using namespace toast;
+using WorldTestAccess = toast::_detail::WorldTestAccess;
+
+// Schedule building and wave dispatch for dependency-heavy and scripted node sets
+TOAST_BENCH_NAMED("world", "world/05-tick_scheduler", bench_world_05_tick_scheduler) {
+	for (const std::size_t count : {1000uz, 10000uz}) {
+		const std::string suffix = " (" + std::to_string(count / 1000) + "k nodes, 3 edges each)";
+		auto world = WorldTestAccess::createWorld();
+		auto nodes = bench::scenes::dependencyWeb(*world, count, 3);
+
+		state.runCapped("compute schedule" + suffix, count, 50, [&] { WorldTestAccess::computeDependencyGraph(*world); });
+		state.runCapped("dispatch tick phases" + suffix, count, 2000, [&] { world->tick(); });
+	}
+
+	// Lua ticks go through the same waves, but every call crosses into a script runtime
+	{
+		constexpr std::size_t count = 1000;
+		auto world = WorldTestAccess::createWorld();
+		auto nodes = bench::scenes::scriptedNodes(*world, count);
+		WorldTestAccess::computeDependencyGraph(*world);
+		state.runCapped("dispatch scripted tick (1k nodes)", count, 500, [&] { world->tick(); });
+	}
+}
@@ -0,0 +1,110 @@
+#include "../bench_registry.hpp"
+
+#include <cmath>
+#include <glm/gtc/matrix_transform.hpp>
+#include <random>
+#include <string>
+#include <toast/world/volume_index.hpp>
+#include <vector>
+
+using namespace toast;
+
+namespace {
+
+struct BenchVolume {
+	glm::mat4 world;
+	glm::mat4 inverse;    ///< what Volume caches between transform changes
+	float blend;
+};
+
+// Reverb-zone sized boxes scattered over a level, each blending over a couple of metres
+auto makeVolumes(size_t count) -> std::vector<BenchVolume> {
+	std::mt19937 rng(42);
+	const float side = std::sqrt(static_cast<float>(count)) * 20.0f;
+	std::uniform_real_distribution<float> coord(0.0f, side);
+	std::uniform_real_distribution<float> size(4.0f, 16.0f);
+	std::uniform_real_distribution<float> angle(0.0f, 6.28f);
+
+	std::vector<BenchVolume> volumes(count);
+	for (BenchVolume& volume : volumes) {
+		volume.world = glm::translate(glm::mat4(1.0f), {coord(rng), coord(rng), coord(rng) * 0.05f});
+		volume.world = glm::rotate(volume.world, angle(rng), {0.0f, 0.0f, 1.0f});
+		volume.world = glm::scale(volume.world, {size(rng), size(rng), size(rng) * 0.5f});
+		volume.inverse = glm::inverse(volume.world);
+		volume.blend = 2.0f;
+	}
+	return volumes;
+}
+
+// Volume::calculateWeight for a non-global volume of weight 1
+auto weightOf(const BenchVolume& volume, const glm::mat4& inverse, glm::vec3 point) -> float {
+	const glm::vec3 local = inverse * glm::vec4(point, 1.0f);
+	const glm::vec3 closest = volume.world * glm::vec4(glm::clamp(local, glm::vec3(-0.5f), glm::vec3(0.5f)), 1.0f);
+	const float dist = glm::distance(point, closest);
+	return dist <= 0.0f ? 1.0f : (dist >= volume.blend ? 0.0f : 1.0f - dist / volume.blend);
+}
+
+}
+
+// Volume weights for a handful of listeners over levels of hundreds to thousands of volumes
+TOAST_BENCH_NAMED("world", "world/06-volumes", bench_world_06_volumes) {
+	constexpr size_t targets = 64;
+
+	for (const size_t count : {100uz, 500uz, 2000uz}) {
+		const std::string suffix = " (" + std::to_string(count) + " volumes)";
+		const std::vector<BenchVolume> volumes = makeVolumes(count);
+
+		std::mt19937 rng(7);
+		const float side = std::sqrt(static_cast<float>(count)) * 20.0f;
+		std::uniform_real_distribution<float> coord(0.0f, side);
+		std::vector<glm::vec3> points(targets);
+		for (glm::vec3& point : points) {
+			point = {coord(rng), coord(rng), coord(rng) * 0.05f};
+		}
+
+		// What every AudioVolume did before: each volume inverts its transform for each listener
+		state.run("brute force" + suffix, targets, [&] {
+			float total = 0.0f;
+			for (const glm::vec3& point : points) {
+				for (const BenchVolume& volume : volumes) {
+					total += weightOf(volume, glm::inverse(volume.world), point);
+				}
+			}
+			toast::bench::doNotOptimize(total);
+		});
+
+		state.run("brute force, cached inverse" + suffix, targets, [&] {
+			float total = 0.0f;
+			for (const glm::vec3& point : points) {
+				for (const BenchVolume& volume : volumes) {
+					total += weightOf(volume, volume.inverse, point);
+				}
+			}
+			toast::bench::doNotOptimize(total);
+		});
+
+		std::vector<physics::Aabb> bounds(count);
+		for (size_t i = 0; i < count; ++i) {
+			bounds[i] = VolumeIndex::worldBounds(volumes[i].world, volumes[i].blend);
+		}
+		BoundsTree tree;
+		state.runCapped("index build" + suffix, count, 200, [&] {
+			tree.build(bounds);
+			toast::bench::doNotOptimize(tree.size());
+		});
+
+		tree.build(bounds);
+		std::vector<uint32_t> hits;
+		state.run("index query" + suffix, targets, [&] {
+			float total = 0.0f;
+			for (const glm::vec3& point : points) {
+				hits.clear();
+				tree.query(point, hits);
+				for (const uint32_t hit : hits) {
+					total += weightOf(volumes[hit], volumes[hit].inverse, point);
+				}
+			}
+			toast::bench::doNotOptimize(total);
+		});
+	}
+}
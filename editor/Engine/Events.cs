@@ -1,16 +1,21 @@
 using System;
-using System.Collections.Concurrent;
+using System.Collections.Generic;
+using System.Linq;
 using System.Runtime.CompilerServices;
 using System.Runtime.InteropServices;
-using System.Threading;
 using Google.Protobuf;
 
 namespace editor.Engine;
 
 public static partial class Events {
-	private static readonly ConcurrentDictionary<ulong, Subscription> Subscribers = new();
+	private static readonly object Lock = new();
+
+	// Handlers by native type id, highest priority first; replaced whole on every change so the
+	// batch callback can read it without taking the lock
+	private static volatile Dictionary<uint, Subscription[]> m_byType = new();
 
 	private static ulong m_nextId;
+	private static bool m_batchCallbackSet;
 
 	public static unsafe int Send<T>(T message) where T : IMessage<T> {
 		var data = message.ToByteArray();
@@ -19,70 +24,105 @@ public static partial class Events {
 		}
 	}
 
-	internal static uint CreateListener() {
-		return events_listener_create();
-	}
-
-	internal static void DestroyListener(uint handle) {
-		events_listener_destroy(handle);
-	}
-
-	internal static void ForgetSubscription(ulong id) {
-		Subscribers.TryRemove(id, out _);
-	}
-
-	internal static unsafe ulong ListenerSubscribe<T>(uint handle, Func<T, bool> handler, sbyte priority)
+	internal static unsafe ulong Subscribe<T>(Func<T, bool> handler, sbyte priority)
 		where T : IMessage<T>, new() {
 		var d = new T().Descriptor;
-		// register in Subscribers before calling into the engine so there's no window
-		// where a callback fires and finds nothing to dispatch to
-		var id = Interlocked.Increment(ref m_nextId);
-		Subscribers[id] = new Subscription(d.Parser, msg => handler((T)msg));
-		if (events_listener_subscribe(handle, d.FullName, &OnNativeEvent, (void*)id, priority) != 0) {
-			Subscribers.TryRemove(id, out _);
-			return 0;
+		lock (Lock) {
+			if (!m_batchCallbackSet) {
+				events_batch_set_callback(&OnNativeBatch, null);
+				m_batchCallbackSet = true;
+			}
+
+			// the engine serializes each event once per frame, whatever the number of handlers here
+			var type = events_batch_subscribe(d.FullName);
+			if (type < 0) return 0;
+
+			var id = ++m_nextId;
+			var subscription = new Subscription(id, d.FullName, priority, d.Parser, msg => handler((T)msg));
+			var byType = new Dictionary<uint, Subscription[]>(m_byType);
+			byType[(uint)type] = byType.TryGetValue((uint)type, out var existing)
+				? existing.Append(subscription).OrderByDescending(s => s.Priority).ToArray()
+				: [subscription];
+			m_byType = byType;
+			return id;
 		}
-
-		return id;
 	}
 
-	internal static void ListenerUnsubscribe(uint handle, string name, ulong id) {
-		events_listener_unsubscribe(handle, name);
-		Subscribers.TryRemove(id, out _);
+	internal static void Unsubscribe(ulong id) {
+		lock (Lock) {
+			foreach (var (type, subscriptions) in m_byType) {
+				var subscription = Array.Find(subscriptions, s => s.Id == id);
+				if (subscription is null) continue;
+
+				var byType = new Dictionary<uint, Subscription[]>(m_byType);
+				var remaining = subscriptions.Where(s => s.Id != id).ToArray();
+				if (remaining.Length > 0) byType[type] = remaining;
+				else byType.Remove(type);
+				m_byType = byType;
+				events_batch_unsubscribe(subscription.Name);
+				return;
+			}
+		}
 	}
 
-	// called from native code -> the id is passed back as void* userData
-	// we cast it to ulong and look up the managed handler in Subscribers
+	// called from native code once per pollEvents() with every subscribed event of that poll;
+	// each record is parsed once and shared by all of its handlers, then the batch is handed back
 	[UnmanagedCallersOnly(CallConvs = [typeof(CallConvCdecl)])]
-	private static unsafe int OnNativeEvent(byte* name, byte* data, uint size, void* userData) {
+	private static unsafe void OnNativeBatch(EventBatch* batch, void* userData) {
 		try {
-			var id = (ulong)userData;
-			if (!Subscribers.TryGetValue(id, out var subscription)) return 0;
-
-			var span = new ReadOnlySpan<byte>(data, (int)size);
-			var message = subscription.Parser.ParseFrom(span);
-			return subscription.Handler(message) ? 1 : 0;
+			var byType = m_byType;
+			for (uint i = 0; i < batch->Count; i++) {
+				var record = batch->Records[i];
+				if (!byType.TryGetValue(record.Type, out var subscriptions)) continue;
+
+				var span = new ReadOnlySpan<byte>(batch->Data + record.Offset, (int)record.Size);
+				var message = subscriptions[0].Parser.ParseFrom(span);
+				foreach (var subscription in subscriptions) {
+					try {
+						if (subscription.Handler(message)) break;
+					} catch {
+						// one failing handler shouldn't starve the others
+					}
+				}
+			}
 		} catch {
-			return 0;
+			// never let an exception cross back into native code
+		} finally {
+			events_batch_release(batch->Fence);
 		}
 	}
 
 	[LibraryImport("toast_engine")]
-	private static partial uint events_listener_create();
-
-	[LibraryImport("toast_engine")]
-	private static partial void events_listener_destroy(uint handle);
+	private static unsafe partial void events_batch_set_callback(
+		delegate* unmanaged[Cdecl]<EventBatch*, void*, void> callback, void* userData);
 
 	[LibraryImport("toast_engine", StringMarshalling = StringMarshalling.Utf8)]
-	private static unsafe partial int events_listener_subscribe(
-		uint handle, string name, delegate* unmanaged[Cdecl]<byte*, byte*, uint, void*, int> callback, void* user_data,
-		sbyte priority);
+	private static partial int events_batch_subscribe(string name);
 
 	[LibraryImport("toast_engine", StringMarshalling = StringMarshalling.Utf8)]
-	private static partial void events_listener_unsubscribe(uint handle, string name);
+	private static partial void events_batch_unsubscribe(string name);
+
+	[LibraryImport("toast_engine")]
+	private static partial void events_batch_release(ulong fence);
 
 	[LibraryImport("toast_engine", StringMarshalling = StringMarshalling.Utf8)]
 	private static unsafe partial int events_send(string name, byte* data, uint size);
 
-	private sealed record Subscription(MessageParser Parser, Func<IMessage, bool> Handler);
+	[StructLayout(LayoutKind.Sequential)]
+	private struct EventRecord {
+		public uint Type;
+		public uint Offset;
+		public uint Size;
+	}
+
+	[StructLayout(LayoutKind.Sequential)]
+	private unsafe struct EventBatch {
+		public ulong Fence;
+		public EventRecord* Records;
+		public uint Count;
+		public byte* Data;
+		public ulong Size;
+	}
+
+	private sealed record Subscription(ulong Id, string Name, sbyte Priority, MessageParser Parser, Func<IMessage, bool> Handler);
 }
@@ -5,20 +5,16 @@ using Google.Protobuf;
 
 namespace editor.Engine;
 
+// handlers run once per engine frame, from the batch the engine hands over at the end of pollEvents();
+// returning true stops the remaining C# handlers of that event, native listeners have already run
 public sealed class Listener : IDisposable {
-	private readonly uint m_handle;
 	private readonly Dictionary<string, ulong> m_subs = new();
 	private bool m_disposed;
 
-	public Listener() {
-		m_handle = Events.CreateListener();
-	}
-
 	public void Dispose() {
 		if (m_disposed) return;
 		m_disposed = true;
-		Events.DestroyListener(m_handle);
-		foreach (var id in m_subs.Values) Events.ForgetSubscription(id);
+		foreach (var id in m_subs.Values) Events.Unsubscribe(id);
 		m_subs.Clear();
 		GC.SuppressFinalize(this);
 	}
@@ -30,7 +26,7 @@ public sealed class Listener : IDisposable {
 	public void Subscribe<T>(Func<T, bool> handler, sbyte priority = 0) where T : IMessage<T>, new() {
 		var name = new T().Descriptor.FullName;
 		if (m_subs.ContainsKey(name)) Unsubscribe<T>(); // replace existing sub for same type
-		var id = Events.ListenerSubscribe(m_handle, handler, priority);
+		var id = Events.Subscribe(handler, priority);
 		if (id != 0) m_subs[name] = id;
 	}
 
@@ -52,6 +48,6 @@ public sealed class Listener : IDisposable {
 
 	public void Unsubscribe<T>() where T : IMessage<T>, new() {
 		var name = new T().Descriptor.FullName;
-		if (m_subs.Remove(name, out var id)) Events.ListenerUnsubscribe(m_handle, name, id);
+		if (m_subs.Remove(name, out var id)) Events.Unsubscribe(id);
 	}
 }
@@ -31,6 +31,13 @@ public static partial class Log {
 		Dispatch(toast_critical, message, Path.GetFileName(fileName), (uint)lineNumber);
 	}
 
+	/// Drops messages below severity (0 trace .. 4 critical) from sink, or from every sink without its own level
+	public static void SetLevel(byte severity, string? sink = null) {
+		try {
+			toast_log_set_level(sink, severity);
+		} catch (DllNotFoundException) { }
+	}
+
 	// Fallback to the console if toast-engine is not loaded
 	private static void Dispatch(
 		Action<string, string, string, uint> sink, string message, string fileName, uint lineNumber) {
@@ -56,4 +63,7 @@ public static partial class Log {
 
 	[LibraryImport("toast_engine", StringMarshalling = StringMarshalling.Utf8)]
 	private static partial void toast_critical(string sink, string message, string fileName, uint lineNumber);
+
+	[LibraryImport("toast_engine", StringMarshalling = StringMarshalling.Utf8)]
+	private static partial void toast_log_set_level(string? sink, byte severity);
 }
@@ -5,6 +5,7 @@ using System.ComponentModel;
 using System.IO;
 using System.Linq;
 using System.Runtime.CompilerServices;
+using System.Text;
 using System.Threading.Tasks;
 using Avalonia;
 using Avalonia.Media.Imaging;
@@ -23,6 +24,8 @@ namespace editor.Workspace;
 public class HierarchyElement : INotifyPropertyChanged {
 	private string m_draftName = "";
 
+	private bool m_enabled;
+
 	private bool m_isDropTarget;
 
 	private bool m_isExpanded = true;
@@ -31,37 +34,51 @@ public class HierarchyElement : INotifyPropertyChanged {
 
 	private bool m_isSelected;
 
+	private string m_name;
+
 	public HierarchyElement(Proto.Events.HierarchyElement e, HierarchyViewModel owner, HierarchyElement? parent = null) {
 		Owner = owner;
 		Parent = parent;
-		Name = e.Name;
+		m_name = e.Name;
 		Uid = e.Uid;
 		Type = e.Type;
 		IsPrefab = e.IsPrefab;
-		Enabled = e.Enabled;
+		m_enabled = e.Enabled;
 		m_isExpanded = !owner.IsCollapsed(e.Uid); // restore persisted fold state
-		Color = ReflectionDatabase.ResolveColor(e.Type);
 		foreach (var c in e.Children) {
 			if (c is null) continue;
 			Children.Add(new HierarchyElement(c, owner, this));
 		}
 
-		try {
-			var iconName = ReflectionDatabase.ResolveIcon(e.Type);
-			Icon = new Bitmap(AssetLoader.Open(new Uri($"avares://editor/Resources/node_icons/1.5x/{iconName}.png")));
-			SmallIcon = new Bitmap(AssetLoader.Open(new Uri($"avares://editor/Resources/node_icons/1x/{iconName}.png")));
-			LargeIcon = new Bitmap(AssetLoader.Open(new Uri($"avares://editor/Resources/node_icons/2x/{iconName}.png")));
-		} catch (Exception ex) {
-			Log.Warn($"Failed to open icon for {e.Type}: {ex.Message}");
-		}
-
+		LoadTypeVisuals();
 		foreach (var child in Children) FilteredChildren.Add(child);
 	}
 
-	public string Name { get; set; }
+	// a node the engine inserted after the last snapshot; it has no children yet
+	public HierarchyElement(HierarchyChange c, HierarchyViewModel owner) {
+		Owner = owner;
+		m_name = c.Name;
+		Uid = c.Uid;
+		Type = c.Type;
+		IsPrefab = c.IsPrefab;
+		m_enabled = c.Enabled;
+		m_isExpanded = !owner.IsCollapsed(c.Uid);
+		LoadTypeVisuals();
+	}
+
+	public string Name {
+		get => m_name;
+		set => SetField(ref m_name, value);
+	}
+
 	public string Uid { get; set; }
 	public string Type { get; set; }
-	public bool Enabled { get; set; }
+
+	public bool Enabled {
+		get => m_enabled;
+		set => SetField(ref m_enabled, value);
+	}
+
 	public Bitmap? Icon { get; set; }      // On avares://editor/Resources/node_icons/1.5x/<Icon Attribute>.png
 	public Bitmap? SmallIcon { get; set; } // On avares://editor/Resources/node_icons/1x/<Icon Attribute>.png
 	public Bitmap? LargeIcon { get; set; } // On avares://editor/Resources/node_icons/2x/<Icon Attribute>.png
@@ -72,7 +89,7 @@ public class HierarchyElement : INotifyPropertyChanged {
 	public ObservableCollection<HierarchyElement> FilteredChildren { get; } = [];
 
 	public HierarchyViewModel Owner { get; }
-	public HierarchyElement? Parent { get; }
+	public HierarchyElement? Parent { get; set; }
 
 	public bool IsInsidePrefab => Parent?.IsPrefab == true || Parent?.IsInsidePrefab == true;
 	public bool CanAddChildren => !IsPrefab && !IsInsidePrefab;
@@ -121,12 +138,25 @@ public class HierarchyElement : INotifyPropertyChanged {
 
 	public event PropertyChangedEventHandler? PropertyChanged;
 
-	private void SetField(ref bool field, bool value, [CallerMemberName] string? name = null) {
-		if (field == value) return;
+	private void SetField<T>(ref T field, T value, [CallerMemberName] string? name = null) {
+		if (EqualityComparer<T>.Default.Equals(field, value)) return;
 		field = value;
 		PropertyChanged?.Invoke(this, new PropertyChangedEventArgs(name));
 	}
 
+	// color and icons follow the type; reloaded when a diff changes it
+	public void LoadTypeVisuals() {
+		Color = ReflectionDatabase.ResolveColor(Type);
+		try {
+			var iconName = ReflectionDatabase.ResolveIcon(Type);
+			Icon = new Bitmap(AssetLoader.Open(new Uri($"avares://editor/Resources/node_icons/1.5x/{iconName}.png")));
+			SmallIcon = new Bitmap(AssetLoader.Open(new Uri($"avares://editor/Resources/node_icons/1x/{iconName}.png")));
+			LargeIcon = new Bitmap(AssetLoader.Open(new Uri($"avares://editor/Resources/node_icons/2x/{iconName}.png")));
+		} catch (Exception ex) {
+			Log.Warn($"Failed to open icon for {Type}: {ex.Message}");
+		}
+	}
+
 	public bool ApplyFilter(string query) {
 		FilteredChildren.Clear();
 
@@ -151,6 +181,7 @@ public partial class HierarchyViewModel : Tool {
 	// "end" -> engine inserts the node after the last sibling
 	private const string MoveToEnd = "end";
 
+	private readonly Dictionary<string, HierarchyElement> m_byUid = new();
 	private readonly Listener m_listener;
 	private bool m_clipboardIsCut;
 
@@ -158,6 +189,7 @@ public partial class HierarchyViewModel : Tool {
 
 	[ObservableProperty] private string m_filterText = "";
 
+	private ulong m_hierarchySequence;
 	private HierarchyState? m_hierState;
 
 	private bool m_pendingRenameAfterUpdate;
@@ -177,40 +209,163 @@ public partial class HierarchyViewModel : Tool {
 			SaveAsCommand.NotifyCanExecuteChanged();
 		};
 
-		// engine sends UpdateHierarchyData after every change (create, delete, move, rename...)
+		// engine sends a full UpdateHierarchyData when we start showing a workspace or ask for a resync,
+		// and a HierarchyDiff after every change (create, delete, move, rename...) from then on
 		// we post to the UI thread because engine callbacks come on the native tick thread
 		m_listener.Subscribe<UpdateHierarchyData>(e => {
 			Dispatcher.UIThread.Post(() => {
 				var prevUid = SelectedNode?.Uid;
 				Root.Clear();
+				m_byUid.Clear();
 				if (!e.IsEmpty) {
 					m_hierState = HierarchyState.Load(e.Root.Uid);
 					Root.Add(new HierarchyElement(e.Root, this) { IsRoot = true });
+					Index(Root[0]);
+				}
+
+				m_hierarchySequence = e.Sequence;
+				if (e.Checksum != 0 && Checksum() != e.Checksum)
+					Log.Warn("Hierarchy snapshot checksum doesn't match the engine's; the two checksums have drifted apart");
+				TreeChanged(prevUid);
+			});
+		});
+
+		m_listener.Subscribe<HierarchyDiff>(e => {
+			Dispatcher.UIThread.Post(() => {
+				// a batch went missing; replaying the rest on top would only drift further
+				if (e.Sequence != m_hierarchySequence + 1) {
+					Events.Send(new RequestHierarchySnapshot());
+					return;
 				}
 
-				// restore selection after the tree rebuilds so editing a node doesnt lose focus
-				SelectedNode = prevUid is null ? null : Find(Root, prevUid);
-				if (Root.Count > 0) ActiveWorkspace?.SetRootNode(Root[0].Uid);
-				ApplyFilterToRoot();
-				RebuildRows();
-				HierarchyChanged?.Invoke();
-
-				if (m_pendingRenameAfterUpdate && m_rowUidsSnapshot is not null) {
-					m_pendingRenameAfterUpdate = false;
-					var oldUids = m_rowUidsSnapshot;
-					m_rowUidsSnapshot = null;
-					var newNode = Rows.FirstOrDefault(r => !oldUids.Contains(r.Uid) && !r.IsRoot);
-					if (newNode is not null) {
-						SelectedNode = newNode;
-						newNode.DraftName = newNode.Name;
-						newNode.IsRenaming = true;
-						RenameStarted?.Invoke(newNode);
-					}
+				var prevUid = SelectedNode?.Uid;
+				foreach (var change in e.Changes) ApplyChange(change);
+				m_hierarchySequence = e.Sequence;
+				if (e.Checksum != 0 && Checksum() != e.Checksum) {
+					Log.Warn("Hierarchy out of sync with the engine, asking for a snapshot");
+					Events.Send(new RequestHierarchySnapshot());
 				}
+
+				TreeChanged(prevUid);
 			});
 		});
 	}
 
+	private void TreeChanged(string? prevUid) {
+		// restore selection after the tree rebuilds so editing a node doesnt lose focus
+		SelectedNode = prevUid is null ? null : m_byUid.GetValueOrDefault(prevUid);
+		if (Root.Count > 0) ActiveWorkspace?.SetRootNode(Root[0].Uid);
+		ApplyFilterToRoot();
+		RebuildRows();
+		HierarchyChanged?.Invoke();
+
+		if (m_pendingRenameAfterUpdate && m_rowUidsSnapshot is not null) {
+			m_pendingRenameAfterUpdate = false;
+			var oldUids = m_rowUidsSnapshot;
+			m_rowUidsSnapshot = null;
+			var newNode = Rows.FirstOrDefault(r => !oldUids.Contains(r.Uid) && !r.IsRoot);
+			if (newNode is not null) {
+				SelectedNode = newNode;
+				newNode.DraftName = newNode.Name;
+				newNode.IsRenaming = true;
+				RenameStarted?.Invoke(newNode);
+			}
+		}
+	}
+
+	private void Index(HierarchyElement node) {
+		m_byUid[node.Uid] = node;
+		foreach (var c in node.Children) Index(c);
+	}
+
+	// same rules as HierarchyMirror::apply on the engine side; changes naming unknown nodes are ignored
+	private void ApplyChange(HierarchyChange c) {
+		m_byUid.TryGetValue(c.Uid, out var node);
+		switch (c.Kind) {
+			case HierarchyChange.Types.Kind.Insert:
+				if (node is not null) return;
+				node = new HierarchyElement(c, this);
+				m_byUid[c.Uid] = node;
+				Attach(node, c.Parent, c.Index);
+				break;
+			case HierarchyChange.Types.Kind.Remove:
+				if (node is null) return;
+				Detach(node);
+				m_byUid.Remove(c.Uid);
+				break;
+			case HierarchyChange.Types.Kind.Move:
+				if (node is null) return;
+				Detach(node);
+				Attach(node, c.Parent, c.Index);
+				break;
+			case HierarchyChange.Types.Kind.Update:
+				if (node is null) return;
+				node.Name = c.Name;
+				node.Enabled = c.Enabled;
+				node.IsPrefab = c.IsPrefab;
+				if (node.Type != c.Type) {
+					node.Type = c.Type;
+					node.LoadTypeVisuals();
+				}
+
+				break;
+		}
+	}
+
+	private void Detach(HierarchyElement node) {
+		if (node.Parent is { } parent) parent.Children.Remove(node);
+		else if (Root.Count > 0 && ReferenceEquals(Root[0], node)) Root.Clear();
+		node.Parent = null;
+		node.IsRoot = false;
+	}
+
+	private void Attach(HierarchyElement node, string parentUid, uint index) {
+		if (parentUid.Length == 0) {
+			if (Root.Count == 0) m_hierState = HierarchyState.Load(node.Uid);
+			Root.Clear();
+			node.IsRoot = true;
+			Root.Add(node);
+			return;
+		}
+
+		if (!m_byUid.TryGetValue(parentUid, out var parent)) return;
+		node.Parent = parent;
+		parent.Children.Insert((int)Math.Min(index, (uint)parent.Children.Count), node);
+	}
+
+	// FNV-1a over the tree in preorder, byte for byte what HierarchyMirror::checksum hashes
+	private ulong Checksum() {
+		const ulong prime = 0x100000001b3;
+		var hash = 0xcbf29ce484222325;
+		if (Root.Count == 0) return hash;
+
+		void Byte(byte b) {
+			hash ^= b;
+			hash *= prime;
+		}
+
+		void Text(string s) {
+			foreach (var b in Encoding.UTF8.GetBytes(s)) Byte(b);
+			Byte(0);
+		}
+
+		var stack = new Stack<HierarchyElement>();
+		stack.Push(Root[0]);
+		while (stack.Count > 0) {
+			var node = stack.Pop();
+			Text(node.Uid);
+			Text(node.Name);
+			Text(node.Type);
+			Byte(node.Enabled ? (byte)1 : (byte)0);
+			Byte(node.IsPrefab ? (byte)1 : (byte)0);
+			var count = (uint)node.Children.Count;
+			for (var shift = 0; shift < 32; shift += 8) Byte((byte)(count >> shift));
+			for (var i = node.Children.Count - 1; i >= 0; i--) stack.Push(node.Children[i]);
+		}
+
+		return hash;
+	}
+
 	public static HierarchyViewModel? Current { get; private set; }
 
 	public ObservableCollection<HierarchyElement> Root { get; } = [];
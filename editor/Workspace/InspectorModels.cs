@@ -10,6 +10,7 @@ using CommunityToolkit.Mvvm.ComponentModel;
 using CommunityToolkit.Mvvm.Input;
 using editor.Components.Elements;
 using editor.Engine;
+using Proto.Events;
 
 namespace editor.Workspace;
 
@@ -118,6 +119,16 @@ public static class InspectorFormat {
 		return result;
 	}
 
+	public static string Text(InspectorValue value) {
+		return value.KindCase switch {
+			InspectorValue.KindOneofCase.Flag => value.Flag ? "true" : "false",
+			InspectorValue.KindOneofCase.Integer => value.Integer.ToString(CultureInfo.InvariantCulture),
+			InspectorValue.KindOneofCase.Number => Float((float)value.Number),
+			InspectorValue.KindOneofCase.Vector => string.Join(' ', value.Vector.Components.Select(Float)),
+			_ => value.Text
+		};
+	}
+
 	public static string Float(float v) {
 		return v.ToString("R", CultureInfo.InvariantCulture);
 	}
@@ -617,6 +628,45 @@ public partial class FieldVM : ObservableObject {
 		UpdateIsDefault(s);
 	}
 
+	// typed values from InspectorDelta; whatever the widget can't take as is goes through the text path
+	public void ApplyEngineValue(InspectorValue value) {
+		var applied = true;
+		m_suppress = true;
+		try {
+			switch (value.KindCase, Kind) {
+				case (InspectorValue.KindOneofCase.Flag, WidgetKind.Bool):
+					Bool = value.Flag;
+					break;
+				case (InspectorValue.KindOneofCase.Integer, WidgetKind.Int):
+					Int = (int)value.Integer;
+					break;
+				case (InspectorValue.KindOneofCase.Number, WidgetKind.Float):
+					Float = (float)value.Number;
+					break;
+				case (InspectorValue.KindOneofCase.Text, WidgetKind.String):
+					String = value.Text;
+					break;
+				case (InspectorValue.KindOneofCase.Vector,
+					WidgetKind.Vec2 or WidgetKind.Vec3 or WidgetKind.Vec4 or WidgetKind.Color3 or WidgetKind.Color4): {
+					var c = value.Vector.Components;
+					if (c.Count > 0) X = c[0];
+					if (c.Count > 1) Y = c[1];
+					if (c.Count > 2) Z = c[2];
+					if (c.Count > 3) W = c[3];
+					break;
+				}
+				default:
+					applied = false;
+					break;
+			}
+		} finally {
+			m_suppress = false;
+		}
+
+		if (applied) UpdateIsDefault(ToEngineString());
+		else ApplyEngineString(InspectorFormat.Text(value));
+	}
+
 	private string? EnumDefault(string? raw) {
 		if (string.IsNullOrWhiteSpace(raw)) return null;
 		if (InspectorFormat.NormalizeDefault(WidgetKind.Int, raw) is { } numeric &&
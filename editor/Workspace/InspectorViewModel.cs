@@ -19,11 +19,13 @@ public partial class InspectorViewModel : Tool {
 	private static readonly string[] Palette =
 		["Red", "Green", "Blue", "Magenta", "Orange", "Yellow", "Cyan", "Beige"];
 
+	private static readonly TimeSpan EditGrace = TimeSpan.FromMilliseconds(250);
 	private readonly Dictionary<string, FieldVM> m_fieldByParam = new();
 
 	// ReSharper disable once PrivateFieldCanBeConvertedToLocalVariable
 	private readonly Listener m_listener;
 	private readonly List<ClassCardVM> m_luaCards = [];
+	private readonly List<FieldVM?> m_streamFields = [];
 	private string? m_builtType;
 	private string? m_builtUid;
 	private uint m_builtLuaVersion;
@@ -250,18 +252,35 @@ public partial class InspectorViewModel : Tool {
 
 		m_listener = new Listener();
 
-		// engine streams the focused node's values at ~12fps; ignore frames for a different node
+		// engine sends every value once when a node gets focused (or we ask for it), then only what changes;
+		// ignore frames for a different node
 		m_listener.Subscribe<InspectorContent>(e => Dispatcher.UIThread.Post(() => {
 			if (!HasSelection || e.Uid != m_builtUid) return;
 
 			if (!IsEditingName) Name = e.Name;
 			SetEnabledSuppressed(e.Enabled);
 
+			m_streamFields.Clear();
 			foreach (var p in e.Parameters) {
-				if (!m_fieldByParam.TryGetValue(p.Name, out var vm)) continue;
-				// don't clobber a value the user is actively editing
-				if ((DateTime.UtcNow - vm.LastEdit).TotalMilliseconds < 250) continue;
-				vm.ApplyEngineString(p.Value);
+				var vm = m_fieldByParam.GetValueOrDefault(p.Name);
+				m_streamFields.Add(vm);
+				if (vm is null) continue;
+				var value = p.Value;
+				ApplyFromEngine(vm, () => vm.ApplyEngineString(value));
+			}
+		}));
+
+		// deltas address fields by their position in the last InspectorContent
+		m_listener.Subscribe<InspectorDelta>(e => Dispatcher.UIThread.Post(() => {
+			if (!HasSelection || e.Uid != m_builtUid) return;
+
+			if (!IsEditingName) Name = e.Name;
+			SetEnabledSuppressed(e.Enabled);
+
+			foreach (var f in e.Fields) {
+				if (f.Index >= m_streamFields.Count || m_streamFields[(int)f.Index] is not { } vm) continue;
+				var value = f.Value;
+				ApplyFromEngine(vm, () => vm.ApplyEngineValue(value));
 			}
 		}));
 
@@ -276,8 +295,8 @@ public partial class InspectorViewModel : Tool {
 
 			foreach (var f in e.Scripts.SelectMany(AllFields)) {
 				if (!m_fieldByParam.TryGetValue(f.Path, out var vm)) continue;
-				if ((DateTime.UtcNow - vm.LastEdit).TotalMilliseconds < 250) continue;
-				vm.ApplyEngineString(f.Value);
+				var value = f.Value;
+				ApplyFromEngine(vm, () => vm.ApplyEngineString(value));
 			}
 		}));
 
@@ -297,6 +316,21 @@ public partial class InspectorViewModel : Tool {
 		WorkspaceState.MarkModified();
 	}
 
+	// don't clobber a value the user is actively editing; the engine won't send it again unless it changes,
+	// so apply it once the edit has settled instead of dropping it
+	private static void ApplyFromEngine(FieldVM vm, Action apply) {
+		var sinceEdit = DateTime.UtcNow - vm.LastEdit;
+		if (sinceEdit >= EditGrace) {
+			apply();
+			return;
+		}
+
+		var edit = vm.LastEdit;
+		DispatcherTimer.RunOnce(() => {
+			if (vm.LastEdit == edit) apply();
+		}, EditGrace - sinceEdit);
+	}
+
 	private void SetEnabledSuppressed(bool value) {
 		m_suppressEnabled = true;
 		Enabled = value;
@@ -309,6 +343,7 @@ public partial class InspectorViewModel : Tool {
 				HasSelection = false;
 				Cards.Clear();
 				m_fieldByParam.Clear();
+				m_streamFields.Clear();
 				m_luaCards.Clear();
 				m_builtLuaVersion = 0;
 				m_builtUid = null;
@@ -359,7 +394,11 @@ public partial class InspectorViewModel : Tool {
 
 		m_builtUid = node.Uid;
 		m_builtType = node.Type;
+		m_streamFields.Clear();
 		ApplyFilter();
+
+		// the engine only streams changes, so a fresh set of cards needs every value again
+		Events.Send(new RequestInspectorContent());
 	}
 
 	private ClassCardVM BuildCard(NodeInfo info, ref int colorCounter) {
@@ -52,6 +52,14 @@ function Time.renderDelta() end
 ---@return integer
 function Time.frame() end
 
+---Number of fixed simulation steps run so far.
+---@return integer
+function Time.step() end
+
+---Length of one fixed simulation step; 0 when the simulation runs once per frame.
+---@return number
+function Time.fixedDelta() end
+
 ---Seconds since engine start.
 ---@return number
 function Time.uptime() end
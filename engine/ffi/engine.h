@@ -22,6 +22,12 @@ TOAST_C_API void toast_destroy(engine_t*) NOEXCEPT;    ///< Destroys the game en
 TOAST_C_API void toast_create_SDL_window(const char*) NOEXCEPT;
 TOAST_C_API void toast_create_avalonia_window() NOEXCEPT;
 
+/**
+ * @brief Runs without a window, with a null FMOD output and a CPU-only frame builder that still culls and sorts
+ * @note Must be called before toast_init(); replaces toast_create_*_window(). Frame timings are recorded
+ */
+TOAST_C_API void toast_set_headless(int headless) NOEXCEPT;
+
 typedef struct {
 	uint64_t uid;
 	const char* name;
@@ -63,6 +69,75 @@ TOAST_C_API void toast_mount_pack(const char* scheme, const char* pak_path) NOEX
  */
 TOAST_C_API void toast_start_game(void) NOEXCEPT;
 
+/**
+ * @brief Like toast_start_game() but loads the given scene instead of the init_scene
+ * @param scene 11-character UID string or asset URI
+ */
+TOAST_C_API void toast_start_scene(const char* scene) NOEXCEPT;
+
+/**
+ * @brief Records input, frame deltas and async load/spawn order to a binary replay file
+ * @return 1 if the file could be opened
+ * @note Call before toast_start_game()/toast_start_scene() so the start scene load is recorded
+ */
+TOAST_C_API int toast_replay_record(const char* path) NOEXCEPT;
+
+/**
+ * @brief Plays back a replay file recorded with toast_replay_record(); logs the first frame the world diverges on
+ * @return 1 if the file is a valid replay
+ */
+TOAST_C_API int toast_replay_play(const char* path) NOEXCEPT;
+
+/// @brief Ends the current recording (flushing it) or playback
+TOAST_C_API void toast_replay_stop(void) NOEXCEPT;
+
+/**
+ * @brief Writes the frames recorded by a headless run as CSV and logs p50/p99/max and drift per stage
+ * @return 1 on success, 0 if the engine isn't headless or the file couldn't be written
+ */
+TOAST_C_API int toast_write_frame_report(const char* path) NOEXCEPT;
+
+/// @brief Rolling statistics of one profiler zone over the last 300 frames
+typedef struct {
+	const char* name;
+	double last_ms;
+	double p50_ms;
+	double p99_ms;
+	double max_ms;
+	double budget_ms;        ///< 0 when the zone has no budget
+	uint64_t over_budget;    ///< frames this zone went over its budget
+} toast_profiler_zone_t;
+
+/**
+ * @brief Copies up to @p capacity zone statistics into @p out, the whole frame ("Frame") first
+ * @return the number of zones, which may be more than @p capacity
+ * @note Names stay valid until the next call from the same thread
+ */
+TOAST_C_API int toast_profiler_stats(toast_profiler_zone_t* out, int capacity) NOEXCEPT;
+
+/// @brief Sets a zone's budget in milliseconds, "Frame" for the whole frame; 0 removes it
+TOAST_C_API void toast_profiler_set_budget(const char* zone, double ms) NOEXCEPT;
+
+/// @return frames where the frame or any zone went over its budget
+TOAST_C_API uint64_t toast_profiler_over_budget_frames(void) NOEXCEPT;
+
+/// @brief Memory held by one engine subsystem
+typedef struct {
+	const char* name;
+	uint64_t current;             ///< bytes live
+	uint64_t peak;
+	uint64_t allocations;         ///< allocations ever made
+	uint64_t live_blocks;
+	double bytes_per_second;      ///< allocated over the last second
+	uint64_t budget;              ///< 0 when the subsystem has no budget
+} toast_memory_tag_t;
+
+/**
+ * @brief Copies up to @p capacity subsystem memory counters into @p out
+ * @return the number of subsystems, which may be more than @p capacity
+ */
+TOAST_C_API int toast_memory_stats(toast_memory_tag_t* out, int capacity) NOEXCEPT;
+
 /**
  * @brief Calls begin() on the active application layer
  * @note Used by hot-reload
@@ -30,6 +30,36 @@ TOAST_C_API void events_listener_unsubscribe(
 TOAST_C_API int events_send(
     const char* name, const uint8_t* data, uint32_t size
 ) NOEXCEPT;    ///< deserializes and enqueues an event from C#; @return 0 ok, -1 unknown type, -2 parse error
+
+/// one serialized event inside an event_batch
+typedef struct event_record {
+	uint32_t type;      ///< index of the event's protobuf name in events_name()
+	uint32_t offset;    ///< where its bytes start in event_batch::data
+	uint32_t size;
+} event_record;
+
+/// every subscribed event of one pollEvents() call; the memory stays valid until events_batch_release(fence)
+typedef struct event_batch {
+	uint64_t fence;
+	const event_record* records;
+	uint32_t count;
+	const uint8_t* data;
+	uint64_t size;
+} event_batch;
+
+/// callback fired once per pollEvents() that had subscribed events, with all of them
+typedef void (*event_batch_callback)(const event_batch* batch, void* user_data) NOEXCEPT;
+
+TOAST_C_API void events_batch_set_callback(
+    event_batch_callback callback, void* user_data
+) NOEXCEPT;    ///< replaces the batch callback; nullptr stops the batches
+TOAST_C_API int events_batch_subscribe(
+    const char* name
+) NOEXCEPT;    ///< starts batching this event type, counted per call; @return its type id in records, -1 if unknown
+TOAST_C_API void events_batch_unsubscribe(const char* name) NOEXCEPT;    ///< undoes one events_batch_subscribe()
+TOAST_C_API void events_batch_release(
+    uint64_t fence
+) NOEXCEPT;    ///< hands back the memory of every batch up to this fence; any thread
 TOAST_C_API uint32_t events_count(void) NOEXCEPT;    ///< number of registered exposed event types; used by C# to enumerate them
 TOAST_C_API const char* events_name(uint32_t index) NOEXCEPT;    ///< protobuf message name for the nth exposed event type
 
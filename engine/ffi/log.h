@@ -18,6 +18,9 @@ TOAST_C_API void toast_warn(const char* sink, const char* message, const char* f
 TOAST_C_API void toast_error(const char* sink, const char* message, const char* file_name, unsigned line_number) NOEXCEPT;
 TOAST_C_API void toast_critical(const char* sink, const char* message, const char* file_name, unsigned line_number) NOEXCEPT;
 
+/// Drops messages below @p severity (0 trace .. 4 critical) from @p sink, or from every sink without its own level when null
+TOAST_C_API void toast_log_set_level(const char* sink, unsigned char severity) NOEXCEPT;
+
 #ifdef __cplusplus
 }
 #endif
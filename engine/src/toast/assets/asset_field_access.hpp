@@ -27,8 +27,8 @@ struct AssetFieldAccess {
 		return std::any {(static_cast<Class*>(obj)->*_detail::template Accessor<Tag>::member).uid()};
 	}
 
-	static void set(void* obj, std::any value) {
-		if (auto* uid = std::any_cast<toast::UID>(&value)) {
+	static void set(void* obj, const std::any& value) {
+		if (const auto* uid = std::any_cast<toast::UID>(&value)) {
 			static_cast<Class*>(obj)->*_detail::template Accessor<Tag>::member = assets::load<typename Handle::asset_type>(*uid);
 		}
 	}
@@ -56,8 +56,8 @@ struct AssetArrayFieldAccess {
 		return std::any {std::move(uids)};
 	}
 
-	static void set(void* obj, std::any value) {
-		if (auto* uids = std::any_cast<std::vector<toast::UID>>(&value)) {
+	static void set(void* obj, const std::any& value) {
+		if (const auto* uids = std::any_cast<std::vector<toast::UID>>(&value)) {
 			Vector handles;
 			handles.reserve(uids->size());
 			for (toast::UID uid : *uids) {
@@ -8,6 +8,7 @@
 #include <nlohmann/json.hpp>
 #include <sstream>
 #include <toast/log.hpp>
+#include <toast/memory_tracker.hpp>
 #include <toast/project_settings.hpp>
 
 namespace assets {
@@ -38,6 +39,12 @@ AssetManager::AssetManager() {
 	listener.subscribe<event::ClearUnusedAssets>([this] { clearUnusedAssets(); });
 }
 
+AssetManager::~AssetManager() {
+	for (const auto& [_, bytes] : cache_bytes) {
+		toast::MemoryTracker::freed(toast::MemoryTag::assets, bytes);
+	}
+}
+
 auto AssetManager::get() noexcept -> AssetManager& {
 	TOAST_ASSERT(instance != nullptr, "AssetManager", "AssetManager instance is not initialized");
 	return *instance;
@@ -96,7 +103,7 @@ auto AssetManager::load(toast::UID uid) -> Asset* {
 									try {
 										auto schema_asset = std::make_unique<Schema>(schema_json);
 										Schema* raw_ptr = schema_asset.get();
-										cache[schema_uid.data()] = std::move(schema_asset);
+										cacheAsset(schema_uid.data(), std::move(schema_asset), schema_raw->size());
 										schema_handle = Handle<Schema>(raw_ptr, schema_uid, getURI(schema_uid));
 									} catch (const std::exception& se) {
 										TOAST_WARN("AssetManager", "Could not parse schema for asset {}: {}", info.path, se.what());
@@ -173,7 +180,7 @@ auto AssetManager::load(toast::UID uid) -> Asset* {
 	}
 
 	Asset* ptr = asset.get();
-	cache[id] = std::move(asset);
+	cacheAsset(id, std::move(asset), raw_data->size());
 
 	TOAST_TRACE("AssetManager", "Loaded asset: {} ({})", info.path, info.type);
 	return ptr;
@@ -375,13 +382,32 @@ void AssetManager::clearUnusedAssets() {
 
 	std::lock_guard lock(mutex);
 	size_t initial_count = cache.size();
-	std::erase_if(cache, [](const auto& item) { return item.second->refCount() == 0; });
+	std::erase_if(cache, [this](const auto& item) {
+		if (item.second->refCount() != 0) {
+			return false;
+		}
+		if (const auto it = cache_bytes.find(item.first); it != cache_bytes.end()) {
+			toast::MemoryTracker::freed(toast::MemoryTag::assets, it->second);
+			cache_bytes.erase(it);
+		}
+		return true;
+	});
 	size_t cleared = initial_count - cache.size();
 	if (cleared > 0) {
 		TOAST_INFO("AssetManager", "Cleared {} unused assets from cache", cleared);
 	}
 }
 
+void AssetManager::cacheAsset(uint64_t id, std::unique_ptr<Asset> asset, size_t source_bytes) {
+	// Parsed assets don't know their own footprint, so the source size stands in for it
+	if (const auto it = cache_bytes.find(id); it != cache_bytes.end()) {
+		toast::MemoryTracker::freed(toast::MemoryTag::assets, it->second);
+	}
+	cache[id] = std::move(asset);
+	cache_bytes[id] = source_bytes;
+	toast::MemoryTracker::allocated(toast::MemoryTag::assets, source_bytes);
+}
+
 void AssetManager::setPaths(Paths&& paths) {
 	roots["project"] = std::move(paths.project);
 	roots["artwork"] = std::move(paths.artworks);
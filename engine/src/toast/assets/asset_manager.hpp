@@ -65,7 +65,7 @@ struct Paths {
 class AssetManager {
 public:
 	AssetManager();
-	~AssetManager() = default;
+	~AssetManager();
 
 	static auto get() noexcept -> AssetManager&;
 
@@ -223,10 +223,14 @@ private:
 	std::mutex mutex;
 	std::unordered_map<uint64_t, AssetInfo> manifest;
 	std::unordered_map<uint64_t, std::unique_ptr<Asset>> cache;
+	std::unordered_map<uint64_t, size_t> cache_bytes;    ///< source size of each cached asset, as MemoryTracker counts it
 	std::unordered_map<uint64_t, std::filesystem::file_time_type> asset_mtimes;
 
 	static inline std::unordered_map<std::string, std::filesystem::path> roots;
 
+	/// @brief Puts @p asset in the cache and counts @p source_bytes against MemoryTag::assets; needs the mutex held
+	void cacheAsset(uint64_t id, std::unique_ptr<Asset> asset, size_t source_bytes);
+
 	auto resolveVirtualPath(std::string_view virtual_path) -> std::optional<std::filesystem::path>;
 	auto readVirtualPath(std::string_view virtual_path) -> std::optional<std::vector<uint8_t>>;
 	auto openFile(const std::filesystem::path& path) -> std::optional<std::vector<uint8_t>>;
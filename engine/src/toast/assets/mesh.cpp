@@ -1,5 +1,7 @@
 #include "mesh.hpp"
 
+#include <algorithm>
+#include <cmath>
 #include <toast/renderer/vulkan_renderer.hpp>
 
 namespace assets {
@@ -8,7 +10,9 @@ Mesh::Mesh(std::string_view name, std::vector<renderer::Vertex>&& vertices, std:
     : m_name(name),
       m_vertices(std::move(vertices)),
       m_indices(std::move(indices)),
-      m_gpu_mesh(std::make_unique<renderer::VulkanMesh>()) { }
+      m_gpu_mesh(std::make_unique<renderer::VulkanMesh>()) {
+	computeBounds();
+}
 
 Mesh::~Mesh() = default;
 
@@ -76,12 +80,40 @@ Mesh::Mesh(const std::vector<uint8_t>& data) : m_gpu_mesh(std::make_unique<rende
 		default: TOAST_ASSERT(false, "AssetManager", "Mesh data has invalid version");
 	}
 
-	// create GPU Side mesh
+	computeBounds();
+
+	// create GPU Side mesh; headless runs only keep the CPU copy for culling
+	if (renderer::VulkanRenderer::instance == nullptr) {
+		return;
+	}
 	renderer::VulkanRenderer::instance->queueResourceUpload(
 	    std::make_unique<renderer::MeshUpload>(*m_gpu_mesh, renderer::VulkanMesh::UploadData {m_vertices, m_indices}, m_name)
 	);
 }
 
+void Mesh::computeBounds() {
+	if (m_vertices.empty()) {
+		m_bounds = glm::vec4 {0.0f};
+		return;
+	}
+
+	// Centre of the AABB, radius to the farthest vertex; a bit loose but cheap and stable
+	glm::vec3 min_corner = m_vertices.front().position;
+	glm::vec3 max_corner = min_corner;
+	for (const auto& vertex : m_vertices) {
+		min_corner = glm::min(min_corner, glm::vec3(vertex.position));
+		max_corner = glm::max(max_corner, glm::vec3(vertex.position));
+	}
+
+	const glm::vec3 centre = (min_corner + max_corner) * 0.5f;
+	float radius_sq = 0.0f;
+	for (const auto& vertex : m_vertices) {
+		const glm::vec3 offset = glm::vec3(vertex.position) - centre;
+		radius_sq = std::max(radius_sq, glm::dot(offset, offset));
+	}
+	m_bounds = glm::vec4(centre, std::sqrt(radius_sq));
+}
+
 auto Mesh::toBinary() const -> std::vector<uint8_t> {
 	std::vector<uint8_t> buffer;
 
@@ -54,6 +54,12 @@ public:
 		return m_indices;
 	}
 
+	/// Bounding sphere of the vertices in mesh space: xyz is the centre, w the radius
+	[[nodiscard]]
+	auto bounds() const -> const glm::vec4& {
+		return m_bounds;
+	}
+
 	[[nodiscard]]
 	auto gpuMesh() const -> const renderer::VulkanMesh&;
 
@@ -69,9 +75,12 @@ public:
 	auto toBinary() const -> std::vector<uint8_t>;
 
 private:
+	void computeBounds();
+
 	std::string m_name;
 	std::vector<renderer::Vertex> m_vertices;
 	std::vector<Index> m_indices;
+	glm::vec4 m_bounds {0.0f};
 
 	std::unique_ptr<renderer::VulkanMesh> m_gpu_mesh;
 };
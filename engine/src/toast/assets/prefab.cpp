@@ -254,6 +254,20 @@ Prefab::Prefab(std::istream& file) {
 #endif
 }
 
+auto Prefab::plan() const -> std::shared_ptr<const toast::InstantiationPlan> {
+	std::scoped_lock lock(m_plan.mutex);
+	return m_plan.plan;
+}
+
+void Prefab::plan(std::shared_ptr<const toast::InstantiationPlan> compiled) const {
+	std::scoped_lock lock(m_plan.mutex);
+	m_plan.plan = std::move(compiled);
+}
+
+void Prefab::invalidatePlan() const {
+	plan(nullptr);
+}
+
 auto Prefab::serialize(SaveMode mode) const -> std::vector<uint8_t> {
 	validate();
 	if (mode == SaveMode::game) {
@@ -1095,7 +1109,7 @@ void Prefab::serializeNode(const toast::Node& node, bool is_root) {
 
 	auto make_field = [&](const FieldInfo* f_info) -> std::optional<Field> {
 		// Ignore fields with ReadOnly or NoSerialize attribute
-		if (f_info->hasAttribute("ReadOnly") || f_info->hasAttribute("NoSerialize")) {
+		if (f_info->hasFlag(FieldFlags::transient)) {
 			return {};
 		}
 
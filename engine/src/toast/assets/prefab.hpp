@@ -15,6 +15,8 @@
 #include <array>
 #include <cstdint>
 #include <iosfwd>
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <span>
 #include <string>
@@ -25,6 +27,7 @@
 
 namespace toast {
 class Node;
+struct InstantiationPlan;
 }
 
 namespace assets {
@@ -47,6 +50,20 @@ constexpr char string_array_separator =
 
 constexpr uint16_t format_version = 3;    ///< current binary layout version
 
+/// Holder for the compiled instantiation plan; copying a prefab never copies its plan
+struct PlanCache {
+	PlanCache() = default;
+	PlanCache(const PlanCache&) noexcept { }
+	auto operator=(const PlanCache&) noexcept -> PlanCache& {
+		std::scoped_lock lock(mutex);
+		plan.reset();
+		return *this;
+	}
+
+	std::mutex mutex;
+	std::shared_ptr<const toast::InstantiationPlan> plan;
+};
+
 struct TOAST_API NodeFileBinaryHeader {
 	const std::array<uint8_t, 6> magic = {'T', 'N', 'O', 'D', 'E', '\0'};
 	uint16_t version = format_version;
@@ -160,12 +177,18 @@ public:
 
 		[[nodiscard]]
 		auto find(std::string_view name) const -> std::optional<Field> {
-			auto it = std::ranges::find_if(fields, [name](const auto& field) { return field.name == name; });
-			if (it != fields.end()) {
-				return *it;
+			if (const auto* field = lookup(name)) {
+				return *field;
 			}
 			return {};
 		}
+
+		/// Same as find() without copying the field out
+		[[nodiscard]]
+		auto lookup(std::string_view name) const -> const Field* {
+			auto it = std::ranges::find_if(fields, [name](const auto& field) { return field.name == name; });
+			return it != fields.end() ? &*it : nullptr;
+		}
 	};
 
 	/**
@@ -181,18 +204,25 @@ public:
 
 		[[nodiscard]]
 		auto find(std::string_view name) const -> std::optional<Field> {
+			if (const auto* field = lookup(name)) {
+				return *field;
+			}
+			return {};
+		}
+
+		/// Same as find() without copying the field out
+		[[nodiscard]]
+		auto lookup(std::string_view name) const -> const Field* {
 			auto it = std::ranges::find_if(fields, [&name](const auto& field) { return field.name == name; });
 			if (it != fields.end()) {
-				return *it;
+				return &*it;
 			}
 			for (const auto& g : subgroups) {
-				auto g_it = g.find(name);
-				if (g_it.has_value()) {
-					return g_it;
+				if (const auto* field = g.lookup(name)) {
+					return field;
 				}
 			}
-
-			return {};
+			return nullptr;
 		}
 	};
 
@@ -221,18 +251,25 @@ public:
 
 		[[nodiscard]]
 		auto find(std::string_view name) const -> std::optional<Field> {
+			if (const auto* field = lookup(name)) {
+				return *field;
+			}
+			return {};
+		}
+
+		/// Same as find() without copying the field (and its std::any value) out
+		[[nodiscard]]
+		auto lookup(std::string_view name) const -> const Field* {
 			auto it = std::ranges::find_if(fields, [&name](const auto& field) { return field.name == name; });
 			if (it != fields.end()) {
-				return *it;
+				return &*it;
 			}
 			for (const auto& g : groups) {
-				auto g_it = g.find(name);
-				if (g_it.has_value()) {
-					return g_it;
+				if (const auto* field = g.lookup(name)) {
+					return field;
 				}
 			}
-
-			return {};
+			return nullptr;
 		}
 
 		[[nodiscard]]
@@ -242,6 +279,19 @@ public:
 		}
 	};
 
+	/**
+	 * @brief Instantiation plan compiled from this prefab, if any
+	 * @return The cached plan or nullptr; the caller still has to check InstantiationPlan::current()
+	 */
+	[[nodiscard]]
+	auto plan() const -> std::shared_ptr<const toast::InstantiationPlan>;
+
+	/// Caches a plan compiled from this prefab's current nodes
+	void plan(std::shared_ptr<const toast::InstantiationPlan> compiled) const;
+
+	/// Drops the cached plan; call after mutating nodes in place since the plan points into them
+	void invalidatePlan() const;
+
 	std::vector<Field> global_fields;
 	std::vector<BasicNode> nodes;
 
@@ -266,6 +316,7 @@ private:
 	auto fieldEquals(toast::FieldType type, bool is_array, const std::any& a, const std::any& b) const -> bool;
 	auto flattenedRootFields(const Handle<Prefab>& source) const -> std::optional<BasicNode>;
 
+	mutable _detail::PlanCache m_plan;
 	toast::UID m_self_uid;    ///< if this prefab embeds itself, this UID breaks the recursion during instantiation
 	std::unordered_set<uint64_t>
 	    m_allowed_uids;    ///< populated during serialization; ensures child-prefab UIDs don't collide with the parent's UID space
@@ -11,12 +11,13 @@
 #include <toast/assets/asset_manager.hpp>
 #include <toast/assets/core_types.hpp>
 #include <toast/log.hpp>
+#include <toast/time.hpp>
+#include <tracy/Tracy.hpp>
 
 namespace {
 
 #ifdef DEBUG
 auto fmodLogCallback(FMOD_DEBUG_FLAGS flags, const char* file, int line, const char* func, const char* message) -> FMOD_RESULT {
-	std::string msg = std::format("{}: {}", func, message);
 	uint8_t severity = 0;
 	if (flags & FMOD_DEBUG_LEVEL_WARNING) {
 		severity = 2;
@@ -24,6 +25,11 @@ auto fmodLogCallback(FMOD_DEBUG_FLAGS flags, const char* file, int line, const c
 	if (flags & FMOD_DEBUG_LEVEL_ERROR) {
 		severity = 3;
 	}
+	if (not ::logging::_detail::enabled(severity, "Audio")) {
+		return FMOD_OK;
+	}
+
+	std::string msg = std::format("{}: {}", func, message);
 
 	std::string path = file;
 	size_t pos = std::max(path.find_last_of('/'), path.find_last_of('\\'));
@@ -69,7 +75,7 @@ auto guidToString(const FMOD_GUID& guid) -> std::string {
 
 namespace audio {
 
-AudioSystem::AudioSystem() noexcept {
+AudioSystem::AudioSystem(bool null_output) noexcept {
 	TOAST_ASSERT(not instance, "Audio", "An AudioSystem class already exists");
 
 	instance = this;
@@ -86,9 +92,17 @@ AudioSystem::AudioSystem() noexcept {
 
 	int studio_init_flags = FMOD_STUDIO_INIT_NORMAL;
 #ifdef DEBUG
-	studio_init_flags |= FMOD_STUDIO_INIT_LIVEUPDATE;
+	if (!null_output) {
+		studio_init_flags |= FMOD_STUDIO_INIT_LIVEUPDATE;
+	}
 #endif
 
+	// Headless runs have no audio device; NRT mixes only when FMOD is updated, so it also costs nothing idle
+	if (null_output) {
+		result = FMOD_System_SetOutput(m_core_system, FMOD_OUTPUTTYPE_NOSOUND_NRT);
+		TOAST_ASSERT(result == FMOD_OK, "Audio", "FMOD null output could not be set: {}", FMOD_ErrorString(result));
+	}
+
 	result = FMOD_Studio_System_Initialize(m_system, 512, studio_init_flags, FMOD_INIT_NORMAL, nullptr);
 	TOAST_ASSERT(result == FMOD_OK, "Audio", "FMOD could not be started: {}", FMOD_ErrorString(result));
 
@@ -336,10 +350,7 @@ void AudioSystem::registerListener(toast::AudioListener& listener) {
 	}
 
 	m_listeners.emplace_back(listener);
-
-	for (auto& vol : m_volumes) {
-		vol->setListeners(m_listeners);
-	}
+	m_candidates_frame = no_candidates;
 
 	TOAST_INFO("Audio", "Registering listener {}", listener.box());
 }
@@ -347,10 +358,7 @@ void AudioSystem::registerListener(toast::AudioListener& listener) {
 void AudioSystem::unregisterListener(toast::AudioListener& listener) {
 	std::scoped_lock lock(m_listeners_mutex, m_volumes_mutex);
 	std::erase(m_listeners, listener.box());
-
-	for (auto& vol : m_volumes) {
-		vol->setListeners(m_listeners);
-	}
+	m_candidates_frame = no_candidates;
 
 	TOAST_INFO("Audio", "Unregistering listener {}", listener.box());
 }
@@ -358,16 +366,53 @@ void AudioSystem::unregisterListener(toast::AudioListener& listener) {
 void AudioSystem::registerVolume(toast::AudioVolume& volume) {
 	std::scoped_lock lock(m_volumes_mutex, m_listeners_mutex);
 	m_volumes.push_back(volume.box().as<toast::AudioVolume>());
-	volume.setListeners(m_listeners);
+	m_volume_index.insert(volume);
+	m_candidates_frame = no_candidates;
 	TOAST_INFO("Audio", "Registering volume {}", volume.box());
 }
 
 void AudioSystem::unregisterVolume(toast::AudioVolume& volume) {
 	std::scoped_lock lock(m_volumes_mutex);
 	std::erase(m_volumes, volume.box().as<toast::AudioVolume>());
+	m_volume_index.erase(volume);
+	std::erase_if(m_volume_candidates, [&volume](const VolumeCandidate& candidate) { return candidate.volume == &volume; });
 	TOAST_INFO("Audio", "Unregistering volume {}", volume.box());
 }
 
+void AudioSystem::listenersInRange(const toast::AudioVolume& volume, std::vector<toast::Box<toast::AudioListener>>& out) {
+	out.clear();
+	std::scoped_lock lock(m_volumes_mutex, m_listeners_mutex);
+
+	// The first volume to late tick in a frame or step queries the index once per listener for everyone
+	const std::pair frame {toast::Time::frame(), toast::Time::step()};
+	if (frame != m_candidates_frame) {
+		ZoneScopedN("Volume candidates");
+		m_candidates_frame = frame;
+		m_volume_index.refresh();
+		m_volume_candidates.clear();
+
+		std::vector<toast::Volume*> hits;
+		for (const auto& listener : m_listeners) {
+			if (not listener.exists()) {
+				continue;
+			}
+			hits.clear();
+			m_volume_index.query(listener->world_position, hits);
+			for (toast::Volume* hit : hits) {
+				m_volume_candidates.push_back({hit, listener});
+			}
+		}
+		std::ranges::stable_sort(m_volume_candidates, std::ranges::less {}, &VolumeCandidate::volume);
+	}
+
+	const auto [first, last] = std::ranges::equal_range(
+	    m_volume_candidates, static_cast<const toast::Volume*>(&volume), std::ranges::less {}, &VolumeCandidate::volume
+	);
+	for (auto it = first; it != last; ++it) {
+		out.push_back(it->listener);
+	}
+}
+
 void AudioSystem::playEvent(std::string_view guid_str) {
 	if (FMOD_STUDIO_EVENTINSTANCE* inst = getOrCreateInstance(guid_str)) {
 		FMOD_Studio_EventInstance_Start(inst);
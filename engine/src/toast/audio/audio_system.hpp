@@ -13,6 +13,8 @@
 #include <fmod/fmod_studio.h>
 #include <glm/glm.hpp>
 #include <toast/world/box.hpp>
+#include <toast/world/volume_index.hpp>
+#include <utility>
 
 namespace toast {
 class AudioListener;
@@ -31,7 +33,8 @@ namespace audio {
  */
 class AudioSystem {
 public:
-	AudioSystem() noexcept;
+	/// @param null_output Mixes into FMOD's non-realtime no-sound output; banks and events still work without a device
+	explicit AudioSystem(bool null_output = false) noexcept;
 	~AudioSystem() noexcept;
 
 	[[nodiscard]]
@@ -57,6 +60,15 @@ public:
 	void registerVolume(toast::AudioVolume& volume);
 	void unregisterVolume(toast::AudioVolume& volume);
 
+	/**
+	 * @brief Listeners close enough for @p volume to give them a non-zero weight this frame
+	 *
+	 * Backed by a VolumeIndex that is refreshed and queried once per listener by the first call in
+	 * each frame or fixed step, so a volume far from every listener costs a lookup instead of a
+	 * weight evaluation per listener
+	 */
+	void listenersInRange(const toast::AudioVolume& volume, std::vector<toast::Box<toast::AudioListener>>& out);
+
 	void playEvent(std::string_view guid_str);
 	void stopEvent(std::string_view guid_str, bool allow_fadeout);
 	void pauseEvent(std::string_view guid_str, bool value);
@@ -126,6 +138,16 @@ private:
 
 	std::vector<toast::Box<toast::AudioVolume>> m_volumes;
 	std::mutex m_volumes_mutex;
+
+	struct VolumeCandidate {
+		const toast::Volume* volume;
+		toast::Box<toast::AudioListener> listener;
+	};
+
+	static constexpr std::pair<uint64_t, uint64_t> no_candidates {~0ull, ~0ull};
+	toast::VolumeIndex m_volume_index;
+	std::vector<VolumeCandidate> m_volume_candidates;    ///< sorted by volume
+	std::pair<uint64_t, uint64_t> m_candidates_frame = no_candidates;    ///< Time::frame() and Time::step() they were found in
 };
 
 }
@@ -19,10 +19,6 @@ void AudioVolume::onEnable() { }
 
 void AudioVolume::onDisable() { }
 
-void AudioVolume::setListeners(const std::vector<Box<AudioListener>>& listeners) {
-	m_listeners = listeners;
-}
-
 void AudioVolume::resetAccumulators() {
 	m_pending_targets.clear();
 }
@@ -77,6 +73,7 @@ void AudioVolume::finalizeAccumulators() {
 
 void AudioVolume::lateTick() {
 	resetAccumulators();
+	audio::AudioSystem::get().listenersInRange(*this, m_listeners);
 
 	for (auto& listener : m_listeners) {
 		if (!listener.exists()) {
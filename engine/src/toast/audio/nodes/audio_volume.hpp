@@ -18,9 +18,10 @@ class AudioListener;
 /**
  * @brief Base interface for audio-reactive volumes
  *
- * Each frame, listener weights accumulate via evaluateTarget. After all listeners are
- * processed, finalizeAccumulators is called once, then onVolumeTick fires so subclasses
- * can push state to FMOD based on the frame's accumulated data
+ * Each frame, listener weights accumulate via evaluateTarget. Only the listeners the
+ * AudioSystem's volume index puts in range are evaluated; the rest count as outside. After all
+ * listeners are processed, finalizeAccumulators is called once, then onVolumeTick fires so
+ * subclasses can push state to FMOD based on the frame's accumulated data
  */
 class TOAST_API [[ToastNode, Hidden, Interface, Color("Beige")]] AudioVolume : public Volume {
 public:
@@ -29,8 +30,6 @@ public:
 	void resetAccumulators() override;
 	void finalizeAccumulators();
 
-	void setListeners(const std::vector<Box<AudioListener>>& listeners);
-
 protected:
 	[[nodiscard]]
 	auto trackTarget(const VolumeTarget& target, bool inside) -> bool;    ///< returns true if the inside state changed
@@ -53,7 +52,7 @@ private:
 
 	std::vector<ListenerState> m_listeners_inside;
 	std::vector<ListenerState> m_pending_targets;
-	std::vector<Box<AudioListener>> m_listeners;
+	std::vector<Box<AudioListener>> m_listeners;    ///< in range this frame
 };
 
 }
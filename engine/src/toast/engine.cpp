@@ -7,12 +7,17 @@
 #include "events/event.hpp"
 #include "events/listener.hpp"
 #include "ffi/engine.h"    // ffi
+#include "frame_report.hpp"
 #include "input/haptics_system.hpp"
 #include "input/input_events.hpp"
 #include "input/input_system.hpp"
 #include "logger.hpp"
+#include "memory_tracker.hpp"
+#include "profiler.hpp"
 #include "project_settings.hpp"
 #include "reflect/reflect.hpp"
+#include "replay.hpp"
+#include "renderer/headless_renderer.hpp"
 #include "renderer/passes/debug_pass.hpp"
 #include "renderer/passes/grid_pass.hpp"
 #include "renderer/render_events.hpp"
@@ -24,6 +29,7 @@
 #include "renderer/vulkan_core.hpp"
 #include "renderer/vulkan_renderer.hpp"
 #include "scripting/lua_state.hpp"
+#include "stage_graph.hpp"
 #include "thread_pool.hpp"
 #include "time.hpp"
 #include "ui/render/ui_pass.hpp"
@@ -32,6 +38,7 @@
 #include "window/base_window.hpp"
 #include "window/sdl_window.hpp"
 #include "window/window_events.hpp"
+#include "world/owner_scheduler.hpp"
 #include "world/play_workspace.hpp"
 #include "world/workspace.hpp"
 #include "world/workspace_events.hpp"
@@ -40,6 +47,7 @@
 #include <SDL3/SDL.h>
 #include <algorithm>
 #include <cassert>
+#include <chrono>
 #include <filesystem>
 #include <fstream>
 #include <memory>
@@ -79,12 +87,25 @@ struct EnginePimpl {
 	Time time;
 	event::Listener listener;
 	toast::NodeRegistry reflection_registry;
+	StageGraph frame_stages;    ///< audio, UI, asset upkeep and render build after the simulation
+	std::unique_ptr<Profiler> profiler = nullptr;
+
+	// headless runs
+	bool headless = false;
+	std::unique_ptr<renderer::HeadlessRenderer> headless_renderer = nullptr;
+	std::unique_ptr<FrameReport> frame_report = nullptr;
+	std::chrono::steady_clock::time_point frame_start {};
+	double owners_ms = 0.0;
+	bool frame_pending = false;    ///< a frame ran since the last recordFrame()
+	std::unique_ptr<Replay> replay = nullptr;
 
 	// owned by renderer's output target
 	renderer::SharedTextureOutputTarget* shared_target = nullptr;
 
 	std::mutex owners_mutex;
 	std::map<toast::UID, std::unique_ptr<INodeOwner>> owners;
+	OwnerScheduler owner_scheduler;
+	std::vector<OwnerScheduler::Entry> owner_entries;    ///< owners flattened for the scheduler, rebuilt every frame
 	toast::UID active_workspace {0};
 };
 
@@ -140,6 +161,8 @@ void Engine::init() {
 			}
 		}
 		m->settings = std::make_unique<ProjectSettings>(toast_path);
+		Time::setFixedRate(ProjectSettings::gameplaySettings().tickRate());
+		Time::setMaxSteps(ProjectSettings::gameplaySettings().maxStepsPerFrame());
 	}
 
 	// Register content database VFS roots derived from project settings
@@ -152,8 +175,13 @@ void Engine::init() {
 
 	m->asset_manager = std::make_unique<assets::AssetManager>();
 
-	// Compile every stale shader up front
-	renderer::ShaderCache::get().compileAllAtStartup();
+	m->profiler = std::make_unique<Profiler>();
+	configureProfiler();
+
+	// Compile every stale shader up front; headless runs never create a pipeline
+	if (!m->headless) {
+		renderer::ShaderCache::get().compileAllAtStartup();
+	}
 
 	renderer::registerRenderEvents();
 
@@ -199,12 +227,149 @@ void Engine::init() {
 		return false;
 	});
 
-	m->audio_system = std::make_unique<audio::AudioSystem>();
+	m->audio_system = std::make_unique<audio::AudioSystem>(m->headless);
 	m->ui_system = std::make_unique<ui::UISystem>();
+
+	registerFrameStages();
+
+	// Stands in for the window and the GPU renderer: meshes and cameras register with it instead
+	if (m->headless) {
+		m->headless_renderer = std::make_unique<renderer::HeadlessRenderer>();
+
+		// waves() lays the graph out, which also names the timings
+		std::ignore = m->frame_stages.waves();
+		std::vector<std::string> stage_names;
+		for (const auto& timing : m->frame_stages.timings()) {
+			stage_names.push_back(timing.name);
+		}
+		m->frame_report = std::make_unique<FrameReport>(std::move(stage_names));
+		TOAST_INFO("Engine", "Running headless");
+	}
+}
+
+void Engine::setHeadless(bool value) {
+	TOAST_ASSERT(!m->asset_manager, "Engine", "setHeadless() must be called before init()");
+	m->headless = value;
+}
+
+auto Engine::headless() const -> bool {
+	return m->headless;
+}
+
+void Engine::registerFrameStages() {
+	using R = FrameResource;
+
+	// None of these write node state, they only order against each other
+	m->frame_stages.addStage("Audio", R::none, R::audio, [this] {
+		if (m->audio_system) {
+			m->audio_system->tick();
+		}
+	});
+
+	m->frame_stages.addStage("UI", R::world | R::assets, R::ui, [this] {
+		if (m->ui_system) {
+			m->ui_system->tick();
+		}
+	});
+
+	m->frame_stages.addStage("Lua memory", R::time, R::lua, [this] {
+		lua_memory_plot_timer += Time::delta();
+		if (lua_memory_plot_timer > 1.0) {
+			lua_memory_plot_timer = 0.0;
+			if (m->lua_state) {
+				m->lua_state->plotMemory();
+			}
+		}
+	});
+
+	m->frame_stages.addStage("Asset upkeep", R::time, R::assets, [this] {
+		// TODO MOVE THIS
+		clear_assets_timer += Time::delta();
+		if (clear_assets_timer > 30.0) {
+			m->asset_manager->clearUnusedAssets();
+			clear_assets_timer = 0.0;
+		}
+
+#ifdef DEBUG
+		// dev builds hot-reload scripts, shaders and materials edited on disk
+		script_reload_timer += Time::delta();
+		if (script_reload_timer > 1.0) {
+			script_reload_timer = 0.0;
+			if (m->asset_manager) {
+				m->asset_manager->pollModifiedAssets();
+			}
+		}
+#endif
+	});
+
+	// Last wave: keeps running while the next frame pumps the window
+	m->frame_stages.addStage("Render build", R::world | R::assets | R::ui | R::time, R::render_frame, [this] {
+		if (m->renderer) {
+			m->renderer->tick(total_time);
+		} else if (m->headless_renderer) {
+			m->headless_renderer->tick(total_time);
+		}
+	});
+}
+
+void Engine::configureProfiler() {
+	const auto& settings = ProjectSettings::profilerSettings();
+	m->profiler->setBudget(Profiler::frame_zone, settings.frameBudgetMs());
+	for (const auto& [zone, ms] : settings.budgets()) {
+		m->profiler->setBudget(zone, ms);
+	}
+
+	for (const auto& [tag_name, bytes] : settings.memoryBudgets()) {
+		bool known = false;
+		for (uint8_t tag = 0; tag < static_cast<uint8_t>(MemoryTag::count); ++tag) {
+			if (MemoryTracker::name(static_cast<MemoryTag>(tag)) == tag_name) {
+				MemoryTracker::setBudget(static_cast<MemoryTag>(tag), bytes);
+				known = true;
+			}
+		}
+		if (!known) {
+			TOAST_WARN("Engine", "[profiler.memory_budgets_mb]: no memory tag called '{}'", tag_name);
+		}
+	}
+
+	std::filesystem::path spike_directory;
+	if (!settings.spikeDirectory().empty()) {
+		spike_directory = m->asset_manager->getCachePath() / settings.spikeDirectory();
+	}
+	m->profiler->setSpikeDirectory(std::move(spike_directory), settings.maxSpikeDumps());
+}
+
+void Engine::recordFrame() {
+	const auto now = std::chrono::steady_clock::now();
+	if (m->frame_pending) {
+		FrameReport::Frame frame {
+		  .frame_ms = std::chrono::duration<double, std::milli>(now - m->frame_start).count(),
+		  .owners_ms = m->owners_ms,
+		};
+		for (const auto& timing : m->frame_stages.timings()) {
+			frame.stage_ms.push_back(timing.ms);
+		}
+		if (m->headless_renderer) {
+			frame.visible = m->headless_renderer->stats().visible;
+			frame.culled = m->headless_renderer->stats().culled;
+		}
+		frame.resident_kb = FrameReport::residentKb();
+		m->frame_report->add(std::move(frame));
+	}
+
+	m->frame_start = now;
+	m->frame_pending = false;
 }
 
 Engine::~Engine() noexcept {
 	if (m) {
+		// A stage that failed in the last frame rethrows here, and this destructor can't let it out
+		try {
+			m->frame_stages.finish();
+		} catch (const std::exception& e) {
+			TOAST_ERROR("Engine", "Frame stage failed during shutdown: {}", e.what());
+		} catch (...) { TOAST_ERROR("Engine", "Frame stage failed during shutdown"); }
+		m->replay.reset();
 		if (m->renderer) {
 			m->renderer->stop();
 		}
@@ -218,7 +383,15 @@ Engine::~Engine() noexcept {
 		m->ui_system.reset();
 		m->asset_manager.reset();
 		m->renderer.reset();
+		m->headless_renderer.reset();
 		m->vulkan_core.reset();
+		m->lua_state.reset();
+
+		// Everything that reports to the tracker is gone by now, the logger still isn't
+		if (m->settings and ProjectSettings::profilerSettings().leakReport()) {
+			const size_t leaking = MemoryTracker::reportLeaks();
+			TOAST_INFO("Engine", "Leak report: {} subsystem(s) still hold memory", leaking);
+		}
 
 		delete m;
 		m = nullptr;
@@ -228,6 +401,8 @@ Engine::~Engine() noexcept {
 }
 
 void Engine::reloadSettings() {
+	m->frame_stages.finish();
+
 	// Find the .toast project file in the project root
 	std::filesystem::path toast_path;
 	const auto& proj_root = assets::AssetManager::projectRoot();
@@ -252,75 +427,75 @@ void Engine::reloadSettings() {
 	if (m->asset_manager) {
 		m->asset_manager->reloadManifest();
 	}
+	if (m->profiler) {
+		configureProfiler();
+	}
 }
 
 void Engine::tick() {
 	ZoneScoped;
 
-	m->time.tick();
-
-	// Poll window events
+	// Pumping the window only queues events, so it overlaps the previous frame's render build
 	if (m->window) {
+		TOAST_ZONE("Window events");
 		m->window->pollEvents();
 	}
 
-	event::pollEvents();
+	// Nothing runs on the pool past the barrier, so the profiler can close the frame
+	m->frame_stages.finish();
+	if (m->profiler) {
+		m->profiler->endFrame();
+	}
+	if (m->frame_report) {
+		recordFrame();
+	}
+	m->time.tick();
+	MemoryTracker::update(Time::delta());
 
-	m->input_system->tick();
-	m->haptics_system->tick();
+	{
+		TOAST_ZONE("Events");
+		event::pollEvents();
+	}
+
+	{
+		TOAST_ZONE("Input");
+		m->input_system->tick();
+		m->haptics_system->tick();
+	}
 
 	{
 		std::scoped_lock lock(m->owners_mutex);
-		ZoneScopedN("NodeOwners::tick()");
-		for (const auto& [_, node_owner] : m->owners) {
-			node_owner->tick();
+		{
+			TOAST_ZONE("NodeOwners::frameTick()");
+			for (const auto& [_, node_owner] : m->owners) {
+				node_owner->frameTick();
+			}
 		}
+
+		m->owner_entries.clear();
+		for (const auto& [uid, node_owner] : m->owners) {
+			m->owner_entries.push_back({uid, node_owner.get()});
+		}
+
+		// Simulation runs at the fixed rate; everything below stays per frame and renders by Time::alpha()
+		// Owners share no nodes, so they tick side by side; run() is the barrier before the app layer
+		const auto owners_start = std::chrono::steady_clock::now();
+		m->time.runSteps([this] {
+			TOAST_ZONE("NodeOwners::tick()");
+			m->owner_scheduler.run(m->owner_entries, [](INodeOwner& node_owner) { node_owner.tick(); });
+		});
+		m->owners_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - owners_start).count();
 	}
 
 	// Run application layer
 	if (active_application) {
-		ZoneScopedN("GameLayer::tick()");
+		TOAST_ZONE("GameLayer::tick()");
 		active_application->tick();
 	}
 	total_time += Time::delta();
 
-	if (m->audio_system) {
-		m->audio_system->tick();
-	}
-
-	if (m->ui_system) {
-		m->ui_system->tick();
-	}
-
-	// TODO MOVE THIS
-	clear_assets_timer += Time::delta();
-	if (clear_assets_timer > 30.0) {
-		m->asset_manager->clearUnusedAssets();
-		clear_assets_timer = 0.0;
-	}
-
-	if (m->renderer) {
-		m->renderer->tick(total_time);
-	}
-
-	lua_memory_plot_timer += Time::delta();
-	if (lua_memory_plot_timer > 1.0) {
-		lua_memory_plot_timer = 0.0;
-		if (m->lua_state) {
-			m->lua_state->plotMemory();
-		}
-	}
-
-#ifdef DEBUG
-	// dev builds hot-reload scripts, shaders and materials edited on disk
-	script_reload_timer += Time::delta();
-	if (script_reload_timer > 1.0) {
-		script_reload_timer = 0.0;
-		if (m->asset_manager) {
-			m->asset_manager->pollModifiedAssets();
-		}
-	}
-#endif
+	m->frame_stages.run();
+	m->frame_pending = true;
 
 	FrameMark;
 }
@@ -406,9 +581,11 @@ void Engine::createAvaloniaWindow() {
 	m->renderer->start();
 }
 
+// Everything that changes owners between frames joins the render build first; it still reads the node trees
 auto Engine::createWorkspace(std::string_view type) -> std::pair<UID, std::string> {
 	UID uid;
 	uid.generate();
+	m->frame_stages.finish();
 	std::scoped_lock lock(m->owners_mutex);
 	auto [it, _] = m->owners.emplace(uid, std::make_unique<Workspace>(type, uid));
 	std::string name = it->second->name();
@@ -416,6 +593,7 @@ auto Engine::createWorkspace(std::string_view type) -> std::pair<UID, std::strin
 }
 
 auto Engine::openWorkspace(UID uid) -> std::pair<UID, std::string> {
+	m->frame_stages.finish();
 	std::scoped_lock lock(m->owners_mutex);
 	if (m->owners.contains(uid)) {
 		TOAST_ERROR("Engine", "Trying to open workspace {} which is already open", uid);
@@ -436,6 +614,7 @@ auto Engine::openWorkspace(UID uid) -> std::pair<UID, std::string> {
 }
 
 auto Engine::openWorkspace(UID uid, std::string_view source_uri) -> std::pair<UID, std::string> {
+	m->frame_stages.finish();
 	std::scoped_lock lock(m->owners_mutex);
 	if (m->owners.contains(uid)) {
 		TOAST_ERROR("Engine", "Trying to open workspace {} which is already open", uid);
@@ -456,6 +635,7 @@ auto Engine::openWorkspace(UID uid, std::string_view source_uri) -> std::pair<UI
 }
 
 auto Engine::playWorkspace(UID source_handle) -> std::pair<UID, std::string> {
+	m->frame_stages.finish();
 	std::scoped_lock lock(m->owners_mutex);
 	auto source_it = m->owners.find(source_handle);
 	if (source_it == m->owners.end()) {
@@ -488,8 +668,10 @@ auto Engine::playWorkspace(UID source_handle) -> std::pair<UID, std::string> {
 }
 
 void Engine::destroyWorkspace(UID handle) {
+	m->frame_stages.finish();
 	std::scoped_lock lock(m->owners_mutex);
 	m->owners.erase(handle);
+	m->owner_scheduler.removeOwner(handle);
 	if (m->active_workspace.data() == handle.data()) {
 		m->active_workspace = UID {0};
 	}
@@ -499,7 +681,18 @@ auto Engine::activeWorkspace() -> UID {
 	return m->active_workspace;
 }
 
+void Engine::addOwnerDependency(UID before, UID after) {
+	std::scoped_lock lock(m->owners_mutex);
+	m->owner_scheduler.addDependency(before, after);
+}
+
+void Engine::removeOwnerDependency(UID before, UID after) {
+	std::scoped_lock lock(m->owners_mutex);
+	m->owner_scheduler.removeDependency(before, after);
+}
+
 void Engine::refreshNodeInfos() {
+	m->frame_stages.finish();
 	std::scoped_lock lock(m->owners_mutex);
 	for (const auto& [_, node_owner] : m->owners) {
 		node_owner->refreshNodeInfos();
@@ -538,6 +731,7 @@ void popApplicationLayer(IApplication* app) {
 }
 
 void Engine::popApplication() {
+	m->frame_stages.finish();
 	if (active_application) {
 		active_application->destroy();
 		delete active_application;
@@ -551,22 +745,25 @@ void Engine::beginApplication() {
 	}
 }
 
-void Engine::startGame() {
+void Engine::startGame(std::string_view scene) {
 	{
+		m->frame_stages.finish();
 		std::scoped_lock lock(m->owners_mutex);
 		// Use a well-known sentinel UID (-1) so the world can be found/removed if needed
 		m->owners.emplace(UID {static_cast<uint64_t>(-1ULL)}, std::make_unique<World>());
 	}
 
-	// Resolve the start scene from project settings
-	const ProjectSettings* ps = ProjectSettings::get();
-	if (!ps) {
-		TOAST_WARN("Engine", "startGame: no project settings; skipping start scene");
-		return;
+	// Resolve the start scene from the caller or the project settings
+	std::string path(scene);
+	if (path.empty()) {
+		const ProjectSettings* ps = ProjectSettings::get();
+		if (!ps) {
+			TOAST_WARN("Engine", "startGame: no project settings; skipping start scene");
+			return;
+		}
+		path = toast::ProjectSettings::gameplaySettings().initScene().path();
 	}
 
-	const auto& init_scene_handle = toast::ProjectSettings::gameplaySettings().initScene();
-	const auto path = init_scene_handle.path();
 	if (path.empty()) {
 		TOAST_WARN("Engine", "startGame: no init_scene set in project settings");
 		return;
@@ -581,6 +778,56 @@ void Engine::startGame() {
 		World::loadNode(path, true);
 	}
 }
+
+auto Engine::startReplay(std::string_view path, bool record) -> bool {
+	m->replay.reset();
+	m->replay = std::make_unique<Replay>(record ? Replay::Mode::record : Replay::Mode::play, std::filesystem::path(path));
+	if (!m->replay->valid()) {
+		m->replay.reset();
+		return false;
+	}
+	return true;
+}
+
+void Engine::stopReplay() {
+	m->replay.reset();
+}
+
+auto Engine::writeFrameReport(std::string_view path) -> bool {
+	if (!m->frame_report) {
+		TOAST_WARN("Engine", "writeFrameReport: frames are only recorded in headless mode");
+		return false;
+	}
+
+	// The last frame's render build may still be running
+	m->frame_stages.finish();
+	recordFrame();
+
+	const auto& report = *m->frame_report;
+	TOAST_INFO("Engine", "Headless run: {} frames", report.frames().size());
+	for (const auto& column : report.summary()) {
+		TOAST_INFO(
+		    "Engine",
+		    "  {:<14} p50 {:>10.3f}  p99 {:>10.3f}  max {:>10.3f}  drift {:+6.1f}%",
+		    column.name,
+		    column.p50,
+		    column.p99,
+		    column.max,
+		    column.drift_pct
+		);
+	}
+
+	if (m->profiler) {
+		m->profiler->logSummary();
+	}
+
+	if (!report.writeCsv(std::filesystem::path(path))) {
+		TOAST_ERROR("Engine", "writeFrameReport: cannot write {}", path);
+		return false;
+	}
+	TOAST_INFO("Engine", "Frame report written to {}", path);
+	return true;
+}
 }
 
 #ifdef TRACY_ENABLE
@@ -739,6 +986,10 @@ void toast_create_avalonia_window() noexcept {
 	toast::Engine::get()->createAvaloniaWindow();
 }
 
+void toast_set_headless(int headless) noexcept {
+	toast::Engine::get()->setHeadless(headless != 0);
+}
+
 void toast_tick() noexcept {
 #ifdef TRACY_ENABLE
 	static std::once_flag s_thread_named;
@@ -889,6 +1140,81 @@ void toast_start_game() noexcept {
 	toast::Engine::get()->startGame();
 }
 
+void toast_start_scene(const char* scene) noexcept {
+	toast::Engine::get()->startGame(scene ? scene : "");
+}
+
+auto toast_write_frame_report(const char* path) noexcept -> int {
+	if (!path) {
+		return 0;
+	}
+	return toast::Engine::get()->writeFrameReport(path) ? 1 : 0;
+}
+
+auto toast_profiler_stats(toast_profiler_zone_t* out, int capacity) noexcept -> int {
+	const auto* profiler = toast::Profiler::get();
+	if (!profiler) {
+		return 0;
+	}
+
+	// Keeps the names alive until the next call
+	static thread_local std::vector<toast::Profiler::Stats> s_stats;
+	s_stats = profiler->stats();
+	for (int i = 0; out and i < capacity and i < static_cast<int>(s_stats.size()); ++i) {
+		const auto& zone = s_stats[i];
+		out[i] = {
+		  .name = zone.name.c_str(),
+		  .last_ms = zone.last_ms,
+		  .p50_ms = zone.p50_ms,
+		  .p99_ms = zone.p99_ms,
+		  .max_ms = zone.max_ms,
+		  .budget_ms = zone.budget_ms,
+		  .over_budget = zone.over_budget,
+		};
+	}
+	return static_cast<int>(s_stats.size());
+}
+
+void toast_profiler_set_budget(const char* zone, double ms) noexcept {
+	if (auto* profiler = toast::Profiler::get(); profiler and zone) {
+		profiler->setBudget(zone, ms);
+	}
+}
+
+auto toast_profiler_over_budget_frames() noexcept -> uint64_t {
+	const auto* profiler = toast::Profiler::get();
+	return profiler ? profiler->overBudgetFrames() : 0;
+}
+
+auto toast_memory_stats(toast_memory_tag_t* out, int capacity) noexcept -> int {
+	constexpr int count = static_cast<int>(toast::MemoryTag::count);
+	for (int i = 0; out and i < capacity and i < count; ++i) {
+		const auto counters = toast::MemoryTracker::counters(static_cast<toast::MemoryTag>(i));
+		out[i] = {
+		  .name = counters.name.data(),    // literals, so null-terminated
+		  .current = counters.current,
+		  .peak = counters.peak,
+		  .allocations = counters.allocations,
+		  .live_blocks = counters.live_blocks,
+		  .bytes_per_second = counters.bytes_per_second,
+		  .budget = counters.budget,
+		};
+	}
+	return count;
+}
+
+auto toast_replay_record(const char* path) noexcept -> int {
+	return path and toast::Engine::get()->startReplay(path, true) ? 1 : 0;
+}
+
+auto toast_replay_play(const char* path) noexcept -> int {
+	return path and toast::Engine::get()->startReplay(path, false) ? 1 : 0;
+}
+
+void toast_replay_stop() noexcept {
+	toast::Engine::get()->stopReplay();
+}
+
 void toast_begin_application() noexcept {
 	toast::Engine::get()->beginApplication();
 }
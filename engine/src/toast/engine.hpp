@@ -27,6 +27,11 @@ public:
 	auto operator=(const Engine&) -> Engine& = delete;
 	auto operator=(const Engine&&) -> Engine& = delete;
 
+	/// @brief No window, null FMOD output and a CPU-only HeadlessRenderer; frame timings are recorded
+	/// @note Must be called before init()
+	void setHeadless(bool value);
+	auto headless() const -> bool;
+
 	void init();
 	void tick();
 	auto shouldClose() -> bool;
@@ -49,6 +54,10 @@ public:
 
 	auto activeWorkspace() -> UID;
 
+	/// @brief Makes @p after tick only once @p before finished each step; owners without one tick in parallel
+	void addOwnerDependency(UID before, UID after);
+	void removeOwnerDependency(UID before, UID after);
+
 	/// @brief Re-resolves NodeInfo after a project reload
 	void refreshNodeInfos();
 
@@ -62,11 +71,35 @@ public:
 	/// @brief Destroys the active application layer and nulls the pointer
 	void popApplication();
 
-	/// @brief Creates the World, then loads and activates the init_scene from project settings
+	/// @brief Creates the World, then loads and activates @p scene, or the init_scene from project settings
+	/// @param scene UID string or URI; empty uses the project's init_scene
 	/// @note Must be called after toast_init() and toast_create_*_window()
-	void startGame();
+	void startGame(std::string_view scene = {});
+
+	/**
+	 * @brief Starts recording this run to @p path, or playing one back from it; see Replay
+	 * @note Call before startGame() so the start scene's load is part of the stream
+	 * @returns false if the file can't be opened or isn't a replay
+	 */
+	auto startReplay(std::string_view path, bool record) -> bool;
+
+	/// @brief Finishes the recording, or stops feeding a playback
+	void stopReplay();
+
+	/// @brief Writes the frames recorded so far in headless mode as CSV and logs their percentiles
+	/// @returns false if the engine isn't headless or the file couldn't be written
+	auto writeFrameReport(std::string_view path) -> bool;
 
 private:
+	/// @brief Declares audio, UI, asset upkeep and the render build as frame stages; see StageGraph
+	void registerFrameStages();
+
+	/// @brief Applies the [profiler] budgets and spike folder from the project settings
+	void configureProfiler();
+
+	/// @brief Adds the frame that finished last to the headless FrameReport
+	void recordFrame();
+
 	EnginePimpl* m;
 	static Engine* instance;
 };
@@ -78,6 +111,8 @@ private:
  *		- Set the working directories -> toast_set_working_directory()
  *		- Call Init() -> toast_init()
  *		- Create window -> toast_create_[...]_window()
+ *
+ *	Headless runs call toast_set_headless(1) before toast_init() and skip the window
  */
 
 }
@@ -1,6 +1,8 @@
 #include "event.hpp"
 
+#include "ffi-channel.hpp"
 #include "proto_event.hpp"
+#include "thread-listener.hpp"
 
 #include <array>
 #include <atomic>
@@ -13,38 +15,174 @@
 #include <mutex>
 #include <string>
 #include <toast/log.hpp>
+#include <toast/memory_tracker.hpp>
 #include <tracy/Tracy.hpp>
+#include <typeindex>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace event {
 
-std::unordered_map<std::type_index, EventSystem::EventInfo> EventSystem::event_data;
+std::array<EventSystem::EventInfo, EventSystem::max_event_types> EventSystem::channels;
 std::mutex EventSystem::pool_mutex;
-std::unordered_map<std::type_index, std::function<void(std::any)>> EventSystem::unsubscribe_map;
+std::array<void (*)(const std::any&), EventSystem::max_event_types> EventSystem::unsubscribers;
 std::vector<std::unique_ptr<void, void (*)(void*)>> EventSystem::deletion_queue;
 std::mutex EventSystem::deletion_mutex;
 
 namespace {
+// Only registration hashes a type; everything after goes through the id it got here
+std::mutex event_type_mutex;
+std::unordered_map<std::type_index, uint32_t> event_type_ids;
+std::atomic<uint32_t> event_type_count = 0;
+}
+
+auto EventSystem::registerType(std::type_index type, void (*unsubscribe)(const std::any&)) noexcept -> uint32_t {
+	std::scoped_lock _(event_type_mutex);
+	auto [it, inserted] = event_type_ids.try_emplace(type, event_type_count.load(std::memory_order_relaxed));
+	if (not inserted) {
+		return it->second;
+	}
+
+	if (it->second >= max_event_types) {
+		TOAST_CRITICAL("Events", "Too many event types, {} doesn't fit in {}", type.name(), max_event_types);
+	}
+	TOAST_INFO("Events", "Registering Event Type: {} as {}", type.name(), it->second);
+	unsubscribers[it->second] = unsubscribe;
+	event_type_count.store(it->second + 1, std::memory_order_release);
+	return it->second;
+}
+
+auto EventSystem::typeCount() noexcept -> uint32_t {
+	return event_type_count.load(std::memory_order_acquire);
+}
+
+namespace _detail {
+struct CoalescedType {
+	uint64_t dropped = 0;
+};
+}
+
+namespace {
+struct CoalesceSlot {
+	const _detail::CoalescedType* type;
+	uint64_t key;
+
+	auto operator==(const CoalesceSlot&) const -> bool = default;
+};
+
+struct CoalesceSlotHash {
+	auto operator()(const CoalesceSlot& slot) const noexcept -> std::size_t {
+		return std::hash<const void*> {}(slot.type) ^ (slot.key * 0x9e3779b97f4a7c15ull);
+	}
+};
+}
+
+namespace _detail {
 struct Pool {
 	alignas(64) std::array<std::byte, 1024> buffer;
 	std::pmr::monotonic_buffer_resource pool;
-	std::vector<_detail::IEvent*> queue;
+	std::vector<IEvent*> queue;    ///< nullptr where a coalesced event was dropped
+	std::vector<uint32_t> types;   ///< Event<T>::id() of each queue entry, so dispatch finds runs without touching the events
+	std::unordered_map<CoalesceSlot, std::size_t, CoalesceSlotHash> latest;    ///< queue index of the newest per type and key
+	uint64_t coalesced = 0;
+	std::atomic<uint32_t> holds = 0;    ///< the dispatch, plus every inbox batch pointing into it
 
-	Pool() : pool(buffer.data(), buffer.size()) { }
+	Pool() : pool(buffer.data(), buffer.size(), toast::MemoryTracker::resource(toast::MemoryTag::events)) { }
 };
+}
+
+namespace {
+// A pool collects sends until pollEvents() swaps it out, then stays alive until every ThreadListener that
+// got some of its events has polled; there are as many as slow listeners need, reused from free_pools
+std::vector<std::unique_ptr<_detail::Pool>> pools;
+std::vector<_detail::Pool*> free_pools;
+_detail::Pool* current = nullptr;
+_detail::Pool* dispatching = nullptr;    ///< dispatch thread only
+std::vector<std::shared_ptr<_detail::Inbox>> staged_inboxes;    ///< dispatch thread only
+std::array<_detail::CoalescedType, EventSystem::max_event_types> coalesced_types;    ///< by type id, so every module gets the same one
+uint64_t coalesced_total = 0;
 
-std::array<Pool, 2> pools;
-uint8_t index = 0;
+/// @note pool_mutex held
+auto acquirePool() -> _detail::Pool* {
+	if (free_pools.empty()) {
+		return pools.emplace_back(std::make_unique<_detail::Pool>()).get();
+	}
+	_detail::Pool* pool = free_pools.back();
+	free_pools.pop_back();
+	return pool;
+}
 }
 
 namespace _detail {
 
-auto allocate(std::size_t size, std::size_t align) noexcept -> void* {
-	void* mem = pools[index].pool.allocate(size, align);
-	pools[index].queue.push_back(reinterpret_cast<IEvent*>(mem));
+auto allocate(std::size_t size, std::size_t align, uint32_t type) noexcept -> void* {
+	if (current == nullptr) {
+		current = acquirePool();
+	}
+	void* mem = current->pool.allocate(size, align);
+	current->queue.push_back(reinterpret_cast<IEvent*>(mem));
+	current->types.push_back(type);
 	return mem;
 }
 
+void releasePool(Pool* pool) noexcept {
+	if (pool->holds.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+		return;
+	}
+
+	for (IEvent* event : pool->queue) {
+		if (event != nullptr) {
+			std::destroy_at(event);
+		}
+	}
+	pool->queue.clear();
+	pool->types.clear();
+	pool->latest.clear();
+	pool->coalesced = 0;
+	pool->pool.release();
+
+	std::scoped_lock _(EventSystem::pool_mutex);
+	free_pools.push_back(pool);
+}
+
+void stage(const std::shared_ptr<Inbox>& inbox, IEvent& event) noexcept {
+	if (inbox->staging == nullptr) {
+		inbox->staging = new InboxBatch {.pool = dispatching};
+		staged_inboxes.push_back(inbox);
+	}
+	inbox->staging->events.push_back(&event);
+}
+
+auto coalescedType(uint32_t type) noexcept -> CoalescedType* {
+	return &coalesced_types[type];
+}
+
+void coalesce(CoalescedType* type, uint64_t key) noexcept {
+	const std::size_t slot = current->queue.size() - 1;
+	auto [it, inserted] = current->latest.try_emplace({type, key}, slot);
+	if (inserted) {
+		return;
+	}
+
+	// The dropped event's memory stays in the monotonic pool until the cycle ends
+	std::destroy_at(std::exchange(current->queue[it->second], nullptr));
+	it->second = slot;
+	++type->dropped;
+	++current->coalesced;
+	++coalesced_total;
+}
+
+auto coalescedCount(uint32_t type) noexcept -> uint64_t {
+	std::scoped_lock _(EventSystem::pool_mutex);
+	return coalesced_types[type].dropped;
+}
+
+}
+
+auto coalescedTotal() noexcept -> uint64_t {
+	std::scoped_lock _(EventSystem::pool_mutex);
+	return coalesced_total;
 }
 
 void pollEvents() noexcept {
@@ -57,22 +195,44 @@ void pollEvents() noexcept {
 	}
 
 	// swap memory pool
-	uint32_t idx;
 	{
 		std::scoped_lock _(EventSystem::pool_mutex);
-		idx = index;
-		index = (index + 1) % pools.size();
+		dispatching = current != nullptr ? current : acquirePool();
+		current = acquirePool();
+	}
+	dispatching->holds.store(1, std::memory_order_relaxed);
+
+	// notify events, a run of consecutive ones of the same type at a time; that's one channel lookup and a
+	// hot callback array for the whole run, without reordering anything. Dropped slots don't break a run
+	const auto& queue = dispatching->queue;
+	const auto& types = dispatching->types;
+	for (std::size_t first = 0; first < queue.size();) {
+		if (queue[first] == nullptr) {
+			++first;    // replaced by a newer one of the same type and key
+			continue;
+		}
+		std::size_t last = first + 1;
+		while (last < queue.size() and (types[last] == types[first] or queue[last] == nullptr)) {
+			++last;
+		}
+		queue[first]->notify(queue.data() + first, last - first);
+		first = last;
 	}
+	TracyPlot("Events coalesced", static_cast<int64_t>(dispatching->coalesced));
 
-	// notify events
-	for (auto& event : pools[idx].queue) {
-		event->notify();
-		std::destroy_at(event);
+	// ThreadListeners get their events only now that nothing here touches them anymore; each
+	// batch keeps the pool alive until its listener polls
+	for (auto& inbox : staged_inboxes) {
+		dispatching->holds.fetch_add(1, std::memory_order_relaxed);
+		inbox->publish();
 	}
+	staged_inboxes.clear();
+
+	// reset memory pool, unless a ThreadListener still has to read from it
+	_detail::releasePool(std::exchange(dispatching, nullptr));
 
-	// reset memory pool
-	pools[idx].queue.clear();
-	pools[idx].pool.release();
+	// everything C# subscribed to this poll goes out in one call
+	FfiChannel::get().publish();
 }
 
 namespace {
@@ -81,15 +241,18 @@ std::map<std::string, _detail::ProtoEntry, std::less<>> ffi_registry;
 std::vector<const std::string*> names;
 std::map<uint32_t, std::unique_ptr<Listener>> listeners;
 std::atomic<uint32_t> next_listener = 1;
+std::vector<uint32_t> batch_subscribers;    ///< events_batch_subscribe() count, by type id
 }
 
 namespace _detail {
 
 void registerProtoEntry(std::string name, ProtoEntry entry) {
 	std::scoped_lock lock {ffi_mutex};
+	entry.id = static_cast<uint32_t>(names.size());
 	auto [it, inserted] = ffi_registry.emplace(std::move(name), entry);
 	if (inserted) {
 		names.push_back(&it->first);
+		batch_subscribers.push_back(0);
 	}
 }
 
@@ -177,6 +340,45 @@ auto events_send(const char* name, const uint8_t* data, uint32_t size) noexcept
 	return entry.send(data, size);    // enqueue outside the lock
 }
 
+void events_batch_set_callback(event_batch_callback callback, void* user_data) noexcept {
+	event::FfiChannel::get().setCallback(callback, user_data);
+}
+
+auto events_batch_subscribe(const char* name) noexcept -> int {
+	if (!name) {
+		return -1;
+	}
+	std::scoped_lock lock(event::ffi_mutex);
+	auto it = event::ffi_registry.find(name);
+	if (it == event::ffi_registry.end()) {
+		return -1;
+	}
+	// One forwarding callback per type, whatever the number of C# handlers behind it
+	const uint32_t id = it->second.id;
+	if (event::batch_subscribers[id]++ == 0) {
+		it->second.forward(event::FfiChannel::get().listener(), id, name);
+	}
+	return static_cast<int>(id);
+}
+
+void events_batch_unsubscribe(const char* name) noexcept {
+	if (!name) {
+		return;
+	}
+	std::scoped_lock lock(event::ffi_mutex);
+	auto it = event::ffi_registry.find(name);
+	if (it == event::ffi_registry.end() or event::batch_subscribers[it->second.id] == 0) {
+		return;
+	}
+	if (--event::batch_subscribers[it->second.id] == 0) {
+		it->second.unsubscribe(event::FfiChannel::get().listener(), name);
+	}
+}
+
+void events_batch_release(uint64_t fence) noexcept {
+	event::FfiChannel::get().release(fence);
+}
+
 auto events_count(void) noexcept -> uint32_t {
 	std::scoped_lock lock(event::ffi_mutex);
 	return static_cast<uint32_t>(event::names.size());
@@ -9,6 +9,10 @@
 #pragma once
 
 #include <any>
+#include <array>
+#include <atomic>
+#include <concepts>
+#include <cstdint>
 #include <functional>
 #include <map>
 #include <memory>
@@ -35,19 +39,87 @@ namespace _detail {
 struct TOAST_API IEvent {
 	virtual ~IEvent() = default;
 
+	/// @brief Event<T>::id() of the dynamic type, without a typeid()
+	[[nodiscard]]
+	virtual auto eventId() const noexcept -> uint32_t = 0;
+
 #ifdef DEBUG
 	// std::stacktrace stacktrace;
 #endif
 
 private:
 	friend void TOAST_API event::pollEvents() noexcept;
-	virtual void notify() noexcept = 0;
+	/// @brief dispatches a run of @p count queued events of this one's type, starting with this one at @p events[0]
+	/// @note entries may be nullptr where a coalesced event was dropped
+	virtual void notify(IEvent* const* events, std::size_t count) noexcept = 0;
 };
 
-/// @brief allocates memory in the event queue pool
-auto TOAST_API allocate(std::size_t size, std::size_t align) noexcept -> void*;
+/// @brief allocates memory in the event queue pool for an event whose Event<T>::id() is @p type
+auto TOAST_API allocate(std::size_t size, std::size_t align, uint32_t type) noexcept -> void*;
+
+/// The arena one pollEvents() cycle allocates its events from
+struct Pool;
+
+/// @brief drops a hold on @p pool; the last one destroys its events and recycles it, from any thread
+void TOAST_API releasePool(Pool* pool) noexcept;
+
+/// Events pollEvents() handed to one ThreadListener; see thread-listener.hpp
+struct Inbox;
+
+/// @brief hands @p event to @p inbox by pointer once the running pollEvents() has dispatched every event
+/// @note dispatch thread only; @p event must be the one being dispatched
+void TOAST_API stage(const std::shared_ptr<Inbox>& inbox, IEvent& event) noexcept;
+
+/// Bookkeeping of one event type that coalesces
+struct CoalescedType;
+
+/// @brief the CoalescedType of the event type with Event<T>::id() @p type; stable, so send() looks it up once per type
+auto TOAST_API coalescedType(uint32_t type) noexcept -> CoalescedType*;
+
+/// @brief drops the queued event of @p type with the same @p key as the one allocated last, if any
+/// @note call with EventSystem::pool_mutex held, right after allocate()
+void TOAST_API coalesce(CoalescedType* type, uint64_t key) noexcept;
+
+/// @brief events of the type with Event<T>::id() @p type that coalesce() dropped since startup
+auto TOAST_API coalescedCount(uint32_t type) noexcept -> uint64_t;
 }
 
+/// @brief How send() merges events of one type that are queued for the same pollEvents()
+enum class Coalesce : uint8_t {
+	latest,    ///< only the newest one is dispatched
+	by_key,    ///< only the newest per key; the type defines `auto coalesceKey() const -> uint64_t`
+};
+
+/**
+ * @brief Satisfied by event types that opt into coalescing
+ *
+ * Meant for events that carry a snapshot, where only the newest value matters. Declare the policy
+ * inside the event:
+ * @code
+ * struct RequestHierarchyUpdate : Event<RequestHierarchyUpdate> {
+ *   static constexpr auto coalesce = Coalesce::latest;
+ * };
+ * @endcode
+ *
+ * Every send() of such a type drops the one already queued for this cycle (with the same key), and
+ * the surviving event is dispatched where the newest send() put it in the queue. Events sent during
+ * a pollEvents() belong to the next cycle and never replace the one being dispatched
+ */
+template<typename T>
+concept CoalescedEvent = requires {
+	{ T::coalesce } -> std::convertible_to<Coalesce>;
+};
+
+/// @brief how many sends of @p T were dropped for a newer one, since startup
+template<typename T>
+  requires CoalescedEvent<T>
+[[nodiscard]]
+auto coalesced() noexcept -> uint64_t;
+
+/// @brief how many sends of any type were dropped for a newer one, since startup
+[[nodiscard]]
+auto TOAST_API coalescedTotal() noexcept -> uint64_t;
+
 /// @brief queue's up an event
 /// @note events sent during a PollEvents will be send on the next PollEvents
 /// @param args arguments for the constructor
@@ -73,6 +145,9 @@ void send(Args&&... args) noexcept;
 /// on notify we rebuild the processing vector from the map and iterate that; this lets the user safely
 /// add or remove callbacks from within a callback itself
 ///
+/// Every type gets a dense id the first time it's used, which indexes its channel in EventSystem::channels;
+/// nothing on the send or dispatch path hashes a type
+///
 template<typename T>
 struct Event : _detail::IEvent {
 	friend class Listener;
@@ -83,11 +158,17 @@ struct Event : _detail::IEvent {
 	using callback_t = std::move_only_function<bool(T&)>;
 	using iterator_t = std::multimap<char, void*, std::greater<>>::iterator;
 
+	/// @brief dense index of T among the registered event types, the same in every module
+	/// @note registers T on first use; after that it's a static load
+	[[nodiscard]]
+	static auto id() noexcept -> uint32_t;
+
+	[[nodiscard]]
+	auto eventId() const noexcept -> uint32_t final;
+
 private:
 	Event() = default;
 
-	static void ensureRegistered() noexcept;
-
 	/// @brief registers a callback to the event callbacks
 	/// @param priority higher number callbacks first
 	/// @param callback
@@ -97,15 +178,16 @@ private:
 	/// @param it iterator to the callback the function will remove
 	static void unsubscribe(iterator_t it) noexcept;
 
-	/// @brief executes all of the callbacks in order from highest priority to lowest
-	void notify() noexcept override;
+	/// @brief executes all of the callbacks in order from highest priority to lowest, for each event of the run in turn
+	void notify(_detail::IEvent* const* events, std::size_t count) noexcept override;
 };
 
 /**
  * @brief Internal dispatch table for the event system
  *
- * One EventInfo entry exists per registered event type. Do not use this struct directly;
- * go through Listener::subscribe() to register callbacks and event::send() to enqueue events.
+ * One EventInfo channel exists per registered event type, at the index of its Event<T>::id(). Do not
+ * use this struct directly; go through Listener::subscribe() to register callbacks and event::send()
+ * to enqueue events.
  */
 struct TOAST_API EventSystem {
 	/**
@@ -114,23 +196,27 @@ struct TOAST_API EventSystem {
 	 * callbacks is a priority-sorted multimap from priority char to type-erased function pointer.
 	 * processing is a flat snapshot rebuilt from callbacks when cached is false; rebuilding
 	 * on-demand lets subscribers add or remove callbacks from within a callback without
-	 * invalidating iteration.
+	 * invalidating iteration. Only the dispatch thread writes processing, so notify() reads it
+	 * without taking the mutex while cached holds
 	 */
 	struct EventInfo {
 		std::mutex mutex;
 		std::multimap<char, void*, std::greater<>> callbacks;
 		std::vector<void*> processing;
-		bool cached = false;
+		std::atomic<bool> cached = false;
 	};
 
-	/// Dispatch table keyed by event type; one entry per registered event type
-	static std::unordered_map<std::type_index, EventInfo> event_data;
+	/// Event types a process can register; ids are handed out in order and never reused
+	static constexpr uint32_t max_event_types = 1024;
+
+	/// Dispatch table indexed by Event<T>::id(); fixed size, so a channel never moves while another type registers
+	static std::array<EventInfo, max_event_types> channels;
 
 	/// Protects the event queue memory pool during concurrent sends
 	static std::mutex pool_mutex;
 
-	/// Type-erased unsubscribe functions keyed by event type; used by Listener to erase iterators without the concrete type
-	static std::unordered_map<std::type_index, std::function<void(std::any)>> unsubscribe_map;
+	/// Type-erased unsubscribe functions indexed by Event<T>::id(); used by Listener to erase iterators without the concrete type
+	static std::array<void (*)(const std::any&), max_event_types> unsubscribers;
 
 	/// Deferred-delete queue; callbacks that unsubscribed during pollEvents are freed here on the next call
 	/// to avoid invalidating the processing vector mid-dispatch
@@ -139,25 +225,24 @@ struct TOAST_API EventSystem {
 	/// Protects the event queue memory pool during concurrent sends
 	static std::mutex deletion_mutex;
 
+	/// @brief event types registered so far; every id below it is taken
+	[[nodiscard]]
+	static auto typeCount() noexcept -> uint32_t;
+
 	template<typename T>
-	static void registerEvent() {
+	static auto registerEvent() noexcept -> uint32_t {
 		static_assert(std::is_base_of_v<Event<T>, T>, "CONTRACT VIOLATION: You Must Inhert as 'struct Derived : Event<Derived>'");
-		if (event_data.contains(typeid(T))) {
-			// guard against cross-DLL double-registration; same type can be registered from multiple translation units on Windows
-			return;
-		}
-		TOAST_INFO("Events", "Registering Event Type: {}", typeid(T).name());
-		event_data.emplace( // this is goofy because eventinfo has a mutex inside it
-		    std::piecewise_construct,
-		    std::forward_as_tuple(typeid(T)),
-		    std::forward_as_tuple()
-		);
-
-		EventSystem::unsubscribe_map.emplace(typeid(T), [](const std::any& iter) {
+		return registerType(typeid(T), [](const std::any& iter) {
 			auto it = std::any_cast<typename Event<T>::iterator_t>(iter);
 			Event<T>::unsubscribe(it);
 		});
 	}
+
+private:
+	/// @brief the id of @p type, assigning the next free one the first time it's seen
+	/// @note every module calls this once per type and gets the same id back; the same type can be registered
+	///       from multiple translation units and DLLs on Windows
+	static auto registerType(std::type_index type, void (*unsubscribe)(const std::any&)) noexcept -> uint32_t;
 };
 
 /**
@@ -191,7 +276,7 @@ concept ExposedEvent = requires(const T& e, const typename ProtoTraits<T>::Proto
 };
 
 // register all exposed events into a registry
-void registerProtoEvents();
+void TOAST_API registerProtoEvents();
 
 }
 
@@ -11,76 +11,86 @@ struct InspectorContent;
 struct InspectorLuaContent;
 
 template<typename T>
-void Event<T>::ensureRegistered() noexcept {
-	static const bool registered = [] {
-		EventSystem::registerEvent<T>();
-		return true;
-	}();
-	(void)registered;
+auto Event<T>::id() noexcept -> uint32_t {
+	static const uint32_t id = EventSystem::registerEvent<T>();
+	return id;
 }
 
 template<typename T>
-auto Event<T>::subscribe(char priority, callback_t&& callback) noexcept -> iterator_t {
-	ensureRegistered();
+auto Event<T>::eventId() const noexcept -> uint32_t {
+	return id();
+}
 
+template<typename T>
+auto Event<T>::subscribe(char priority, callback_t&& callback) noexcept -> iterator_t {
 	auto cb = new callback_t(std::move(callback));
-	auto& g = EventSystem::event_data[typeid(T)];
+	auto& g = EventSystem::channels[id()];
 	{
 		std::scoped_lock _(g.mutex);
-		g.cached = false;
+		g.cached.store(false, std::memory_order_relaxed);
 		return g.callbacks.emplace(priority, static_cast<void*>(cb));
 	}
 }
 
 template<typename T>
 void Event<T>::unsubscribe(iterator_t it) noexcept {
-	ensureRegistered();
-
-	auto& g = EventSystem::event_data[typeid(T)];
-	{
-		std::scoped_lock _(EventSystem::deletion_mutex);
-		auto deleter = [](void* p) { delete static_cast<std::move_only_function<bool(T&)>*>(p); };
-		EventSystem::deletion_queue.emplace_back((*it).second, deleter);
-	}
+	auto& g = EventSystem::channels[id()];
+	void* callback = (*it).second;
 	{
 		std::scoped_lock _(g.mutex);
-		g.cached = false;
+		g.cached.store(false, std::memory_order_relaxed);
 		g.callbacks.erase(it);
 	}
+	// Queued only once the channel is dirty, so the pollEvents() that frees it is sure to rebuild processing
+	{
+		std::scoped_lock _(EventSystem::deletion_mutex);
+		auto deleter = [](void* p) { delete static_cast<std::move_only_function<bool(T&)>*>(p); };
+		EventSystem::deletion_queue.emplace_back(callback, deleter);
+	}
 }
 
 template<typename T>
-void Event<T>::notify() noexcept {
+void Event<T>::notify(_detail::IEvent* const* events, std::size_t count) noexcept {
 	ZoneScoped;
+	ZoneValue(count);
 
-	ensureRegistered();
+	auto& g = EventSystem::channels[id()];
+	for (std::size_t i = 0; i < count; ++i) {
+		if (events[i] == nullptr) {
+			continue;    // replaced by a newer one of the same type and key
+		}
 
-	auto& g = EventSystem::event_data[typeid(T)];
-	{
-		// build cached list of all the callbacks in order
-		// locks mutex for the shortest period possible
-		// improves cache locality
-		std::scoped_lock _(g.mutex);
-		if (not g.cached) {
-			g.cached = true;
-			g.processing.clear();
-			for (auto& [priority, callback] : g.callbacks) {
-				g.processing.emplace_back(callback);
+		// checked per event, so a callback subscribed while handling one sees the next
+		if (not g.cached.load(std::memory_order_acquire)) {
+			// build cached list of all the callbacks in order
+			// locks mutex for the shortest period possible
+			// improves cache locality
+			std::scoped_lock _(g.mutex);
+			if (not g.cached.load(std::memory_order_relaxed)) {
+				g.cached.store(true, std::memory_order_release);
+				g.processing.clear();
+				for (auto& [priority, callback] : g.callbacks) {
+					g.processing.emplace_back(callback);
+				}
 			}
 		}
-	}
 
-	// disptaches all of the callbacks
-	for (auto& callback : g.processing) {
-		ZoneScopedN("Callback dispatch");
-
-		bool handled = (*static_cast<callback_t*>(callback))(static_cast<T&>(*this));
-		if (handled) {
-			return;
+		// disptaches all of the callbacks
+		T& event = static_cast<T&>(*events[i]);
+		for (void* callback : g.processing) {
+			if ((*static_cast<callback_t*>(callback))(event)) {
+				break;
+			}
 		}
 	}
 }
 
+template<typename T>
+  requires CoalescedEvent<T>
+auto coalesced() noexcept -> uint64_t {
+	return _detail::coalescedCount(Event<T>::id());
+}
+
 template<typename T, typename... Args>
   requires std::is_base_of_v<_detail::IEvent, T>
 void send(Args&&... args) noexcept {
@@ -92,12 +102,30 @@ void send(Args&&... args) noexcept {
 		TOAST_TRACE("Events", "Sending event: {}", typeid(T).name());
 	}
 
+	_detail::CoalescedType* coalesced_type = nullptr;
+	if constexpr (CoalescedEvent<T>) {
+		static _detail::CoalescedType* const type = _detail::coalescedType(Event<T>::id());
+		coalesced_type = type;
+	}
+
 	// Allocate and enqueue event
 	{
 		std::scoped_lock _(EventSystem::pool_mutex);
-		void* memory = _detail::allocate(sizeof(T), alignof(T));
+		void* memory = _detail::allocate(sizeof(T), alignof(T), Event<T>::id());
 		assert(memory);
 		_detail::IEvent* event = new (memory) T(std::forward<Args>(args)...);
+		if constexpr (CoalescedEvent<T>) {
+			if constexpr (T::coalesce == Coalesce::by_key) {
+				static_assert(
+				    requires(const T& e) {
+					    { e.coalesceKey() } -> std::convertible_to<uint64_t>;
+				    }, "Coalesce::by_key events need 'auto coalesceKey() const -> uint64_t'"
+				);
+				_detail::coalesce(coalesced_type, static_cast<const T&>(*event).coalesceKey());
+			} else {
+				_detail::coalesce(coalesced_type, 0);
+			}
+		}
 #ifdef DEBUG
 		// TODO: event->stacktrace = std::stacktrace::current(1);
 #endif
@@ -0,0 +1,70 @@
+#include "ffi-channel.hpp"
+
+#include <tracy/Tracy.hpp>
+
+namespace event {
+
+auto FfiChannel::get() -> FfiChannel& {
+	// Never destroyed: its Listener would unsubscribe from event tables that may already be gone at exit
+	static auto* channel = new FfiChannel();
+	return *channel;
+}
+
+auto FfiChannel::append(uint32_t type, size_t size) -> uint8_t* {
+	Frame& frame = m_frames[m_open];
+	const auto offset = static_cast<uint32_t>(frame.data.size());
+	frame.records.push_back({.type = type, .offset = offset, .size = static_cast<uint32_t>(size)});
+	frame.data.resize(offset + size);
+	return frame.data.data() + offset;
+}
+
+auto FfiChannel::publish() -> bool {
+	Frame& frame = m_frames[m_open];
+	if (frame.records.empty()) {
+		return false;
+	}
+
+	ZoneScoped;
+	std::scoped_lock lock(m_callback_mutex);
+	if (m_callback == nullptr) {
+		frame.records.clear();
+		frame.data.clear();
+		return false;
+	}
+
+	// The frame after this one gets written next, so it must be free before this one goes out
+	const uint32_t next = (m_open + 1) % frames_in_flight;
+	if (m_frames[next].fence > m_released.load(std::memory_order_acquire)) {
+		++m_deferred;
+		return false;
+	}
+
+	frame.fence = ++m_fence;
+	const event_batch batch {
+		.fence = frame.fence,
+		.records = frame.records.data(),
+		.count = static_cast<uint32_t>(frame.records.size()),
+		.data = frame.data.data(),
+		.size = frame.data.size(),
+	};
+	m_callback(&batch, m_user_data);
+
+	m_open = next;
+	m_frames[next].records.clear();
+	m_frames[next].data.clear();
+	return true;
+}
+
+void FfiChannel::release(uint64_t fence) noexcept {
+	uint64_t released = m_released.load(std::memory_order_relaxed);
+	while (fence > released and not m_released.compare_exchange_weak(released, fence, std::memory_order_release)) { }
+}
+
+void FfiChannel::setCallback(event_batch_callback callback, void* user_data) {
+	std::scoped_lock lock(m_callback_mutex);
+	m_callback = callback;
+	m_user_data = user_data;
+	release(m_fence);
+}
+
+}
@@ -0,0 +1,105 @@
+/**
+ * @file ffi-channel.hpp
+ * @author Xein
+ * @date 18 Oct 2026
+ *
+ * @brief Per-frame batches of serialized events handed to the C# side in one call
+ */
+#pragma once
+
+#include "ffi/events.h"
+#include "listener.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <toast/export.hpp>
+#include <vector>
+
+namespace event {
+
+/**
+ * @brief Serializes every C#-bound event once and delivers a whole frame of them in one call
+ *
+ * A subscribed event type gets a single native callback, however many C# handlers want it. That
+ * callback serializes the event straight into the open frame's arena, tagged with the type's
+ * index in events_name(). pollEvents() then publishes the frame: the batch callback receives
+ * every record at once, pointing into the arena. The arena is left untouched until the C# side
+ * releases the batch's fence.
+ *
+ * Frames cycle through frames_in_flight arenas. When the next one is still fenced, the open frame
+ * keeps collecting and goes out with a later poll, so a stalled reader delays events but never
+ * loses them or sees its memory reused
+ */
+class TOAST_API FfiChannel {
+public:
+	static constexpr uint32_t frames_in_flight = 3;
+
+	FfiChannel() = default;
+	FfiChannel(const FfiChannel&) = delete;
+	auto operator=(const FfiChannel&) -> FfiChannel& = delete;
+
+	/// The channel events_batch_*() and pollEvents() use
+	static auto get() -> FfiChannel&;
+
+	/// @brief Reserves @p size bytes for one event of @p type in the open frame; serialize the event there
+	/// @note Dispatch thread only, like every callback that calls it
+	[[nodiscard]]
+	auto append(uint32_t type, size_t size) -> uint8_t*;
+
+	/// @brief Hands the open frame to the batch callback, if it has anything and the next arena is free
+	/// @returns whether a batch went out
+	auto publish() -> bool;
+
+	/// @brief Frees the arenas of every batch up to @p fence for reuse; any thread
+	void release(uint64_t fence) noexcept;
+
+	/**
+	 * @brief Sets who gets the batches; nullptr stops publishing and drops what's collected
+	 *
+	 * Waits for a batch call in progress. Batches the previous callback never released are
+	 * considered released, since nobody is left to do it
+	 */
+	void setCallback(event_batch_callback callback, void* user_data);
+
+	/// Owns the per-type callbacks that feed the channel; see events_batch_subscribe()
+	[[nodiscard]]
+	auto listener() -> Listener& {
+		return m_listener;
+	}
+
+	/// Batches delivered so far
+	[[nodiscard]]
+	auto published() const noexcept -> uint64_t {
+		return m_fence;
+	}
+
+	/// Polls that held their frame back because every other arena was still fenced
+	[[nodiscard]]
+	auto deferred() const noexcept -> uint64_t {
+		return m_deferred;
+	}
+
+private:
+	struct Frame {
+		std::vector<event_record> records;
+		std::vector<uint8_t> data;
+		uint64_t fence = 0;    ///< of the batch that last used this arena; free once released
+	};
+
+	std::array<Frame, frames_in_flight> m_frames;
+	uint32_t m_open = 0;
+	uint64_t m_fence = 0;
+	uint64_t m_deferred = 0;
+	std::atomic<uint64_t> m_released = 0;
+
+	std::mutex m_callback_mutex;
+	event_batch_callback m_callback = nullptr;
+	void* m_user_data = nullptr;
+
+	Listener m_listener;
+};
+
+}
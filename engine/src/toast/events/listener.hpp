@@ -9,10 +9,10 @@
 
 #include <any>
 #include <cassert>
+#include <cstdint>
 #include <string>
 #include <string_view>
 #include <type_traits>
-#include <typeindex>
 #include <vector>
 
 namespace event {
@@ -40,7 +40,7 @@ class TOAST_API Listener {
 	/// std::any is a type-erased Event<T>::iterator_t; std::any so Handle doesn't need to be templated; safe because
 	/// std::multimap never invalidates iterators on insert/erase
 	struct Handle {
-		std::type_index type;
+		uint32_t type;    ///< Event<T>::id()
 		std::string name;
 		std::any iterator;
 	};
@@ -11,7 +11,7 @@ void Listener::unsubscribe(std::string_view name) noexcept {
 	TOAST_TRACE("Events", "Unsubscribing Callback {} to {}", name, typeid(TEvent).name());
 	std::erase_if(m.callbacks, [&](auto& callback) {
 		auto& [type, sub_name, any] = callback;
-		if (typeid(TEvent) == type && name == sub_name) {
+		if (Event<TEvent>::id() == type && name == sub_name) {
 			auto any_val = std::any_cast<typename Event<TEvent>::iterator_t>(any);
 			Event<TEvent>::unsubscribe(any_val);
 			return true;
@@ -41,7 +41,7 @@ void Listener::subscribe(std::string name, F&& callback, char priority) noexcept
 	};
 
 	auto it = Event<TEvent>::subscribe(priority, std::move(wrapper));
-	m.callbacks.push_back({typeid(TEvent), std::move(name), it});
+	m.callbacks.push_back({Event<TEvent>::id(), std::move(name), it});
 }
 
 template<typename TEvent, EventCallback<TEvent&> F>
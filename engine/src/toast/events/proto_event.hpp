@@ -8,10 +8,12 @@
 #pragma once
 
 #include "event.hpp"
+#include "ffi-channel.hpp"
 #include "ffi/events.h"
 #include "listener.hpp"
 
 #include <cstdint>
+#include <limits>
 #include <string>
 #include <vector>
 
@@ -23,8 +25,9 @@ namespace _detail {
  * @brief Dispatch table for one protobuf-backed event type over the FFI
  *
  * Populated by registerProtoEvent<T>() and stored in the proto registry.
- * The three function pointers cover the three directions of the FFI bridge:
- * sending from C#, subscribing from C#, and cancelling a subscription.
+ * The function pointers cover the directions of the FFI bridge: sending from C#,
+ * subscribing from C# one callback at a time or through the FfiChannel batches,
+ * and cancelling a subscription.
  */
 struct ProtoEntry {
 	int (*send)(const uint8_t* data, uint32_t size);      ///< C# -> engine: deserializes bytes and dispatches the event
@@ -32,6 +35,8 @@ struct ProtoEntry {
 	    Listener&, event_callback, void* user_data, char priority, const char* label
 	);                                                    ///< engine -> C#: serializes the event and calls the C# callback
 	void (*unsubscribe)(Listener&, const char* label);    ///< cancels a subscription by label
+	void (*forward)(Listener&, uint32_t type, const char* label);    ///< engine -> C#: serializes the event into FfiChannel
+	uint32_t id = 0;    ///< index in events_name(), set by registerProtoEntry()
 };
 
 /// Inserts a ProtoEntry into the global proto registry under the protobuf message name
@@ -60,10 +65,10 @@ void registerProtoEvent() {
 		      l.subscribe<T>(
 		          std::string {label},
 		          [callback, user_data](T& ev) -> bool {
+			          static const std::string name {Proto::descriptor()->full_name()};
 			          try {
 				          Proto p = Traits::toProto(ev);
 				          std::string bytes = p.SerializeAsString();
-				          std::string name {Proto::descriptor()->full_name()};
 				          return callback(
 				                     name.c_str(),
 				                     reinterpret_cast<const uint8_t*>(bytes.data()),
@@ -80,6 +85,24 @@ void registerProtoEvent() {
 		      );
 	      },
 	  .unsubscribe = [](Listener& l, const char* label) { l.unsubscribe<T>(std::string_view {label}); },
+	  .forward =
+	      [](Listener& l, uint32_t type, const char* label) {
+		      // Lowest priority, so native listeners still get to consume the event before it's serialized
+		      l.subscribe<T>(
+		          std::string {label},
+		          [type](T& ev) -> bool {
+			          try {
+				          Proto p = Traits::toProto(ev);
+				          const size_t size = p.ByteSizeLong();
+				          p.SerializeWithCachedSizesToArray(FfiChannel::get().append(type, size));
+			          } catch (const std::exception& e) {
+				          TOAST_WARN("Events", "Failed to serialize event {}: {}", Proto::descriptor()->full_name(), e.what());
+			          }
+			          return false;
+		          },
+		          std::numeric_limits<char>::min()
+		      );
+	      },
 	};
 
 	_detail::registerProtoEntry(std::string {Proto::descriptor()->full_name()}, entry);
@@ -4,69 +4,96 @@
 
 #include <mutex>
 #include <ranges>
+#include <tracy/Tracy.hpp>
+#include <utility>
 
 namespace event {
 
+namespace _detail {
+
+Inbox::~Inbox() {
+	for (InboxBatch* batch = take(); batch != nullptr;) {
+		release(std::exchange(batch, batch->next));
+	}
+}
+
+void Inbox::publish() noexcept {
+	InboxBatch* batch = std::exchange(staging, nullptr);
+	batch->next = published.load(std::memory_order_relaxed);
+	while (not published.compare_exchange_weak(batch->next, batch, std::memory_order_release, std::memory_order_relaxed)) { }
+}
+
+auto Inbox::take() noexcept -> InboxBatch* {
+	// Published newest first; reverse so events come out in the order they were sent
+	InboxBatch* newest = published.exchange(nullptr, std::memory_order_acquire);
+	InboxBatch* oldest = nullptr;
+	while (newest != nullptr) {
+		InboxBatch* next = newest->next;
+		newest->next = oldest;
+		oldest = newest;
+		newest = next;
+	}
+	return oldest;
+}
+
+void Inbox::release(InboxBatch* batch) noexcept {
+	releasePool(batch->pool);
+	delete batch;
+}
+
+}
+
 ThreadListener::ThreadListener() {
+	m.inbox = std::make_shared<_detail::Inbox>();
 	m.enabled = new std::atomic<bool>(true);
 }
 
 ThreadListener::ThreadListener(bool state) {
+	m.inbox = std::make_shared<_detail::Inbox>();
 	m.enabled = new std::atomic<bool>(state);
 }
 
 ThreadListener::~ThreadListener() {
 	m.enabled->store(false);
 	for (auto& [type, iterator] : m.recievers) {
-		EventSystem::unsubscribe_map[type](iterator);
-	}
-	{
-		std::scoped_lock lock(m.queue_mutex);
-		for (auto* event : m.event_queue) {
-			delete event;
-		}
+		EventSystem::unsubscribers[type](iterator);
 	}
 	{
 		std::scoped_lock _(EventSystem::deletion_mutex);
 		auto deleter = [](void* p) { delete static_cast<std::atomic<bool>*>(p); };
 		EventSystem::deletion_queue.emplace_back(m.enabled, deleter);
 	}
+	// The inbox itself goes once the recievers are deleted, releasing whatever they still publish
 }
 
 void ThreadListener::clear() {
 	bool state = m.enabled->exchange(false);
 	for (auto& [type, iterator] : m.recievers) {
-		EventSystem::unsubscribe_map[type](iterator);
+		EventSystem::unsubscribers[type](iterator);
 	}
 	m.recievers.clear();
 	m.callbacks.clear();
-	{
-		std::scoped_lock lock(m.queue_mutex);
-		for (auto* event : m.event_queue) {
-			delete event;
-		}
-		m.event_queue.clear();
+	for (_detail::InboxBatch* batch = m.inbox->take(); batch != nullptr;) {
+		_detail::Inbox::release(std::exchange(batch, batch->next));
 	}
 	m.enabled->store(state);
 }
 
 void ThreadListener::pollEvents() {
-	std::vector<_detail::IEvent*> temp_queue;
-	{
-		std::scoped_lock lock(m.queue_mutex);
-		temp_queue = std::move(m.event_queue);
-		m.event_queue.clear();
-	}
+	ZoneScoped;
 
-	for (auto* event : temp_queue) {
-		for (auto& cb_handle : std::views::values(m.callbacks)) {
-			if (cb_handle.type == typeid(*event)) {
-				if (cb_handle.callback(*event)) {
-					break;
+	for (_detail::InboxBatch* batch = m.inbox->take(); batch != nullptr;) {
+		for (const _detail::IEvent* event : batch->events) {
+			const uint32_t type = event->eventId();
+			for (auto& cb_handle : std::views::values(m.callbacks)) {
+				if (cb_handle.type == type) {
+					if (cb_handle.callback(*event)) {
+						break;
+					}
 				}
 			}
 		}
-		delete event;
+		_detail::Inbox::release(std::exchange(batch, batch->next));
 	}
 }
 
@@ -8,29 +8,77 @@
 #include "listener.hpp"
 
 #include <any>
+#include <atomic>
 #include <cassert>
+#include <cstdint>
 #include <map>
-#include <mutex>
+#include <memory>
 #include <string>
 #include <string_view>
-#include <typeindex>
 #include <vector>
 
 namespace event {
 
+/// @internal
+namespace _detail {
+
+/// @internal
+/// Events of one pollEvents() cycle for one ThreadListener; they live in that cycle's pool, which
+/// the batch holds until it's released
+struct InboxBatch {
+	InboxBatch* next = nullptr;
+	Pool* pool = nullptr;
+	std::vector<IEvent*> events;
+};
+
+/// @internal
+/// @brief Lock-free inbox of a ThreadListener
+///
+/// The dispatch thread stages events into a batch while pollEvents() runs and publishes it with a
+/// single push once every main-thread callback is done with them, so the listener's thread never
+/// reads an event something else may still write. The listener's thread takes everything published
+/// with a single exchange
+struct TOAST_API Inbox {
+	std::atomic<InboxBatch*> published = nullptr;    ///< newest first
+	InboxBatch* staging = nullptr;                   ///< dispatch thread only
+
+	Inbox() = default;
+	Inbox(const Inbox&) = delete;
+	auto operator=(const Inbox&) -> Inbox& = delete;
+	~Inbox();
+
+	/// @brief makes the staged batch visible to the listener's thread
+	void publish() noexcept;
+
+	/// @brief takes every published batch, oldest first; give each back with release()
+	[[nodiscard]]
+	auto take() noexcept -> InboxBatch*;
+
+	/// @brief drops the batch's hold on its pool and frees it
+	static void release(InboxBatch* batch) noexcept;
+};
+
+}
+
+/**
+ * @brief Listener whose callbacks run on whichever thread calls its pollEvents()
+ *
+ * Events reach it without a copy: pollEvents() hands out pointers to the events in its pool, and
+ * the pool stays alive until every ThreadListener that got some of them has polled. Several
+ * listeners may be reading the same event at once, so callbacks get it as const
+ */
 class TOAST_API ThreadListener {
-	using callback_t = std::move_only_function<bool(_detail::IEvent&)>;
+	using callback_t = std::move_only_function<bool(const _detail::IEvent&)>;
 
 	struct Handle {
-		std::type_index type;
+		uint32_t type;    ///< Event<T>::id()
 		std::string name;
 		callback_t callback;
 	};
 
 	struct {
-		std::vector<_detail::IEvent*> event_queue;                ///< @brief copied event queue
-		std::mutex queue_mutex;
-		std::map<std::type_index, std::any> recievers;            ///< @brief callbacks that add events to the event_queue
+		std::shared_ptr<_detail::Inbox> inbox;                    ///< @brief shared with the recievers, which may outlive us by a poll
+		std::map<uint32_t, std::any> recievers;                   ///< @brief callbacks that stage events into the inbox, by Event<T>::id()
 		std::multimap<char, Handle, std::greater<>> callbacks;    ///< @brief callbacks for the vents
 		std::atomic<bool>* enabled;                               ///< @brief enabled bool
 	} m;
@@ -52,13 +100,13 @@ public:
 	/// @param name of the callback
 	/// @param callback
 	/// @param priority (higher priority happens first)
-	template<typename TEvent, EventCallback<TEvent&> F>
+	template<typename TEvent, EventCallback<const TEvent&> F>
 	void subscribe(std::string name, F&& callback, char priority = 0) noexcept;
 
 	/// @brief subscribes a callback to an TEvent (name will be set to "unnamed")
 	/// @param callback
 	/// @param priority (higher priority happens first)
-	template<typename TEvent, EventCallback<TEvent&> F>
+	template<typename TEvent, EventCallback<const TEvent&> F>
 	void subscribe(F&& callback, char priority = 0) noexcept;
 
 	/// @brief enables/disables the callbacks in the listener
@@ -68,8 +116,8 @@ public:
 	[[nodiscard]]
 	auto enabled() const -> bool;
 
-	/// @brief iterates through the event_queue and calls the callbacks
-	/// @note this function must be ticked regularly
+	/// @brief calls the callbacks for every event the global pollEvents() handed over since the last call
+	/// @note this function must be ticked regularly; until it is, those cycles' pools stay allocated
 	void pollEvents();
 
 private:
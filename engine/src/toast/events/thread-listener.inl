@@ -13,61 +13,58 @@ void ThreadListener::unsubscribe(std::string_view name) noexcept {
 	std::erase_if(m.callbacks, [&](auto& pair) {
 		auto& [priority, handle] = pair;
 		auto& [type, sub_name, cb] = handle;
-		return typeid(TEvent) == type && name == sub_name;
+		return Event<TEvent>::id() == type && name == sub_name;
 	});
 }
 
-template<typename TEvent, EventCallback<TEvent&> F>
+template<typename TEvent, EventCallback<const TEvent&> F>
 void ThreadListener::subscribe(std::string name, F&& callback, char priority) noexcept {
 	TOAST_TRACE("Events", "Subscribing Callback {} to {}", name, typeid(TEvent).name());
 
-	callback_t cb = [fn = std::forward<F>(callback), enabled = m.enabled](_detail::IEvent& e) mutable -> bool {
+	callback_t cb = [fn = std::forward<F>(callback), enabled = m.enabled](const _detail::IEvent& e) mutable -> bool {
 		if (not enabled->load()) {
 			return false;
 		}
-		if constexpr (std::is_invocable_r_v<bool, F, TEvent&>) {    // Returns bool(T&)
-			return std::invoke(fn, static_cast<TEvent&>(e));
-		} else if constexpr (std::is_invocable_v<F, TEvent&>) {     // Returns void(T&)
-			std::invoke(fn, static_cast<TEvent&>(e));
+		if constexpr (std::is_invocable_r_v<bool, F, const TEvent&>) {    // Returns bool(const T&)
+			return std::invoke(fn, static_cast<const TEvent&>(e));
+		} else if constexpr (std::is_invocable_v<F, const TEvent&>) {     // Returns void(const T&)
+			std::invoke(fn, static_cast<const TEvent&>(e));
 			return false;
-		} else if constexpr (std::is_invocable_r_v<bool, F>) {      // Returns bool()
+		} else if constexpr (std::is_invocable_r_v<bool, F>) {            // Returns bool()
 			return std::invoke(fn);
-		} else {                                                    // Returns void()
+		} else {                                                          // Returns void()
 			std::invoke(fn);
 			return false;
 		}
 	};
 
-	m.callbacks.emplace(priority, Handle {typeid(TEvent), std::move(name), std::move(cb)});
+	m.callbacks.emplace(priority, Handle {Event<TEvent>::id(), std::move(name), std::move(cb)});
 	listen<TEvent>();
 }
 
-template<typename TEvent, EventCallback<TEvent&> F>
+template<typename TEvent, EventCallback<const TEvent&> F>
 void ThreadListener::subscribe(F&& callback, char priority) noexcept {
 	subscribe<TEvent>("unnamed", std::forward<F>(callback), priority);
 }
 
 template<typename TEvent>
 void ThreadListener::listen() noexcept {
-	if (m.recievers.contains(typeid(TEvent))) {
+	if (m.recievers.contains(Event<TEvent>::id())) {
 		return;
 	}
 
-	auto receiver_cb = [this, enabled = m.enabled](TEvent& e) -> bool {
+	// No copy: the inbox gets a pointer once pollEvents() is done with the event
+	auto receiver_cb = [inbox = m.inbox, enabled = m.enabled](TEvent& e) -> bool {
 		if (not enabled->load()) {
 			return false;
 		}
-		auto copy = new TEvent(e);
-		{
-			std::scoped_lock lock(m.queue_mutex);
-			m.event_queue.push_back(copy);
-		}
+		_detail::stage(inbox, e);
 		return false;
 	};
 
 	auto it = Event<TEvent>::subscribe(0, std::move(receiver_cb));
 
-	m.recievers.emplace(typeid(TEvent), it);
+	m.recievers.emplace(Event<TEvent>::id(), it);
 }
 
 }
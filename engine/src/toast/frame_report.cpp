@@ -0,0 +1,124 @@
+#include "frame_report.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <numeric>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#include <psapi.h>
+#elif defined(__linux__)
+#include <unistd.h>
+#endif
+
+namespace toast {
+
+namespace {
+
+auto reportColumn(std::string name, std::vector<double> values) -> FrameReport::Column {
+	FrameReport::Column column {.name = std::move(name)};
+	if (values.empty()) {
+		return column;
+	}
+
+	// Drift first, it needs the values in frame order
+	const size_t tenth = std::max<size_t>(1, values.size() / 10);
+	const double head = std::accumulate(values.begin(), values.begin() + tenth, 0.0) / static_cast<double>(tenth);
+	const double tail = std::accumulate(values.end() - tenth, values.end(), 0.0) / static_cast<double>(tenth);
+	column.drift_pct = head > 0.0 ? (tail - head) / head * 100.0 : 0.0;
+
+	std::ranges::sort(values);
+	const auto percentile = [&](double p) {
+		return values[std::min(values.size() - 1, static_cast<size_t>(p * static_cast<double>(values.size() - 1) + 0.5))];
+	};
+	column.p50 = percentile(0.50);
+	column.p99 = percentile(0.99);
+	column.max = values.back();
+	return column;
+}
+
+}
+
+FrameReport::FrameReport(std::vector<std::string> stage_names) : m_stage_names(std::move(stage_names)) { }
+
+void FrameReport::add(Frame frame) {
+	frame.stage_ms.resize(m_stage_names.size(), 0.0);
+	m_frames.push_back(std::move(frame));
+}
+
+auto FrameReport::summary() const -> std::vector<Column> {
+	const auto gather = [this](const std::function<double(const Frame&)>& field) {
+		std::vector<double> values;
+		values.reserve(m_frames.size());
+		for (const Frame& frame : m_frames) {
+			values.push_back(field(frame));
+		}
+		return values;
+	};
+
+	std::vector<Column> columns;
+	columns.push_back(reportColumn("frame_ms", gather([](const Frame& f) { return f.frame_ms; })));
+	columns.push_back(reportColumn("owners_ms", gather([](const Frame& f) { return f.owners_ms; })));
+	for (size_t i = 0; i < m_stage_names.size(); ++i) {
+		columns.push_back(reportColumn(m_stage_names[i], gather([i](const Frame& f) { return f.stage_ms[i]; })));
+	}
+	columns.push_back(reportColumn("visible", gather([](const Frame& f) { return static_cast<double>(f.visible); })));
+	columns.push_back(reportColumn("resident_kb", gather([](const Frame& f) { return static_cast<double>(f.resident_kb); })));
+	return columns;
+}
+
+auto FrameReport::writeCsv(const std::filesystem::path& path) const -> bool {
+	std::ofstream out(path, std::ios::trunc);
+	if (!out.is_open()) {
+		return false;
+	}
+
+	out << "frame,frame_ms,owners_ms";
+	for (const auto& name : m_stage_names) {
+		out << ',' << name;
+	}
+	out << ",visible,culled,resident_kb\n";
+
+	char buffer[32];
+	const auto number = [&](double value) {
+		std::snprintf(buffer, sizeof(buffer), "%.4f", value);
+		return buffer;
+	};
+	for (size_t i = 0; i < m_frames.size(); ++i) {
+		const Frame& frame = m_frames[i];
+		out << i << ',' << number(frame.frame_ms) << ',' << number(frame.owners_ms);
+		for (const double ms : frame.stage_ms) {
+			out << ',' << number(ms);
+		}
+		out << ',' << frame.visible << ',' << frame.culled << ',' << frame.resident_kb << '\n';
+	}
+	return static_cast<bool>(out);
+}
+
+auto FrameReport::residentKb() -> uint64_t {
+#ifdef _WIN32
+	PROCESS_MEMORY_COUNTERS counters {};
+	if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+		return counters.WorkingSetSize / 1024;
+	}
+	return 0;
+#elif defined(__linux__)
+	// statm: total and resident size in pages
+	std::ifstream statm("/proc/self/statm");
+	uint64_t total_pages = 0;
+	uint64_t resident_pages = 0;
+	if (statm >> total_pages >> resident_pages) {
+		return resident_pages * static_cast<uint64_t>(sysconf(_SC_PAGESIZE)) / 1024;
+	}
+	return 0;
+#else
+	return 0;
+#endif
+}
+
+}
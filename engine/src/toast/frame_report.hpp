@@ -0,0 +1,69 @@
+/**
+ * @file frame_report.hpp
+ * @author Xein
+ * @date 18 Oct 2026
+ *
+ * @brief Per-frame timings collected by headless runs, with percentiles and drift for CI and soak tests
+ */
+
+#pragma once
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <toast/export.hpp>
+#include <vector>
+
+namespace toast {
+
+/**
+ * @brief Records one row per frame and summarises them once the run is over
+ *
+ * Drift compares the mean of the last tenth of the run against the first tenth, so a soak run that
+ * slowly leaks memory or time shows up as a positive percentage on that column
+ */
+class TOAST_API FrameReport {
+public:
+	struct Frame {
+		double frame_ms = 0.0;            ///< wall time from one Engine::tick() to the next
+		double owners_ms = 0.0;           ///< every fixed step of every node owner
+		std::vector<double> stage_ms;     ///< one per frame stage, in StageGraph order
+		uint32_t visible = 0;             ///< meshes that survived culling
+		uint32_t culled = 0;
+		uint64_t resident_kb = 0;         ///< process working set after the frame
+	};
+
+	struct Column {
+		std::string name;
+		double p50 = 0.0;
+		double p99 = 0.0;
+		double max = 0.0;
+		double drift_pct = 0.0;
+	};
+
+	explicit FrameReport(std::vector<std::string> stage_names);
+
+	void add(Frame frame);
+
+	[[nodiscard]]
+	auto frames() const noexcept -> const std::vector<Frame>& {
+		return m_frames;
+	}
+
+	/// frame, owners, each stage, visible and resident memory, in that order
+	[[nodiscard]]
+	auto summary() const -> std::vector<Column>;
+
+	/// @brief Writes a header and one CSV row per frame; the summary is left to the caller
+	/// @returns false if the file couldn't be written
+	auto writeCsv(const std::filesystem::path& path) const -> bool;
+
+	/// Resident memory of this process in KiB, or 0 where the platform doesn't tell us
+	[[nodiscard]]
+	static auto residentKb() -> uint64_t;
+
+private:
+	std::vector<std::string> m_stage_names;
+	std::vector<Frame> m_frames;
+};
+
+}
@@ -20,6 +20,7 @@
 #include <toast/events/event.hpp>
 #include <toast/input/assets/input_action.hpp>
 #include <toast/log.hpp>
+#include <toast/replay.hpp>
 #include <toast/window/window_events.hpp>
 
 namespace input {
@@ -321,7 +322,13 @@ void InputSystem::tick() {
 	ctx.viewport_pos = m_viewport_position;
 	ctx.viewport_size = m_viewport_size;
 
-	auto sampler = [this](const KeyCode& key) { return sample(key); };
+	// Replays record and feed back what the actions see rather than raw device events
+	toast::Replay* replay = toast::Replay::get();
+	if (replay) {
+		ctx = replay->inputContext(ctx);
+	}
+
+	auto sampler = [this, replay](const KeyCode& key) { return replay ? replay->inputSample(sample(key)) : sample(key); };
 
 	for (auto& action : m_actions) {
 		const SignalList signals = action->evaluate(sampler, ctx);
@@ -8,12 +8,53 @@
 #pragma once
 #include "export.hpp"
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <cassert>
+#include <cstddef>
 #include <cstdint>
 #include <cstdlib>
+#include <cstring>
 #include <format>
+#include <memory>
+#include <string>
 #include <string_view>
 #include <tracy/Tracy.hpp>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#ifndef TOAST_LOG_MIN_SEVERITY
+/// Calls below this severity compile to nothing; set it through the CMake cache variable of the same name
+#define TOAST_LOG_MIN_SEVERITY 0
+#endif
+
+namespace logging {
+
+/// @brief Drops messages below @p severity, before they are formatted, for every sink without a level of its own
+void TOAST_API setLevel(uint8_t severity);
+
+/// @brief Gives @p sink its own level, above or below the global one
+void TOAST_API setLevel(std::string_view sink, uint8_t severity);
+
+/// @brief Makes @p sink follow the global level again
+void TOAST_API resetLevel(std::string_view sink);
+
+[[nodiscard]]
+auto TOAST_API level(std::string_view sink) noexcept -> uint8_t;
+
+/**
+ * @brief Argument types a log call may capture as raw bytes and format later on the logger thread
+ *
+ * Only types that own their value qualify; anything that points somewhere else (strings, views,
+ * pointers) would dangle by the time the message is formatted, so calls with those format where
+ * they are made. Specialise it for other trivially copyable value types to opt them in
+ */
+template<typename T>
+constexpr bool deferrable = std::is_arithmetic_v<T> or std::is_enum_v<T>;
+
+}
 
 /// @internal
 namespace logging::_detail {
@@ -27,33 +68,134 @@ constexpr auto getOnlyName(std::string_view path) -> std::string_view {
 
 void TOAST_API
     log(uint8_t severity, std::string_view file_name, unsigned line_number, std::string_view sink, std::string_view message);
-}
 
-#define TOAST_FILE_NAME ::logging::_detail::getOnlyName(__FILE__)
+/// Lowest of the global level and every sink's, so most filtered calls never look at the sink
+extern TOAST_API std::atomic<uint8_t> level_floor;
+/// Set while any sink has a level of its own
+extern TOAST_API std::atomic<bool> sink_levels;
 
+[[nodiscard]]
+auto TOAST_API sinkEnabled(uint8_t severity, std::string_view sink) noexcept -> bool;
+
+[[nodiscard]]
+inline auto enabled(uint8_t severity, std::string_view sink) noexcept -> bool {
+	if (severity < level_floor.load(std::memory_order_relaxed)) {
+		return false;
+	}
+	return not sink_levels.load(std::memory_order_relaxed) or sinkEnabled(severity, sink);
+}
+
+// Tracy gets info and above as text in debug builds, and errors are formatted where they happen so
+// the text is already out when TOAST_CRITICAL aborts
 #ifdef DEBUG
-#define TOAST_LOG_IMPL(severity, sink, ...)                                                                  \
-	do {                                                                                                       \
-		std::string toast_log_impl_message_ = std::format(__VA_ARGS__);                                          \
-		::logging::_detail::log(severity, TOAST_FILE_NAME, __LINE__, sink, toast_log_impl_message_);             \
-		constexpr uint32_t red = 0xFF0000;                                                                       \
-		constexpr uint32_t green = 0x00FF00;                                                                     \
-		constexpr uint32_t yellow = red | green; /* i love this so much -x */                                    \
-		switch (severity) {                                                                                      \
-			case 4:                                                                                                \
-			case 3: TracyMessageC(toast_log_impl_message_.c_str(), toast_log_impl_message_.size(), red); break;    \
-			case 2: TracyMessageC(toast_log_impl_message_.c_str(), toast_log_impl_message_.size(), yellow); break; \
-			case 1: TracyMessageC(toast_log_impl_message_.c_str(), toast_log_impl_message_.size(), green); break;  \
-			default: break;                                                                                        \
-		}                                                                                                        \
-	} while (0)
+constexpr uint8_t defer_below = 1;
 #else
-#define TOAST_LOG_IMPL(severity, sink, ...)                                                       \
-	do {                                                                                            \
-		::logging::_detail::log(severity, TOAST_FILE_NAME, __LINE__, sink, std::format(__VA_ARGS__)); \
-	} while (0)
+constexpr uint8_t defer_below = 3;
 #endif
 
+constexpr size_t deferred_capacity = 64;         ///< bytes of captured arguments
+constexpr size_t deferred_sink_capacity = 32;    ///< longer sink names are cut
+
+/// @brief Where each argument goes in DeferredLog::args, followed by the total size
+template<typename... Args>
+constexpr auto deferredOffsets() -> std::array<size_t, sizeof...(Args) + 1> {
+	std::array<size_t, sizeof...(Args) + 1> offsets {};
+	size_t offset = 0;
+	size_t i = 0;
+	((offset = (offset + alignof(Args) - 1) / alignof(Args) * alignof(Args), offsets[i++] = offset, offset += sizeof(Args)), ...);
+	offsets[i] = offset;
+	return offsets;
+}
+
+/// @brief A log call with its arguments captured as bytes; the format string's address identifies the call site
+struct DeferredLog {
+	using Formatter = auto (*)(std::string_view format, const std::byte* args) -> std::string;
+
+	std::string_view format;    ///< a constant expression, so it has static storage
+	Formatter formatter;        ///< knows the argument types, one per distinct argument list
+	std::string_view file;
+	unsigned line;
+	uint8_t severity;
+	uint8_t sink_size;
+	std::array<char, deferred_sink_capacity> sink;
+	int64_t timestamp;    ///< nanoseconds since the epoch, taken by logDeferred()
+	alignas(std::max_align_t) std::array<std::byte, deferred_capacity> args;
+
+	[[nodiscard]]
+	auto sinkName() const noexcept -> std::string_view {
+		return {sink.data(), sink_size};
+	}
+
+	[[nodiscard]]
+	auto message() const -> std::string {
+		return formatter(format, args.data());
+	}
+};
+
+void TOAST_API logDeferred(DeferredLog& record);
+
+template<typename... Args>
+auto formatDeferred(std::string_view format, const std::byte* bytes) -> std::string {
+	constexpr auto offsets = deferredOffsets<Args...>();
+	std::tuple<Args...> values;
+	[&]<size_t... I>(std::index_sequence<I...>) {
+		(std::memcpy(&std::get<I>(values), bytes + offsets[I], sizeof(Args)), ...);
+	}(std::index_sequence_for<Args...> {});
+	return std::apply([format](auto&... value) { return std::vformat(format, std::make_format_args(value...)); }, values);
+}
+
+template<uint8_t severity, typename... Args>
+void dispatch(std::string_view file, unsigned line, std::string_view sink, std::format_string<Args...> format, Args&&... args) {
+	if constexpr (severity < defer_below and (deferrable<std::remove_cvref_t<Args>> and ...) and
+	              deferredOffsets<std::remove_cvref_t<Args>...>().back() <= deferred_capacity) {
+		constexpr auto offsets = deferredOffsets<std::remove_cvref_t<Args>...>();
+		DeferredLog record;
+		record.format = format.get();
+		record.formatter = &formatDeferred<std::remove_cvref_t<Args>...>;
+		record.file = file;
+		record.line = line;
+		record.severity = severity;
+		record.sink_size = static_cast<uint8_t>(std::min(sink.size(), deferred_sink_capacity));
+		std::memcpy(record.sink.data(), sink.data(), record.sink_size);
+		[&]<size_t... I>(std::index_sequence<I...>) {
+			(std::memcpy(record.args.data() + offsets[I], std::addressof(args), sizeof(std::remove_cvref_t<Args>)), ...);
+		}(std::index_sequence_for<Args...> {});
+		logDeferred(record);
+	} else {
+		std::string message = std::format(format, std::forward<Args>(args)...);
+		log(severity, file, line, sink, message);
+#ifdef DEBUG
+		constexpr uint32_t red = 0xFF0000;
+		constexpr uint32_t green = 0x00FF00;
+		constexpr uint32_t yellow = red | green; /* i love this so much -x */
+		switch (severity) {
+			case 4:
+			case 3: TracyMessageC(message.c_str(), message.size(), red); break;
+			case 2: TracyMessageC(message.c_str(), message.size(), yellow); break;
+			case 1: TracyMessageC(message.c_str(), message.size(), green); break;
+			default: break;
+		}
+#endif
+	}
+}
+}
+
+#define TOAST_FILE_NAME ::logging::_detail::getOnlyName(__FILE__)
+
+/**
+ * Calls below TOAST_LOG_MIN_SEVERITY are discarded at compile time, arguments included. The rest
+ * check the runtime level of their sink before formatting anything, and calls whose arguments are
+ * all deferrable copy them as bytes and leave the formatting to the logger thread
+ */
+#define TOAST_LOG_IMPL(severity, sink, ...)                                                      \
+	do {                                                                                           \
+		if constexpr ((severity) >= TOAST_LOG_MIN_SEVERITY) {                                        \
+			if (::logging::_detail::enabled(severity, sink)) {                                         \
+				::logging::_detail::dispatch<severity>(TOAST_FILE_NAME, __LINE__, sink, __VA_ARGS__);    \
+			}                                                                                          \
+		}                                                                                            \
+	} while (0)
+
 /**
  * @param sink class logging the message
  * @param ... fmt formatted message
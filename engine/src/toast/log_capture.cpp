@@ -0,0 +1,76 @@
+#include "log_capture.hpp"
+
+#include <algorithm>
+#include <atomic>
+
+namespace logging {
+
+namespace {
+
+std::atomic<LogCapture*> active_log_capture = nullptr;
+
+}
+
+LogCapture::LogCapture(size_t capacity) : m_capacity(std::max<size_t>(capacity, 1)) {
+	m_slots.reserve(std::min<size_t>(m_capacity, 1024));
+	m_previous = active_log_capture.exchange(this, std::memory_order_acq_rel);
+}
+
+LogCapture::~LogCapture() {
+	active_log_capture.store(m_previous, std::memory_order_release);
+}
+
+auto LogCapture::current() noexcept -> LogCapture* {
+	return active_log_capture.load(std::memory_order_acquire);
+}
+
+void LogCapture::capture(uint8_t severity, std::string_view sink, std::string_view message) {
+	push(Entry {severity, std::string(sink), std::string(message)});
+}
+
+void LogCapture::capture(const _detail::DeferredLog& record) {
+	push(record);
+}
+
+void LogCapture::push(Slot slot) {
+	std::scoped_lock lock(m_mutex);
+	++m_count;
+	if (std::holds_alternative<_detail::DeferredLog>(slot)) {
+		++m_deferred;
+	}
+
+	if (m_slots.size() < m_capacity) {
+		m_slots.push_back(std::move(slot));
+		return;
+	}
+	m_slots[m_next] = std::move(slot);
+	m_next = (m_next + 1) % m_capacity;
+}
+
+auto LogCapture::entries() const -> std::vector<Entry> {
+	std::scoped_lock lock(m_mutex);
+	std::vector<Entry> out;
+	out.reserve(m_slots.size());
+	for (size_t i = 0; i < m_slots.size(); ++i) {
+		const Slot& slot = m_slots[(m_next + i) % m_slots.size()];
+		if (const auto* entry = std::get_if<Entry>(&slot)) {
+			out.push_back(*entry);
+		} else {
+			const auto& record = std::get<_detail::DeferredLog>(slot);
+			out.push_back({record.severity, std::string(record.sinkName()), record.message()});
+		}
+	}
+	return out;
+}
+
+auto LogCapture::count() const -> uint64_t {
+	std::scoped_lock lock(m_mutex);
+	return m_count;
+}
+
+auto LogCapture::deferredCount() const -> uint64_t {
+	std::scoped_lock lock(m_mutex);
+	return m_deferred;
+}
+
+}
@@ -0,0 +1,76 @@
+/**
+ * @file log_capture.hpp
+ * @author Xein
+ * @date 18 Oct 2026
+ * @brief Catches log messages in memory instead of sending them to the Logger, for tests and benchmarks
+ */
+
+#pragma once
+#include "export.hpp"
+#include "log.hpp"
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+namespace logging {
+
+/**
+ * @brief While alive, every TOAST_* call on every thread lands here rather than in the Logger
+ *
+ * Deferred calls are kept as their captured bytes and only formatted by entries(), the same way
+ * the Logger's drain job would. Captures nest; the newest one gets the messages and the previous
+ * one takes over again when it's destroyed
+ */
+class TOAST_API LogCapture {
+public:
+	struct Entry {
+		uint8_t severity;
+		std::string sink;
+		std::string message;
+	};
+
+	/// @param capacity most recent messages kept; older ones are dropped but still counted
+	explicit LogCapture(size_t capacity = 1024);
+	~LogCapture();
+
+	LogCapture(const LogCapture&) = delete;
+	auto operator=(const LogCapture&) -> LogCapture& = delete;
+
+	/// @internal the capture messages are routed to, if any
+	[[nodiscard]]
+	static auto current() noexcept -> LogCapture*;
+
+	/// Kept messages, oldest first, formatting the deferred ones
+	[[nodiscard]]
+	auto entries() const -> std::vector<Entry>;
+
+	/// Messages captured since creation, including dropped ones
+	[[nodiscard]]
+	auto count() const -> uint64_t;
+
+	/// How many of count() arrived as captured bytes instead of text
+	[[nodiscard]]
+	auto deferredCount() const -> uint64_t;
+
+	void capture(uint8_t severity, std::string_view sink, std::string_view message);
+	void capture(const _detail::DeferredLog& record);
+
+private:
+	using Slot = std::variant<Entry, _detail::DeferredLog>;
+
+	void push(Slot slot);
+
+	LogCapture* m_previous = nullptr;
+	size_t m_capacity;
+	mutable std::mutex m_mutex;
+	std::vector<Slot> m_slots;    ///< a ring once it reaches m_capacity
+	size_t m_next = 0;
+	uint64_t m_count = 0;
+	uint64_t m_deferred = 0;
+};
+
+}
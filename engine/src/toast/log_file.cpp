@@ -0,0 +1,141 @@
+#include "log_file.hpp"
+
+#include <algorithm>
+#include <format>
+#include <system_error>
+#include <utility>
+
+namespace logging {
+
+namespace {
+
+template<typename T>
+void putLittleEndian(std::byte* out, T value) {
+	for (size_t i = 0; i < sizeof(T); ++i) {
+		out[i] = static_cast<std::byte>(static_cast<uint64_t>(value) >> (i * 8));
+	}
+}
+
+template<typename T>
+auto getLittleEndian(const std::byte* in) -> T {
+	uint64_t value = 0;
+	for (size_t i = 0; i < sizeof(T); ++i) {
+		value |= static_cast<uint64_t>(in[i]) << (i * 8);
+	}
+	return static_cast<T>(value);
+}
+
+}
+
+void encodeLogRecord(const LogRecord& record, std::vector<std::byte>& out) {
+	const std::string_view sink = record.sink.substr(0, UINT8_MAX);
+	const std::string_view file = record.file.substr(0, UINT16_MAX);
+	const std::string_view message = record.message.substr(0, UINT32_MAX - log_record_header_size - sink.size() - file.size());
+	const size_t size = log_record_header_size + sink.size() + file.size() + message.size();
+
+	const size_t start = out.size();
+	out.resize(start + size);
+	std::byte* bytes = out.data() + start;
+	putLittleEndian(bytes + 0, static_cast<uint32_t>(size - sizeof(uint32_t)));
+	putLittleEndian(bytes + 4, record.timestamp);
+	putLittleEndian(bytes + 12, static_cast<uint32_t>(record.line));
+	putLittleEndian(bytes + 16, record.severity);
+	putLittleEndian(bytes + 17, static_cast<uint8_t>(sink.size()));
+	putLittleEndian(bytes + 18, static_cast<uint16_t>(file.size()));
+	putLittleEndian(bytes + 20, static_cast<uint32_t>(message.size()));
+
+	bytes += log_record_header_size;
+	for (const std::string_view text : {sink, file, message}) {
+		std::ranges::transform(text, bytes, [](char c) { return static_cast<std::byte>(c); });
+		bytes += text.size();
+	}
+}
+
+auto decodeLogRecord(std::span<const std::byte> bytes, size_t& offset) -> std::optional<LogRecord> {
+	if (bytes.size() < offset + log_record_header_size) {
+		return std::nullopt;
+	}
+
+	const std::byte* header = bytes.data() + offset;
+	const size_t size = sizeof(uint32_t) + getLittleEndian<uint32_t>(header);
+	const size_t sink_size = getLittleEndian<uint8_t>(header + 17);
+	const size_t file_size = getLittleEndian<uint16_t>(header + 18);
+	const size_t message_size = getLittleEndian<uint32_t>(header + 20);
+	if (bytes.size() - offset < size or size < log_record_header_size + sink_size + file_size + message_size) {
+		return std::nullopt;
+	}
+
+	const auto* text = reinterpret_cast<const char*>(header + log_record_header_size);
+	LogRecord record {
+		.timestamp = getLittleEndian<int64_t>(header + 4),
+		.line = getLittleEndian<uint32_t>(header + 12),
+		.severity = getLittleEndian<uint8_t>(header + 16),
+		.sink = {text, sink_size},
+		.file = {text + sink_size, file_size},
+		.message = {text + sink_size + file_size, message_size},
+	};
+	offset += size;
+	return record;
+}
+
+auto logFileHeader() -> std::array<std::byte, log_file_header_size> {
+	std::array<std::byte, log_file_header_size> header {};
+	std::ranges::transform(log_file_magic, header.begin(), [](char c) { return static_cast<std::byte>(c); });
+	putLittleEndian(header.data() + log_file_magic.size(), log_file_version);
+	return header;
+}
+
+LogFileSink::LogFileSink(std::filesystem::path directory, std::string name, uint64_t max_file_size, unsigned max_files)
+    : m_directory(std::move(directory)),
+      m_name(std::move(name)),
+      m_max_file_size(std::max<uint64_t>(max_file_size, log_file_header_size + log_record_header_size)),
+      m_max_files(std::max(max_files, 1u)) {
+	std::error_code ec;
+	std::filesystem::create_directories(m_directory, ec);
+	rotate();
+}
+
+void LogFileSink::write(std::span<const std::byte> record) {
+	if (m_file_size + record.size() > m_max_file_size and m_file_size > log_file_header_size) {
+		rotate();
+	}
+	if (not m_file.is_open()) {
+		return;
+	}
+
+	m_file.write(reinterpret_cast<const char*>(record.data()), static_cast<std::streamsize>(record.size()));
+	m_file_size += record.size();
+}
+
+void LogFileSink::flush() {
+	m_file.flush();
+}
+
+auto LogFileSink::path() const -> std::filesystem::path {
+	return rotatedPath(0);
+}
+
+auto LogFileSink::rotatedPath(unsigned index) const -> std::filesystem::path {
+	return m_directory / (index == 0 ? std::format("{}.tlog", m_name) : std::format("{}.{}.tlog", m_name, index));
+}
+
+void LogFileSink::rotate() {
+	m_file.close();
+
+	// Drop the oldest file and shift every other one up an index
+	std::error_code ec;
+	std::filesystem::remove(rotatedPath(m_max_files - 1), ec);
+	for (unsigned index = m_max_files - 1; index > 0; --index) {
+		std::filesystem::rename(rotatedPath(index - 1), rotatedPath(index), ec);
+	}
+
+	m_file.open(rotatedPath(0), std::ios::binary | std::ios::trunc);
+	m_file_size = 0;
+	if (m_file.is_open()) {
+		const auto header = logFileHeader();
+		m_file.write(reinterpret_cast<const char*>(header.data()), header.size());
+		m_file_size = header.size();
+	}
+}
+
+}
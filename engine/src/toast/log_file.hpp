@@ -0,0 +1,108 @@
+/**
+ * @file log_file.hpp
+ * @author Xein
+ * @date 18 Oct 2026
+ * @brief Compact binary log format (.tlog) and the rotating file sink that writes it
+ *
+ * A file starts with the 4 magic bytes "TLOG" and a little-endian uint16 version, padded to 8
+ * bytes. Records follow back to back, each one a 24-byte little-endian header and three strings:
+ *
+ * | offset | type | field                                   |
+ * |--------|------|-----------------------------------------|
+ * | 0      | u32  | record size, not counting these 4 bytes |
+ * | 4      | i64  | timestamp, nanoseconds since the epoch  |
+ * | 12     | u32  | line                                    |
+ * | 16     | u8   | severity, 0 trace to 4 critical         |
+ * | 17     | u8   | sink size                               |
+ * | 18     | u16  | file size                               |
+ * | 20     | u32  | message size                            |
+ * | 24     |      | sink, file and message bytes, UTF-8     |
+ *
+ * Readers skip whatever follows the known fields of a record, so later versions may append some
+ */
+
+#pragma once
+#include "export.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace logging {
+
+inline constexpr std::array<char, 4> log_file_magic {'T', 'L', 'O', 'G'};
+inline constexpr uint16_t log_file_version = 1;
+inline constexpr size_t log_file_header_size = 8;
+inline constexpr size_t log_record_header_size = 24;
+
+/// @brief One log entry; the strings are views, into the caller's data or into the decoded bytes
+struct LogRecord {
+	int64_t timestamp = 0;
+	unsigned line = 0;
+	uint8_t severity = 0;
+	std::string_view sink;       ///< cut to 255 bytes when encoded
+	std::string_view file;       ///< cut to 65535 bytes when encoded
+	std::string_view message;
+};
+
+/// @brief Appends @p record to @p out in the .tlog record layout
+void TOAST_API encodeLogRecord(const LogRecord& record, std::vector<std::byte>& out);
+
+/**
+ * @brief Reads the record at @p offset and moves @p offset past it
+ * @returns nullopt, leaving @p offset alone, when @p bytes ends before the record does
+ */
+[[nodiscard]]
+auto TOAST_API decodeLogRecord(std::span<const std::byte> bytes, size_t& offset) -> std::optional<LogRecord>;
+
+/// @brief The 8 bytes every .tlog file starts with
+[[nodiscard]]
+auto TOAST_API logFileHeader() -> std::array<std::byte, log_file_header_size>;
+
+/**
+ * @brief Writes encoded records to <directory>/<name>.tlog, rotating it by size
+ *
+ * Once the current file would grow past the size limit it becomes <name>.1.tlog, the previous
+ * <name>.1.tlog becomes <name>.2.tlog and so on; the oldest file past the count is deleted.
+ * Opening a sink rotates too, so the previous run's log survives as <name>.1.tlog
+ */
+class TOAST_API LogFileSink {
+public:
+	/// @param max_files files kept, the current one included
+	LogFileSink(std::filesystem::path directory, std::string name, uint64_t max_file_size, unsigned max_files);
+
+	/// @param record the bytes of one record, as encodeLogRecord() writes them
+	void write(std::span<const std::byte> record);
+	void flush();
+
+	[[nodiscard]]
+	auto path() const -> std::filesystem::path;
+
+	/// False when the directory or the file couldn't be opened; writes are dropped then
+	[[nodiscard]]
+	auto isOpen() const -> bool {
+		return m_file.is_open();
+	}
+
+private:
+	[[nodiscard]]
+	auto rotatedPath(unsigned index) const -> std::filesystem::path;
+
+	void rotate();
+
+	std::filesystem::path m_directory;
+	std::string m_name;
+	uint64_t m_max_file_size = 0;
+	unsigned m_max_files = 0;
+	std::ofstream m_file;
+	uint64_t m_file_size = 0;
+};
+
+}
@@ -0,0 +1,80 @@
+#include "log_ring.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+namespace logging {
+
+LogRing::LogRing(size_t capacity) {
+	const size_t size = std::bit_ceil(std::max(capacity, entry_header_size * 2));
+	m_storage = std::make_unique<std::byte[]>(size);
+	m_mask = size - 1;
+}
+
+auto LogRing::push(Kind kind, std::span<const std::byte> payload) noexcept -> bool {
+	const uint64_t size = entry_header_size + payload.size();
+	const uint64_t head = m_head.load(std::memory_order_relaxed);
+	if (size > capacity() - (head - m_cached_tail)) {
+		m_cached_tail = m_tail.load(std::memory_order_acquire);
+		if (size > capacity() - (head - m_cached_tail)) {
+			m_dropped.fetch_add(1, std::memory_order_relaxed);
+			return false;
+		}
+	}
+
+	const auto payload_size = static_cast<uint32_t>(payload.size());
+	copyIn(head, reinterpret_cast<const std::byte*>(&payload_size), sizeof(payload_size));
+	copyIn(head + sizeof(payload_size), reinterpret_cast<const std::byte*>(&kind), sizeof(kind));
+	copyIn(head + entry_header_size, payload.data(), payload.size());
+	m_head.store(head + size, std::memory_order_release);
+	return true;
+}
+
+auto LogRing::pop(Kind& kind, std::vector<std::byte>& payload) -> bool {
+	const uint64_t tail = m_tail.load(std::memory_order_relaxed);
+	if (tail == m_cached_head) {
+		m_cached_head = m_head.load(std::memory_order_acquire);
+		if (tail == m_cached_head) {
+			return false;
+		}
+	}
+
+	uint32_t payload_size = 0;
+	copyOut(tail, reinterpret_cast<std::byte*>(&payload_size), sizeof(payload_size));
+	copyOut(tail + sizeof(payload_size), reinterpret_cast<std::byte*>(&kind), sizeof(kind));
+	payload.resize(payload_size);
+	copyOut(tail + entry_header_size, payload.data(), payload_size);
+	m_tail.store(tail + entry_header_size + payload_size, std::memory_order_release);
+	return true;
+}
+
+auto LogRing::empty() const noexcept -> bool {
+	return m_head.load(std::memory_order_acquire) == m_tail.load(std::memory_order_acquire);
+}
+
+auto LogRing::takeDropped() noexcept -> uint64_t {
+	return m_dropped.exchange(0, std::memory_order_relaxed);
+}
+
+void LogRing::copyIn(uint64_t position, const std::byte* bytes, size_t size) noexcept {
+	if (size == 0) {
+		return;
+	}
+	const size_t offset = position & m_mask;
+	const size_t first = std::min(size, capacity() - offset);
+	std::memcpy(m_storage.get() + offset, bytes, first);
+	std::memcpy(m_storage.get(), bytes + first, size - first);
+}
+
+void LogRing::copyOut(uint64_t position, std::byte* bytes, size_t size) const noexcept {
+	if (size == 0) {
+		return;
+	}
+	const size_t offset = position & m_mask;
+	const size_t first = std::min(size, capacity() - offset);
+	std::memcpy(bytes, m_storage.get() + offset, first);
+	std::memcpy(bytes + first, m_storage.get(), size - first);
+}
+
+}
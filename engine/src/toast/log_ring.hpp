@@ -0,0 +1,89 @@
+/**
+ * @file log_ring.hpp
+ * @author Xein
+ * @date 18 Oct 2026
+ * @brief Bounded single-producer single-consumer byte ring the Logger hands entries through
+ */
+
+#pragma once
+#include "export.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace logging {
+
+/**
+ * @brief Fixed-size ring of variable-size entries, one thread pushing and one thread popping
+ *
+ * Neither side takes a lock or allocates: each owns one index and only reads the other's when
+ * its cached copy says the ring looks full (producer) or empty (consumer). When an entry doesn't
+ * fit, push() drops it and counts the drop instead of waiting or growing, so a thread that logs
+ * faster than the drain job keeps up never blocks and never uses more than capacity() bytes
+ */
+class TOAST_API LogRing {
+public:
+	enum class Kind : uint8_t {
+		record,      ///< an encoded LogRecord, see log_file.hpp
+		deferred,    ///< the bytes of a _detail::DeferredLog
+	};
+
+	/// Bytes each entry takes on top of its payload
+	static constexpr size_t entry_header_size = sizeof(uint32_t) + sizeof(Kind);
+
+	/// @param capacity in bytes, rounded up to a power of two
+	explicit LogRing(size_t capacity);
+
+	LogRing(const LogRing&) = delete;
+	auto operator=(const LogRing&) -> LogRing& = delete;
+
+	/// @brief Producer side. Copies @p payload in, or counts a drop and returns false when it doesn't fit
+	auto push(Kind kind, std::span<const std::byte> payload) noexcept -> bool;
+
+	/// @brief Consumer side. Copies the oldest entry into @p payload, replacing its contents
+	auto pop(Kind& kind, std::vector<std::byte>& payload) -> bool;
+
+	/// Safe from any thread, but only a hint unless called from the consumer
+	[[nodiscard]]
+	auto empty() const noexcept -> bool;
+
+	[[nodiscard]]
+	auto capacity() const noexcept -> size_t {
+		return m_mask + 1;
+	}
+
+	/// @brief Entries push() refused since the last call
+	auto takeDropped() noexcept -> uint64_t;
+
+	/// Marks the producer as gone; the consumer may free the ring once it popped what's left
+	void retire() noexcept {
+		m_retired.store(true, std::memory_order_release);
+	}
+
+	[[nodiscard]]
+	auto retired() const noexcept -> bool {
+		return m_retired.load(std::memory_order_acquire);
+	}
+
+private:
+	void copyIn(uint64_t position, const std::byte* bytes, size_t size) noexcept;
+	void copyOut(uint64_t position, std::byte* bytes, size_t size) const noexcept;
+
+	std::unique_ptr<std::byte[]> m_storage;
+	size_t m_mask = 0;
+
+	alignas(64) std::atomic<uint64_t> m_head = 0;    ///< bytes ever pushed, written by the producer
+	uint64_t m_cached_tail = 0;                      ///< the producer's last look at m_tail
+
+	alignas(64) std::atomic<uint64_t> m_tail = 0;    ///< bytes ever popped, written by the consumer
+	uint64_t m_cached_head = 0;                      ///< the consumer's last look at m_head
+
+	alignas(64) std::atomic<uint64_t> m_dropped = 0;
+	std::atomic<bool> m_retired = false;
+};
+
+}
@@ -0,0 +1,338 @@
+#include "log_shm.hpp"
+
+#include "log_file.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstring>
+#include <system_error>
+#include <utility>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace logging {
+
+// The header and entries are written as they are in memory; the layout promises little-endian
+static_assert(std::endian::native == std::endian::little);
+
+namespace {
+
+constexpr size_t log_shm_version_offset = 4;
+constexpr size_t log_shm_capacity_offset = 8;
+constexpr size_t log_shm_session_offset = 16;
+constexpr size_t log_shm_head_offset = 64;
+constexpr size_t log_shm_tail_offset = 128;
+constexpr size_t log_shm_written_offset = 192;
+constexpr size_t log_shm_refused_offset = 200;
+
+constexpr uint32_t log_shm_record = 0;
+constexpr uint32_t log_shm_padding = 1;
+
+/// Entries start 8-byte aligned, so a padding entry always has room for its size and kind
+constexpr uint64_t log_shm_alignment = 8;
+
+auto logShmWord(std::byte* header, size_t offset) -> std::atomic_ref<uint64_t> {
+	return std::atomic_ref(*reinterpret_cast<uint64_t*>(header + offset));
+}
+
+}
+
+namespace _detail {
+
+struct LogShmMapping {
+	std::byte* data = nullptr;
+	size_t size = 0;
+#ifdef _WIN32
+	HANDLE file = INVALID_HANDLE_VALUE;
+	HANDLE mapping = nullptr;
+#else
+	int file = -1;
+#endif
+
+	LogShmMapping() = default;
+	LogShmMapping(const LogShmMapping&) = delete;
+	auto operator=(const LogShmMapping&) -> LogShmMapping& = delete;
+
+	~LogShmMapping() {
+#ifdef _WIN32
+		if (data != nullptr) {
+			UnmapViewOfFile(data);
+		}
+		if (mapping != nullptr) {
+			CloseHandle(mapping);
+		}
+		if (file != INVALID_HANDLE_VALUE) {
+			CloseHandle(file);
+		}
+#else
+		if (data != nullptr) {
+			munmap(data, size);
+		}
+		if (file != -1) {
+			close(file);
+		}
+#endif
+	}
+
+	/// @brief Maps @p path read-write, creating it or resizing it to @p bytes
+	static auto create(const std::filesystem::path& path, size_t bytes) -> std::unique_ptr<LogShmMapping> {
+		auto mapping = std::make_unique<LogShmMapping>();
+		mapping->size = bytes;
+#ifdef _WIN32
+		mapping->file = CreateFileW(
+		    path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr,
+		    OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr
+		);
+		if (mapping->file == INVALID_HANDLE_VALUE) {
+			return nullptr;
+		}
+		mapping->mapping = CreateFileMappingW(
+		    mapping->file, nullptr, PAGE_READWRITE, static_cast<DWORD>(uint64_t(bytes) >> 32), static_cast<DWORD>(bytes), nullptr
+		);
+		if (mapping->mapping == nullptr) {
+			return nullptr;
+		}
+		mapping->data = static_cast<std::byte*>(MapViewOfFile(mapping->mapping, FILE_MAP_WRITE, 0, 0, bytes));
+#else
+		mapping->file = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+		if (mapping->file == -1 or ftruncate(mapping->file, static_cast<off_t>(bytes)) != 0) {
+			return nullptr;
+		}
+		void* data = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, mapping->file, 0);
+		mapping->data = data != MAP_FAILED ? static_cast<std::byte*>(data) : nullptr;
+#endif
+		return mapping->data != nullptr ? std::move(mapping) : nullptr;
+	}
+
+	/// @brief Maps all of @p path read-only
+	static auto open(const std::filesystem::path& path) -> std::unique_ptr<LogShmMapping> {
+		auto mapping = std::make_unique<LogShmMapping>();
+#ifdef _WIN32
+		mapping->file = CreateFileW(
+		    path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING,
+		    FILE_ATTRIBUTE_NORMAL, nullptr
+		);
+		LARGE_INTEGER size {};
+		if (mapping->file == INVALID_HANDLE_VALUE or not GetFileSizeEx(mapping->file, &size) or size.QuadPart == 0) {
+			return nullptr;
+		}
+		mapping->size = static_cast<size_t>(size.QuadPart);
+		mapping->mapping = CreateFileMappingW(mapping->file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (mapping->mapping == nullptr) {
+			return nullptr;
+		}
+		mapping->data = static_cast<std::byte*>(MapViewOfFile(mapping->mapping, FILE_MAP_READ, 0, 0, 0));
+#else
+		mapping->file = ::open(path.c_str(), O_RDONLY);
+		struct stat status {};
+		if (mapping->file == -1 or fstat(mapping->file, &status) != 0 or status.st_size == 0) {
+			return nullptr;
+		}
+		mapping->size = static_cast<size_t>(status.st_size);
+		void* data = mmap(nullptr, mapping->size, PROT_READ, MAP_SHARED, mapping->file, 0);
+		mapping->data = data != MAP_FAILED ? static_cast<std::byte*>(data) : nullptr;
+#endif
+		return mapping->data != nullptr ? std::move(mapping) : nullptr;
+	}
+};
+
+}
+
+LogShmWriter::LogShmWriter(std::filesystem::path path, size_t capacity)
+    : m_path(std::move(path)),
+      m_capacity(std::bit_ceil(std::max<uint64_t>(capacity, log_shm_entry_header_size + log_record_header_size))) {
+	std::error_code ec;
+	std::filesystem::create_directories(m_path.parent_path(), ec);
+	m_mapping = _detail::LogShmMapping::create(m_path, log_shm_header_size + m_capacity);
+	if (not m_mapping) {
+		return;
+	}
+
+	// A reader of the previous session notices the new one and starts over; head and tail go back to
+	// zero before the session changes, so it never pairs the new session with the old positions
+	std::byte* header = m_mapping->data;
+	logShmWord(header, log_shm_head_offset).store(0, std::memory_order_relaxed);
+	logShmWord(header, log_shm_tail_offset).store(0, std::memory_order_relaxed);
+	logShmWord(header, log_shm_written_offset).store(0, std::memory_order_relaxed);
+	logShmWord(header, log_shm_refused_offset).store(0, std::memory_order_relaxed);
+	logShmWord(header, log_shm_capacity_offset).store(m_capacity, std::memory_order_relaxed);
+	std::memcpy(header, log_shm_magic.data(), log_shm_magic.size());
+	std::memcpy(header + log_shm_version_offset, &log_shm_version, sizeof(log_shm_version));
+
+	const auto now = std::chrono::steady_clock::now().time_since_epoch().count();
+	const uint64_t previous = logShmWord(header, log_shm_session_offset).load(std::memory_order_relaxed);
+	logShmWord(header, log_shm_session_offset).store(std::max<uint64_t>(now, previous + 1), std::memory_order_release);
+}
+
+LogShmWriter::~LogShmWriter() = default;
+
+auto LogShmWriter::isOpen() const -> bool {
+	return m_mapping != nullptr;
+}
+
+auto LogShmWriter::write(std::span<const std::byte> record) noexcept -> bool {
+	if (not m_mapping) {
+		return false;
+	}
+
+	std::byte* header = m_mapping->data;
+	const uint64_t size = (log_shm_entry_header_size + record.size() + log_shm_alignment - 1) & ~(log_shm_alignment - 1);
+	if (size > m_capacity) {
+		logShmWord(header, log_shm_refused_offset).store(++m_refused, std::memory_order_release);
+		return false;
+	}
+
+	// Entries don't wrap, so one that doesn't fit before the end is preceded by padding up to it
+	const uint64_t room = m_capacity - (m_head & (m_capacity - 1));
+	if (size > room) {
+		reserve(m_head + room);
+		const auto padding = static_cast<uint32_t>(room);
+		std::memcpy(at(m_head), &padding, sizeof(padding));
+		std::memcpy(at(m_head) + sizeof(uint32_t), &log_shm_padding, sizeof(log_shm_padding));
+		m_head += room;
+	}
+
+	reserve(m_head + size);
+	std::byte* entry = at(m_head);
+	const auto entry_size = static_cast<uint32_t>(size);
+	std::memcpy(entry, &entry_size, sizeof(entry_size));
+	std::memcpy(entry + sizeof(uint32_t), &log_shm_record, sizeof(log_shm_record));
+	std::memcpy(entry + 2 * sizeof(uint32_t), &m_written, sizeof(m_written));
+	std::memcpy(entry + log_shm_entry_header_size, record.data(), record.size());
+	m_head += size;
+	++m_written;
+
+	logShmWord(header, log_shm_head_offset).store(m_head, std::memory_order_release);
+	logShmWord(header, log_shm_written_offset).store(m_written, std::memory_order_release);
+	return true;
+}
+
+auto LogShmWriter::at(uint64_t position) const noexcept -> std::byte* {
+	return m_mapping->data + log_shm_header_size + (position & (m_capacity - 1));
+}
+
+void LogShmWriter::reserve(uint64_t end) noexcept {
+	const uint64_t tail = m_tail;
+	while (end - m_tail > m_capacity) {
+		uint32_t entry_size = 0;
+		std::memcpy(&entry_size, at(m_tail), sizeof(entry_size));
+		m_tail += entry_size;
+	}
+	if (m_tail == tail) {
+		return;
+	}
+
+	// Readers check tail after copying an entry: the fence orders this store before the bytes that
+	// overwrite the entries it skips, so a reader that copied any of them also sees the new tail
+	logShmWord(m_mapping->data, log_shm_tail_offset).store(m_tail, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+}
+
+LogShmReader::LogShmReader(std::filesystem::path path) : m_path(std::move(path)) {
+	m_mapping = _detail::LogShmMapping::open(m_path);
+	if (not m_mapping) {
+		return;
+	}
+
+	const std::byte* header = m_mapping->data;
+	uint16_t version = 0;
+	std::memcpy(&version, header + log_shm_version_offset, sizeof(version));
+	m_capacity = logShmWord(m_mapping->data, log_shm_capacity_offset).load(std::memory_order_relaxed);
+	if (m_mapping->size < log_shm_header_size or std::memcmp(header, log_shm_magic.data(), log_shm_magic.size()) != 0 or
+	    version != log_shm_version or not std::has_single_bit(m_capacity) or m_mapping->size < log_shm_header_size + m_capacity) {
+		m_mapping.reset();
+	}
+}
+
+LogShmReader::~LogShmReader() = default;
+
+auto LogShmReader::isOpen() const -> bool {
+	return m_mapping != nullptr;
+}
+
+auto LogShmReader::read(std::vector<std::byte>& records) -> Result {
+	Result result;
+	if (not m_mapping) {
+		return result;
+	}
+
+	std::byte* header = m_mapping->data;
+	const std::byte* data = header + log_shm_header_size;
+	const uint64_t session = logShmWord(header, log_shm_session_offset).load(std::memory_order_acquire);
+	if (session != m_session) {
+		m_session = session;
+		m_position = 0;
+		m_sequence = 0;
+		m_refused = 0;
+	}
+
+	const uint64_t head = logShmWord(header, log_shm_head_offset).load(std::memory_order_acquire);
+	if (head < m_position) {
+		m_position = 0;    // the writer started over without us seeing the session change yet
+	}
+
+	while (m_position < head) {
+		const uint64_t tail = logShmWord(header, log_shm_tail_offset).load(std::memory_order_acquire);
+		m_position = std::max(m_position, tail);
+		if (m_position >= head) {
+			break;
+		}
+
+		const uint64_t offset = m_position & (m_capacity - 1);
+		uint32_t entry_size = 0;
+		uint32_t kind = 0;
+		std::memcpy(&entry_size, data + offset, sizeof(entry_size));
+		std::memcpy(&kind, data + offset + sizeof(uint32_t), sizeof(kind));
+		const bool sane = entry_size >= log_shm_alignment and entry_size % log_shm_alignment == 0 and
+		                  entry_size <= m_capacity - offset and (kind == log_shm_padding or entry_size >= log_shm_entry_header_size);
+		if (sane and kind == log_shm_record) {
+			m_entry.assign(data + offset, data + offset + entry_size);
+		}
+
+		// Anything copied above is only good if the writer hadn't moved tail past it by then
+		std::atomic_thread_fence(std::memory_order_acquire);
+		if (logShmWord(header, log_shm_tail_offset).load(std::memory_order_relaxed) > m_position) {
+			continue;
+		}
+		if (not sane) {
+			m_position = head;    // can't happen with an intact ring; skip to what comes next rather than spin
+			break;
+		}
+
+		m_position += entry_size;
+		if (kind != log_shm_record) {
+			continue;
+		}
+
+		uint64_t sequence = 0;
+		std::memcpy(&sequence, m_entry.data() + 2 * sizeof(uint32_t), sizeof(sequence));
+		const std::span<const std::byte> record = std::span(m_entry).subspan(log_shm_entry_header_size);
+		size_t decoded = 0;
+		if (sequence < m_sequence or not decodeLogRecord(record, decoded)) {
+			continue;
+		}
+		result.lost += sequence - m_sequence;
+		m_sequence = sequence + 1;
+		records.insert(records.end(), record.begin(), record.begin() + static_cast<std::ptrdiff_t>(decoded));
+		++result.records;
+	}
+
+	const uint64_t refused = logShmWord(header, log_shm_refused_offset).load(std::memory_order_acquire);
+	result.lost += refused - std::min(refused, m_refused);
+	m_refused = refused;
+	return result;
+}
+
+}
@@ -0,0 +1,128 @@
+/**
+ * @file log_shm.hpp
+ * @author Xein
+ * @date 18 Oct 2026
+ * @brief Shared-memory ring of .tlog records for log readers on the same host
+ *
+ * The ring is a memory-mapped file, so a reader can map it or just read it like any other file.
+ * Everything is little-endian; the header takes the first 256 bytes, the data area follows:
+ *
+ * | offset | type    | field                                                          |
+ * |--------|---------|----------------------------------------------------------------|
+ * | 0      | char[4] | magic "TSHM"                                                   |
+ * | 4      | u16     | version                                                        |
+ * | 8      | u64     | capacity, bytes of the data area; a power of two               |
+ * | 16     | u64     | session, changes every time a writer opens the file            |
+ * | 64     | u64     | head, bytes ever written; entries before it are complete       |
+ * | 128    | u64     | tail, where the oldest entry still in the ring starts          |
+ * | 192    | u64     | records written                                                |
+ * | 200    | u64     | records refused for being larger than the ring                 |
+ *
+ * Head and tail only grow; an entry at position p sits at p % capacity and never wraps around the
+ * end. Entries are 8-byte aligned: a u32 entry size counting padding, a u32 kind, 0 for a record
+ * and 1 for the padding that skips to the start of the data area, then for records a u64 sequence
+ * number and the record as encodeLogRecord() writes it
+ *
+ * There is one writer and it never waits for a reader: once the ring is full it moves tail past
+ * the oldest entries and overwrites them. Readers copy an entry and then check that tail hasn't
+ * passed it, retrying from tail when it has; a gap in the sequence numbers is what was lost
+ */
+
+#pragma once
+#include "export.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace logging {
+
+inline constexpr std::array<char, 4> log_shm_magic {'T', 'S', 'H', 'M'};
+inline constexpr uint16_t log_shm_version = 1;
+inline constexpr size_t log_shm_header_size = 256;
+inline constexpr size_t log_shm_entry_header_size = 16;
+
+namespace _detail {
+/// A file mapped into memory, closed with it
+struct LogShmMapping;
+}
+
+/// @brief The writing side of the ring; the Logger's drain job owns one when it logs to shared memory
+class TOAST_API LogShmWriter {
+public:
+	/// @param capacity in bytes, rounded up to a power of two
+	LogShmWriter(std::filesystem::path path, size_t capacity);
+	~LogShmWriter();
+
+	LogShmWriter(const LogShmWriter&) = delete;
+	auto operator=(const LogShmWriter&) -> LogShmWriter& = delete;
+
+	/// @param record the bytes of one record, as encodeLogRecord() writes them
+	/// @returns false when the record is larger than the ring, which is counted as refused
+	auto write(std::span<const std::byte> record) noexcept -> bool;
+
+	[[nodiscard]]
+	auto path() const -> const std::filesystem::path& {
+		return m_path;
+	}
+
+	/// False when the file couldn't be created or mapped; writes are dropped then
+	[[nodiscard]]
+	auto isOpen() const -> bool;
+
+private:
+	auto at(uint64_t position) const noexcept -> std::byte*;
+	void reserve(uint64_t end) noexcept;    ///< @brief Moves tail past whatever [head, end) is about to overwrite
+
+	std::filesystem::path m_path;
+	std::unique_ptr<_detail::LogShmMapping> m_mapping;
+	uint64_t m_capacity = 0;
+	uint64_t m_head = 0;
+	uint64_t m_tail = 0;
+	uint64_t m_written = 0;
+	uint64_t m_refused = 0;
+};
+
+/// @brief A reader of the ring, from this or any other process on the host
+class TOAST_API LogShmReader {
+public:
+	/// @brief What one read() found
+	struct Result {
+		uint64_t records = 0;    ///< appended to the caller's buffer
+		uint64_t lost = 0;       ///< overwritten before they were read, or refused by the writer
+	};
+
+	explicit LogShmReader(std::filesystem::path path);
+	~LogShmReader();
+
+	LogShmReader(const LogShmReader&) = delete;
+	auto operator=(const LogShmReader&) -> LogShmReader& = delete;
+
+	/**
+	 * @brief Appends every record written since the last call to @p records, oldest first
+	 *
+	 * The first call starts at the oldest record still in the ring; everything written before it
+	 * counts as lost. When the writer reopens the file the reader starts over with the new session
+	 */
+	auto read(std::vector<std::byte>& records) -> Result;
+
+	/// False when the file isn't there or isn't a ring
+	[[nodiscard]]
+	auto isOpen() const -> bool;
+
+private:
+	std::filesystem::path m_path;
+	std::unique_ptr<_detail::LogShmMapping> m_mapping;
+	uint64_t m_capacity = 0;
+	uint64_t m_session = 0;
+	uint64_t m_position = 0;
+	uint64_t m_sequence = 0;    ///< the one the next record should have
+	uint64_t m_refused = 0;     ///< the writer's refused count already reported
+	std::vector<std::byte> m_entry;
+};
+
+}
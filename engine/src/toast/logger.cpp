@@ -3,14 +3,20 @@
 #include "ffi/log.h"    // ffi
 #include "generated/logging.pb.h"
 #include "log.hpp"      // public functions
+#include "log_capture.hpp"
 #include "thread_pool.hpp"
 
+#include <algorithm>
 #include <chrono>
 #include <cstdlib>
+#include <cstring>
 #include <filesystem>
+#include <format>
 #include <iostream>
 #include <print>
 #include <tracy/Tracy.hpp>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #ifdef __linux__
@@ -26,18 +32,168 @@
 namespace logging {
 
 namespace {
-std::mutex fallback_database_mutex;
-std::vector<std::tuple<std::string, unsigned, char, std::string, std::string>> fallback_database;
+
+// Deferred records cross the rings as raw bytes
+static_assert(std::is_trivially_copyable_v<_detail::DeferredLog>);
+
+// Logs made before the Logger exists wait here for its first drain; these come from a handful
+// of threads at boot, so a mutex makes the ring safe to share without costing anything later
+constexpr size_t fallback_ring_size = 256 * 1024;
+std::mutex fallback_ring_mutex;
+
+auto fallbackRing() -> LogRing& {
+	// Function-local so static initializers in other files can already log
+	static LogRing ring(fallback_ring_size);
+	return ring;
+}
+
+// Each thread's ring is shared with the Logger, so it outlives whichever of the two goes first;
+// the thread only marks it retired on exit and the drain job frees it once it's empty
+struct LoggerThreadRing {
+	std::shared_ptr<LogRing> ring;
+	uint64_t generation = 0;
+
+	~LoggerThreadRing() {
+		if (ring) {
+			ring->retire();
+		}
+	}
+};
+
+thread_local LoggerThreadRing logger_thread_ring;
+std::atomic<uint64_t> logger_generations = 0;
+
+void pushLogRecord(LogRing& ring, const LogRecord& record) {
+	thread_local std::vector<std::byte> encoded;
+	encoded.clear();
+	encodeLogRecord(record, encoded);
+	ring.push(LogRing::Kind::record, encoded);
+}
+
+// Every ring is in order on its own; interleaving them by timestamp gives readers one timeline
+void sortLogRecords(std::vector<std::byte>& records, std::vector<std::byte>& sorted) {
+	thread_local std::vector<std::pair<int64_t, std::pair<size_t, size_t>>> order;
+	order.clear();
+	size_t start = 0;
+	size_t offset = 0;
+	bool in_order = true;
+	while (auto record = decodeLogRecord(records, offset)) {
+		in_order = in_order and (order.empty() or order.back().first <= record->timestamp);
+		order.push_back({record->timestamp, {start, offset - start}});
+		start = offset;
+	}
+	if (in_order) {
+		return;
+	}
+
+	std::ranges::stable_sort(order, {}, &std::pair<int64_t, std::pair<size_t, size_t>>::first);
+	sorted.clear();
+	for (const auto& [timestamp, range] : order) {
+		sorted.insert(sorted.end(), records.begin() + range.first, records.begin() + range.first + range.second);
+	}
+	records.swap(sorted);
+}
+
+// Sink levels are set a handful of times and read on every log call that gets past the floor, so
+// they are swapped as a whole; replaced tables stay alive since a reader may still be walking one
+struct SinkLevelTable {
+	std::vector<std::pair<std::string, uint8_t>> sinks;
+};
+
+std::mutex sink_level_mutex;
+std::vector<std::unique_ptr<SinkLevelTable>> sink_level_tables;
+std::atomic<const SinkLevelTable*> current_sink_levels = nullptr;
+std::atomic<uint8_t> global_level = 0;
+
+// Call with sink_level_mutex held
+void publishSinkLevels(std::unique_ptr<SinkLevelTable> table) {
+	uint8_t floor = global_level.load(std::memory_order_relaxed);
+	for (const auto& [name, severity] : table->sinks) {
+		floor = std::min(floor, severity);
+	}
+
+	_detail::sink_levels.store(not table->sinks.empty(), std::memory_order_relaxed);
+	current_sink_levels.store(table.get(), std::memory_order_release);
+	_detail::level_floor.store(floor, std::memory_order_relaxed);
+	sink_level_tables.push_back(std::move(table));
+}
+
+auto copySinkLevels() -> std::unique_ptr<SinkLevelTable> {
+	const SinkLevelTable* current = current_sink_levels.load(std::memory_order_relaxed);
+	return current ? std::make_unique<SinkLevelTable>(*current) : std::make_unique<SinkLevelTable>();
+}
+
+auto logTimestamp() -> int64_t {
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+}
+
+std::atomic<uint8_t> _detail::level_floor = 0;
+std::atomic<bool> _detail::sink_levels = false;
+
+void setLevel(uint8_t severity) {
+	std::scoped_lock lock(sink_level_mutex);
+	global_level.store(severity, std::memory_order_relaxed);
+	publishSinkLevels(copySinkLevels());
+}
+
+void setLevel(std::string_view sink, uint8_t severity) {
+	std::scoped_lock lock(sink_level_mutex);
+	auto table = copySinkLevels();
+	auto it = std::ranges::find(table->sinks, sink, &std::pair<std::string, uint8_t>::first);
+	if (it != table->sinks.end()) {
+		it->second = severity;
+	} else {
+		table->sinks.emplace_back(sink, severity);
+	}
+	publishSinkLevels(std::move(table));
+}
+
+void resetLevel(std::string_view sink) {
+	std::scoped_lock lock(sink_level_mutex);
+	auto table = copySinkLevels();
+	std::erase_if(table->sinks, [sink](const auto& entry) { return entry.first == sink; });
+	publishSinkLevels(std::move(table));
+}
+
+auto level(std::string_view sink) noexcept -> uint8_t {
+	if (const SinkLevelTable* table = current_sink_levels.load(std::memory_order_acquire)) {
+		for (const auto& [name, severity] : table->sinks) {
+			if (name == sink) {
+				return severity;
+			}
+		}
+	}
+	return global_level.load(std::memory_order_relaxed);
+}
+
+auto _detail::sinkEnabled(uint8_t severity, std::string_view sink) noexcept -> bool {
+	return severity >= level(sink);
 }
 
 void _detail::log(
     uint8_t severity, std::string_view file_name, unsigned line_number, std::string_view sink, std::string_view message
 ) {
+	if (LogCapture* capture = LogCapture::current()) {
+		capture->capture(severity, sink, message);
+		return;
+	}
+
 	// We wrap the singleton access here so the public headers don't need to know
 	// anything about the Logger class or its dependencies
 	Logger::log(file_name, line_number, severity, sink, message);
 }
 
+void _detail::logDeferred(DeferredLog& record) {
+	record.timestamp = logTimestamp();
+	if (LogCapture* capture = LogCapture::current()) {
+		capture->capture(record);
+		return;
+	}
+	Logger::logDeferred(record);
+}
+
 auto Logger::create() noexcept -> std::unique_ptr<Logger> {
 	ZoneScoped;
 
@@ -45,9 +201,16 @@ auto Logger::create() noexcept -> std::unique_ptr<Logger> {
 	struct Helper : public Logger { };
 
 	auto ptr = std::make_unique<Helper>();
+	ptr->m.generation = ++logger_generations;
 	instance = ptr.get();
 
 	toast::ThreadPool::push([] {
+		// Readers on this host map the ring themselves, there's no server to spawn or connect to
+		if constexpr (use_shared_memory) {
+			instance->initSharedMemory();
+			return;
+		}
+
 		// We allow disabling this so it's easier to debug the server
 		// On release this should ALWAYS be on since the client is not expected to open the log server on their own
 		if constexpr (auto_spawn_log_server) {
@@ -138,18 +301,8 @@ auto Logger::create() noexcept -> std::unique_ptr<Logger> {
 			}
 		}
 
+		// Logs made before create() are still in the fallback ring; the first drain picks them up
 		instance->initNetworkRetry();
-
-		// Send logs on the queue
-		std::vector<std::tuple<std::string, unsigned, char, std::string, std::string>> logs_to_send;
-		{
-			std::lock_guard lock(fallback_database_mutex);
-			logs_to_send = fallback_database;
-			fallback_database.clear();
-		}
-		for (const auto& [file, line, severity, sink, message] : logs_to_send) {
-			log(file, line, severity, sink, message);
-		}
 	});
 	return ptr;
 }
@@ -190,32 +343,30 @@ void Logger::log(std::string_view file, unsigned line, char severity, std::strin
 		}
 #endif
 
-		// Add the logs to a fallback database if it doesn't exist, then send them when initialized
-		std::lock_guard lock(fallback_database_mutex);
-		fallback_database.emplace_back(file, line, severity, sink, message);
+		// Keep the logs in the fallback ring until the logger exists; its first drain sends them
+		std::lock_guard lock(fallback_ring_mutex);
+		pushLogRecord(
+		    fallbackRing(),
+		    {.timestamp = logTimestamp(),
+		     .line = line,
+		     .severity = static_cast<uint8_t>(severity),
+		     .sink = trimmed_sink,
+		     .file = file,
+		     .message = message.substr(0, max_message_size)}
+		);
 		return;
 	}
 
-	proto::logging::LogData log;
-	log.set_timestamp(
-	    std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count()
-	);    // retarded stl library
-	log.set_filepath(file);
-	log.set_line_number(line);
-	log.set_severity(static_cast<proto::logging::LogData_Severity>(severity));
-	log.set_sink(trimmed_sink);
-	log.set_message(message);
-
-	{
-		std::lock_guard lock(logger->m.queue_mutex);
-		logger->m.log_queue.emplace_back(std::move(log));
-	}
-
-	// We use an atomic exchange to claim a "drain slot". This ensures that
-	// even if 100 threads log at once, only one background task is queued
-	if (!logger->m.drain_pending.exchange(true)) {
-		toast::ThreadPool::push([logger]() { logger->drain(); });
-	}
+	pushLogRecord(
+	    logger->threadRing(),
+	    {.timestamp = logTimestamp(),
+	     .line = line,
+	     .severity = static_cast<uint8_t>(severity),
+	     .sink = trimmed_sink,
+	     .file = file,
+	     .message = message.substr(0, max_message_size)}
+	);
+	logger->scheduleDrain();
 
 #ifdef DEBUG
 	// If in debug we are going to print warnings and errors on console
@@ -229,6 +380,59 @@ void Logger::log(std::string_view file, unsigned line, char severity, std::strin
 #endif
 }
 
+void Logger::logDeferred(const _detail::DeferredLog& record) {
+	auto* logger = instance;
+	if (not logger) {
+		// Nowhere to queue it yet; the fallback path keeps the text until the logger exists
+		log(record.file, record.line, static_cast<char>(record.severity), record.sinkName(), record.message());
+		return;
+	}
+
+	logger->threadRing().push(LogRing::Kind::deferred, std::as_bytes(std::span(&record, 1)));
+	logger->scheduleDrain();
+}
+
+auto Logger::threadRing() -> LogRing& {
+	if (logger_thread_ring.generation == m.generation) {
+		return *logger_thread_ring.ring;
+	}
+
+	// First log from this thread, or the first since the previous Logger went away
+	auto ring = std::make_shared<LogRing>(thread_ring_size);
+	{
+		std::lock_guard lock(m.rings_mutex);
+		m.rings.push_back(ring);
+	}
+	if (logger_thread_ring.ring) {
+		logger_thread_ring.ring->retire();
+	}
+	logger_thread_ring.ring = std::move(ring);
+	logger_thread_ring.generation = m.generation;
+	return *logger_thread_ring.ring;
+}
+
+void Logger::scheduleDrain() {
+	// Pairs with the fence in drain(): either the drain job sees the entry we just pushed, or we
+	// see its slot released and queue another one. Loading before exchanging keeps the flag's
+	// cache line shared between threads while a drain is already queued, which is most calls
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if (not m.drain_pending.load(std::memory_order_relaxed) and not m.drain_pending.exchange(true)) {
+		toast::ThreadPool::push([this] { drain(); });
+	}
+}
+
+auto Logger::hasPending() -> bool {
+	if (not m.backlog.empty() and m.output.load(std::memory_order_acquire) != Output::connecting) {
+		return true;
+	}
+	if (not fallbackRing().empty()) {
+		return true;
+	}
+
+	std::lock_guard lock(m.rings_mutex);
+	return std::ranges::any_of(m.rings, [](const auto& ring) { return not ring->empty(); });
+}
+
 void Logger::initNetworkRetry() {
 	ZoneScoped;
 
@@ -262,27 +466,48 @@ void Logger::initNetworkRetry() {
 			setsockopt(m.socket.native_handle(), SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
 #endif
 			// Publish the connection, then flush anything that queued up while we were still connecting
-			m.connected.store(true, std::memory_order_release);
-			if (!m.drain_pending.exchange(true)) {
-				toast::ThreadPool::push([this] { drain(); });
-			}
+			m.output.store(Output::server, std::memory_order_release);
+			scheduleDrain();
 			return;
 		} catch (const std::exception& e) {
 			if (attempt == max_attempts) {
-				std::println(std::cerr, "[Logger] Failed to connect after {} attempts: {}", max_attempts, e.what());
-				abort();
+				// Losing the logs is worse than losing the live view, so they go to disk instead
+				std::println(
+				    std::cerr, "[Logger] Failed to connect after {} attempts: {}, writing logs to {}/{}.tlog", max_attempts,
+				    e.what(), log_directory, log_file_name
+				);
+				m.output.store(Output::file, std::memory_order_release);
+				scheduleDrain();
+				return;
 			}
 			std::this_thread::sleep_for(std::chrono::milliseconds(delay_ms));
 		}
 	}
 }
 
+void Logger::initSharedMemory() {
+	ZoneScoped;
+
+	const std::filesystem::path path = std::filesystem::path(log_directory) / std::format("{}.tshm", log_file_name);
+	m.shm_writer = std::make_unique<LogShmWriter>(path, shared_memory_size);
+	if (m.shm_writer->isOpen()) {
+		m.output.store(Output::shared_memory, std::memory_order_release);
+	} else {
+		std::println(std::cerr, "[Logger] Failed to map {}, writing logs to {}/{}.tlog", path.string(), log_directory, log_file_name);
+		m.output.store(Output::file, std::memory_order_release);
+	}
+	scheduleDrain();
+}
+
 void Logger::stop() {
 	ZoneScoped;
 
-	// We spin briefly to wait for any active background write to finish
-	// This prevents us from closing the socket while a ThreadPool worker is using it
-	while (m.drain_pending.load(std::memory_order_acquire)) {
+	// Take the drain slot for good: we spin until the active background write finishes and claim
+	// the slot ourselves, so a thread logging from here on finds a drain pending and queues none
+	// that could run into flushSync() on the same buffers or use the socket while we close it
+	bool idle = false;
+	while (not m.drain_pending.compare_exchange_weak(idle, true, std::memory_order_acquire)) {
+		idle = false;
 		std::this_thread::yield();
 	}
 
@@ -290,8 +515,6 @@ void Logger::stop() {
 	// must be flushed synchronously before the object is destroyed
 	flushSync();
 
-	m.connected.store(false, std::memory_order_release);
-
 	if (m.socket.is_open()) {
 		asio::error_code ec;
 		[[maybe_unused]]
@@ -303,107 +526,232 @@ void Logger::stop() {
 
 void Logger::drain() {
 	ZoneScoped;
+	std::lock_guard lock(m.drain_mutex);
 
-	// The socket is open but not yet connected while initNetworkRetry is still running
-	if (!m.connected.load(std::memory_order_acquire)) {
-		m.drain_pending.store(false, std::memory_order_release);
-		return;
+	collect();
+	deliver(m.output.load(std::memory_order_acquire));
+
+	// Release the drain slot, but check if more logs arrived while we were busy
+	// This "double-check" pattern ensures the rings are actually empty when we finish
+	m.drain_pending.store(false, std::memory_order_release);
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if (hasPending()) {
+		scheduleDrain();
 	}
+}
 
-	auto batch = collectQueue();
+void Logger::collect() {
+	ZoneScoped;
 
-	if (!batch.empty() && m.socket.is_open()) {
-		try {
-			uint32_t len = static_cast<uint32_t>(batch.size());
-			std::array<uint8_t, 4> len_buf;
-			len_buf[0] = (len >> 24) & 0xFF;
-			len_buf[1] = (len >> 16) & 0xFF;
-			len_buf[2] = (len >> 8) & 0xFF;
-			len_buf[3] = len & 0xFF;
-
-			std::array<asio::const_buffer, 2> bufs = {asio::buffer(len_buf, 4), asio::buffer(batch)};
-			asio::write(m.socket, bufs);
-		} catch (const std::exception& e) {
-			// If sending fails, we fallback to stderr to avoid losing critical info
-			std::println(std::cerr, "[Logger] Send failure: {}", e.what());
+	m.batch.clear();
+	uint64_t dropped = 0;
+	{
+		std::lock_guard lock(fallback_ring_mutex);
+		dropped += collectRing(fallbackRing());
+	}
+	{
+		std::lock_guard lock(m.rings_mutex);
+		for (const auto& ring : m.rings) {
+			dropped += collectRing(*ring);
 		}
+
+		// A retired ring won't get anything new, so once it's empty its thread is done with it
+		std::erase_if(m.rings, [](const auto& ring) { return ring->retired() and ring->empty(); });
 	}
 
-	// Release the drain slot, but check if more logs arrived while we were busy
-	// This "double-check" pattern ensures the queue is actually empty when we finish
-	m.drain_pending.store(false, std::memory_order_release);
-	{
-		std::lock_guard lock(m.queue_mutex);
-		if (!m.log_queue.empty() && !m.drain_pending.exchange(true)) {
-			toast::ThreadPool::push([this]() { drain(); });
+	sortLogRecords(m.batch, m.sorted);
+	if (dropped > 0) {
+		const std::string message = std::format("Dropped {} log messages, the logging threads outran the drain job", dropped);
+		encodeLogRecord({.timestamp = logTimestamp(), .severity = 2, .sink = "Logger", .file = "logger.cpp", .message = message}, m.batch);
+	}
+}
+
+auto Logger::collectRing(LogRing& ring) -> uint64_t {
+	// Bounded by what the ring holds right now, so a thread that keeps logging can't keep the drain job here
+	size_t budget = ring.capacity();
+	LogRing::Kind kind {};
+	while (budget > 0 and ring.pop(kind, m.payload)) {
+		budget -= std::min(budget, LogRing::entry_header_size + m.payload.size());
+		if (kind == LogRing::Kind::record) {
+			m.batch.insert(m.batch.end(), m.payload.begin(), m.payload.end());
+			continue;
 		}
+
+		// Deferred calls get formatted here, off the thread that logged them
+		_detail::DeferredLog record;
+		std::memcpy(&record, m.payload.data(), sizeof(record));
+		std::string_view sink = record.sinkName();
+		if (const auto pos = sink.find_last_of(':'); pos != std::string_view::npos) {
+			sink.remove_prefix(pos + 1);
+		}
+		const std::string message = record.message();
+		encodeLogRecord(
+		    {.timestamp = record.timestamp,
+		     .line = record.line,
+		     .severity = record.severity,
+		     .sink = sink,
+		     .file = record.file,
+		     .message = message},
+		    m.batch
+		);
 	}
+	return ring.takeDropped();
 }
 
-auto Logger::collectQueue() -> std::vector<uint8_t> {
+void Logger::deliver(Output output) {
 	ZoneScoped;
 
-	// Batching logs together significantly reduces the number of TCP packets
-	// and system calls, which is better for performance
-	proto::logging::LogBatch batch;
-	{
-		std::lock_guard lock(m.queue_mutex);
-		while (!m.log_queue.empty()) {
-			auto* new_log = batch.add_logs();
-			*new_log = std::move(m.log_queue.front());
-			m.log_queue.pop_front();
+	if (output == Output::connecting) {
+		// Keep whole records while they fit; the rest are counted and reported once we know where logs go
+		size_t start = 0;
+		size_t offset = 0;
+		while (decodeLogRecord(m.batch, offset)) {
+			if (m.backlog.size() + (offset - start) <= backlog_size) {
+				m.backlog.insert(m.backlog.end(), m.batch.begin() + start, m.batch.begin() + offset);
+			} else {
+				++m.backlog_dropped;
+			}
+			start = offset;
 		}
+		return;
 	}
 
-	if (batch.logs_size() == 0) {
-		return {};
+	if (m.backlog_dropped > 0) {
+		const std::string message =
+		    std::format("Dropped {} log messages while connecting to the log server", std::exchange(m.backlog_dropped, 0));
+		encodeLogRecord({.timestamp = logTimestamp(), .severity = 2, .sink = "Logger", .file = "logger.cpp", .message = message}, m.backlog);
 	}
 
-	std::vector<uint8_t> buffer(batch.ByteSizeLong());
-	batch.SerializeToArray(buffer.data(), buffer.size());
-	return buffer;
+	for (auto* records : {&m.backlog, &m.batch}) {
+		if (records->empty()) {
+			continue;
+		}
+		// send() may fall back to the file halfway through, so ask again for every buffer
+		switch (m.output.load(std::memory_order_acquire)) {
+			case Output::server: send(*records); break;
+			case Output::shared_memory: writeSharedMemory(*records); break;
+			default: writeFile(*records); break;
+		}
+		records->clear();
+	}
 }
 
-void Logger::flushSync() {
+void Logger::send(std::span<const std::byte> records) {
 	ZoneScoped;
 
-	auto batch = collectQueue();
-	if (!batch.empty() && m.connected.load(std::memory_order_acquire) && m.socket.is_open()) {
-		uint32_t len = static_cast<uint32_t>(batch.size());
+	// Batching logs together significantly reduces the number of TCP packets
+	// and system calls, which is better for performance
+	proto::logging::LogBatch batch;
+	size_t offset = 0;
+	while (auto record = decodeLogRecord(records, offset)) {
+		auto* log = batch.add_logs();
+		log->set_timestamp(record->timestamp);
+		log->set_filepath(record->file);
+		log->set_line_number(record->line);
+		log->set_severity(static_cast<proto::logging::LogData_Severity>(record->severity));
+		log->set_sink(record->sink);
+		log->set_message(record->message);
+	}
+
+	std::vector<uint8_t> buffer(batch.ByteSizeLong());
+	batch.SerializeToArray(buffer.data(), buffer.size());
+
+	try {
+		uint32_t len = static_cast<uint32_t>(buffer.size());
 		std::array<uint8_t, 4> len_buf;
 		len_buf[0] = (len >> 24) & 0xFF;
 		len_buf[1] = (len >> 16) & 0xFF;
 		len_buf[2] = (len >> 8) & 0xFF;
 		len_buf[3] = len & 0xFF;
 
-		std::array<asio::const_buffer, 2> bufs = {asio::buffer(len_buf, 4), asio::buffer(batch)};
-		asio::error_code ec;
-		asio::write(m.socket, bufs, ec);
+		std::array<asio::const_buffer, 2> bufs = {asio::buffer(len_buf, 4), asio::buffer(buffer)};
+		asio::write(m.socket, bufs);
+	} catch (const std::exception& e) {
+		// The server went away; keep what we have on disk rather than losing it
+		std::println(std::cerr, "[Logger] Send failure: {}, writing logs to {}/{}.tlog", e.what(), log_directory, log_file_name);
+		m.output.store(Output::file, std::memory_order_release);
+		writeFile(records);
 	}
 }
 
+void Logger::writeFile(std::span<const std::byte> records) {
+	ZoneScoped;
+
+	if (not m.file_sink) {
+		m.file_sink = std::make_unique<LogFileSink>(log_directory, std::string(log_file_name), log_file_size, log_file_count);
+	}
+
+	size_t start = 0;
+	size_t offset = 0;
+	while (decodeLogRecord(records, offset)) {
+		m.file_sink->write(records.subspan(start, offset - start));
+		start = offset;
+	}
+	m.file_sink->flush();
+}
+
+void Logger::writeSharedMemory(std::span<const std::byte> records) {
+	ZoneScoped;
+
+	// The ring overwrites its oldest records rather than wait for a reader, which counts what it missed
+	size_t start = 0;
+	size_t offset = 0;
+	while (decodeLogRecord(records, offset)) {
+		m.shm_writer->write(records.subspan(start, offset - start));
+		start = offset;
+	}
+}
+
+void Logger::flushSync() {
+	ZoneScoped;
+
+	// A drain that already released its slot may still be checking hasPending(); wait it out
+	std::lock_guard lock(m.drain_mutex);
+
+	// Nobody is left to wait for a pending connection, so whatever is still connecting goes to disk
+	collect();
+	const Output output = m.output.load(std::memory_order_acquire);
+	deliver(output == Output::connecting ? Output::file : output);
+}
+
 }
 
 extern "C" {
 using namespace logging;
 
 void toast_trace(const char* sink, const char* message, const char* file, unsigned line) noexcept {
-	Logger::log(file, line, 0, sink, message);
+	if (_detail::enabled(0, sink)) {
+		Logger::log(file, line, 0, sink, message);
+	}
 }
 
 void toast_info(const char* sink, const char* message, const char* file, unsigned line) noexcept {
-	Logger::log(file, line, 1, sink, message);
+	if (_detail::enabled(1, sink)) {
+		Logger::log(file, line, 1, sink, message);
+	}
 }
 
 void toast_warn(const char* sink, const char* message, const char* file, unsigned line) noexcept {
-	Logger::log(file, line, 2, sink, message);
+	if (_detail::enabled(2, sink)) {
+		Logger::log(file, line, 2, sink, message);
+	}
 }
 
 void toast_error(const char* sink, const char* message, const char* file, unsigned line) noexcept {
-	Logger::log(file, line, 3, sink, message);
+	if (_detail::enabled(3, sink)) {
+		Logger::log(file, line, 3, sink, message);
+	}
 }
 
 void toast_critical(const char* sink, const char* message, const char* file, unsigned line) noexcept {
 	Logger::log(file, line, 4, sink, message);
 }
+
+void toast_log_set_level(const char* sink, unsigned char severity) noexcept {
+	if (sink == nullptr) {
+		setLevel(severity);
+	} else {
+		setLevel(sink, severity);
+	}
+}
 }
@@ -4,21 +4,27 @@
  * @date 16 Mar 2026
  * @brief Internal log delivery system
  *
- * Handles the heavy lifting of serializing logs and shipping them over TCP;
- * it's designed to be as "fire-and-forget" as possible for the caller
+ * Handles the heavy lifting of serializing logs and shipping them over TCP, or to a
+ * rotating binary file when there is no server, or into a shared-memory ring for a reader
+ * on the same host; it's designed to be as "fire-and-forget" as possible for the caller
  */
 
 #pragma once
 
 #include "generated/logging.pb.h"
+#include "log.hpp"
+#include "log_file.hpp"
+#include "log_ring.hpp"
+#include "log_shm.hpp"
 
 #include <asio.hpp>
 #include <atomic>
 #include <cassert>
+#include <cstddef>
 #include <cstdint>
-#include <deque>
 #include <memory>
 #include <mutex>
+#include <span>
 #include <string_view>
 #include <vector>
 
@@ -27,12 +33,22 @@ namespace logging {
 class Logger {
 	inline static Logger* instance = nullptr;
 
+	/// Where the drain job delivers what it collects
+	enum class Output : uint8_t {
+		connecting,    ///< kept in the backlog until initNetworkRetry settles on one of the others
+		server,
+		file,          ///< the rotating .tlog sink, when there is no server to talk to
+		shared_memory,    ///< the LogShmWriter ring, when use_shared_memory replaces the server
+	};
+
 	struct {
 		asio::io_context io_ctx;
 		asio::ip::tcp::socket socket {io_ctx};
 
-		std::deque<proto::logging::LogData> log_queue;
-		std::mutex queue_mutex;
+		/// One ring per thread that logged, registered by its first call; deferred calls wait in them unformatted
+		std::vector<std::shared_ptr<LogRing>> rings;
+		std::mutex rings_mutex;
+		uint64_t generation = 0;    ///< tells a thread's ring of a previous Logger from this one's
 
 		/**
 		 * @brief Prevents multiple background jobs from fighting over the same socket
@@ -41,16 +57,33 @@ class Logger {
 		 * avoiding unnecessary context switches and thread contention.
 		 */
 		std::atomic<bool> drain_pending = false;
-
-		/**
-		 * @brief True once initNetworkRetry has established the connection
-		 */
-		std::atomic<bool> connected = false;
+		std::mutex drain_mutex;    ///< held by drain() and flushSync(), so they never share the buffers below
+
+		std::atomic<Output> output = Output::connecting;
+
+		// Only touched with drain_mutex held
+		std::vector<std::byte> batch;      ///< encoded records collected by one drain
+		std::vector<std::byte> backlog;    ///< batches collected while still connecting, up to backlog_size bytes
+		std::vector<std::byte> payload;    ///< scratch for LogRing::pop
+		std::vector<std::byte> sorted;     ///< scratch for interleaving the rings by timestamp
+		uint64_t backlog_dropped = 0;      ///< records the backlog had no room for, not reported yet
+		std::unique_ptr<LogFileSink> file_sink;
+		std::unique_ptr<LogShmWriter> shm_writer;    ///< set before output switches to shared_memory
 	} m;
 
 	static constexpr uint16_t port = 12800;                ///< Port to connect to the server
 	static constexpr bool auto_spawn_log_server = true;    ///< Decides if the engine should create a log server or not
 	static constexpr bool show_server_logs = false;        ///< If true, log server consoole will also appear on the terminal
+	static constexpr bool use_shared_memory = false;       ///< If true, logs go to a shared-memory ring instead of the log server
+
+	static constexpr size_t thread_ring_size = 64 * 1024;         ///< Bytes each logging thread may have waiting for the drain job
+	static constexpr size_t max_message_size = thread_ring_size / 4;    ///< Longer messages are cut so they always fit a ring
+	static constexpr size_t backlog_size = 1024 * 1024;           ///< Bytes kept while the server connection is pending
+	static constexpr std::string_view log_directory = "logs";     ///< Relative to the working directory, like the log server's CSVs
+	static constexpr std::string_view log_file_name = "engine";
+	static constexpr uint64_t log_file_size = 8 * 1024 * 1024;    ///< Size a .tlog file rotates at
+	static constexpr unsigned log_file_count = 4;                 ///< .tlog files kept, the current one included
+	static constexpr size_t shared_memory_size = 4 * 1024 * 1024;    ///< Bytes of records the shared-memory ring holds
 
 public:
 	/**
@@ -74,19 +107,39 @@ public:
 	/**
 	 * @brief Entry point for all engine logs
 	 *
-	 * Thread-safe. It pushes the log to a local queue and signals a background
-	 * task to handle the actual network I/O
+	 * Thread-safe and lock-free. It pushes the log to the calling thread's ring and signals a
+	 * background task to handle the actual I/O; when the ring is full the log is dropped and
+	 * counted, and the drain job reports how many were lost
 	 */
 	static void log(std::string_view file, unsigned line, char severity, std::string_view sink, std::string_view message);
 
+	/**
+	 * @brief Queues a call whose arguments were captured as bytes
+	 *
+	 * Thread-safe and lock-free. Costs a copy of the record into the calling thread's ring; the
+	 * message is formatted when the drain job picks it up
+	 */
+	static void logDeferred(const _detail::DeferredLog& record);
+
 private:
 	Logger() = default;
 
 	void initNetworkRetry();    ///< @brief Tries to establish a connection, retrying if the server isn't ready
+	void initSharedMemory();    ///< @brief Maps the shared-memory ring, or falls back to the file when it can't
 	void stop();                ///< @brief Blocks until the background work finishes to avoid data races during shutdown
 	void drain();               ///< @brief Background worker that batches queued logs and sends them
-	auto collectQueue() -> std::vector<uint8_t>;    ///< @brief Pulls everything from the queue and turns it into a bit buffer
 	void flushSync();    ///< @brief Synchronous fallback for when we can't rely on background threads (like shutdown)
+
+	auto threadRing() -> LogRing&;    ///< @brief The calling thread's ring, registering one on its first call
+	void scheduleDrain();             ///< @brief Queues a drain job unless one is already pending
+	auto hasPending() -> bool;        ///< @brief Whether the drain job left anything behind it should come back for
+
+	void collect();                                    ///< @brief Moves every ring's entries into m.batch, in timestamp order
+	auto collectRing(LogRing& ring) -> uint64_t;       ///< @returns the entries the ring dropped since the last drain
+	void deliver(Output output);                       ///< @brief Hands the backlog and m.batch to @p output
+	void send(std::span<const std::byte> records);         ///< @brief Frames the records as a LogBatch for the server
+	void writeFile(std::span<const std::byte> records);    ///< @brief Appends the records to the rotating .tlog sink
+	void writeSharedMemory(std::span<const std::byte> records);    ///< @brief Publishes the records to the shared-memory ring
 };
 
 }
@@ -0,0 +1,135 @@
+#include "memory_tracker.hpp"
+
+#include <format>
+#include <new>
+#include <toast/log.hpp>
+#include <tracy/Tracy.hpp>
+
+namespace toast {
+
+namespace {
+
+constexpr std::array<std::string_view, static_cast<size_t>(MemoryTag::count)> memory_tag_names {
+	"Nodes",
+	"Assets",
+	"Lua",
+	"Events",
+	"Renderer (VRAM)",
+};
+
+class TrackingResource final : public std::pmr::memory_resource {
+public:
+	constexpr explicit TrackingResource(MemoryTag tag) noexcept : m_tag(tag) { }
+
+private:
+	auto do_allocate(std::size_t bytes, std::size_t alignment) -> void* override {
+		void* ptr = std::pmr::new_delete_resource()->allocate(bytes, alignment);
+		MemoryTracker::allocated(m_tag, bytes);
+		return ptr;
+	}
+
+	void do_deallocate(void* ptr, std::size_t bytes, std::size_t alignment) override {
+		MemoryTracker::freed(m_tag, bytes);
+		std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+	}
+
+	auto do_is_equal(const std::pmr::memory_resource& other) const noexcept -> bool override {
+		return this == &other;
+	}
+
+	MemoryTag m_tag;
+};
+
+auto kilobytes(uint64_t bytes) -> double {
+	return static_cast<double>(bytes) / 1024.0;
+}
+
+}
+
+auto MemoryTracker::resource(MemoryTag tag) noexcept -> std::pmr::memory_resource* {
+	// Function-local so static initializers elsewhere can take one safely
+	static std::array<TrackingResource, static_cast<size_t>(MemoryTag::count)> resources {
+		TrackingResource {MemoryTag::nodes},
+		TrackingResource {MemoryTag::assets},
+		TrackingResource {MemoryTag::lua},
+		TrackingResource {MemoryTag::events},
+		TrackingResource {MemoryTag::renderer},
+	};
+	return &resources[static_cast<size_t>(tag)];
+}
+
+auto MemoryTracker::name(MemoryTag tag) noexcept -> std::string_view {
+	return memory_tag_names[static_cast<size_t>(tag)];
+}
+
+auto MemoryTracker::counters(MemoryTag tag) noexcept -> Counters {
+	const Slot& slot = slots[static_cast<size_t>(tag)];
+	return {
+		.name = name(tag),
+		.current = slot.current.load(std::memory_order_relaxed),
+		.peak = slot.peak.load(std::memory_order_relaxed),
+		.allocations = slot.allocations.load(std::memory_order_relaxed),
+		.live_blocks = slot.blocks.load(std::memory_order_relaxed),
+		.bytes_per_second = slot.rate.load(std::memory_order_relaxed),
+		.budget = slot.budget.load(std::memory_order_relaxed),
+	};
+}
+
+void MemoryTracker::setBudget(MemoryTag tag, uint64_t bytes) noexcept {
+	Slot& slot = slots[static_cast<size_t>(tag)];
+	slot.budget.store(bytes, std::memory_order_relaxed);
+	slot.over_budget = false;
+}
+
+void MemoryTracker::update(double delta) noexcept {
+	for (size_t i = 0; i < slots.size(); ++i) {
+		Slot& slot = slots[i];
+		const auto tag = static_cast<MemoryTag>(i);
+
+		slot.rate_window += delta;
+		if (slot.rate_window >= 1.0) {
+			const uint64_t allocated = slot.allocated.load(std::memory_order_relaxed);
+			slot.rate.store(static_cast<double>(allocated - slot.rate_base) / slot.rate_window, std::memory_order_relaxed);
+			slot.rate_base = allocated;
+			slot.rate_window = 0.0;
+		}
+
+		const uint64_t current = slot.current.load(std::memory_order_relaxed);
+		const uint64_t budget = slot.budget.load(std::memory_order_relaxed);
+		const bool over = budget > 0 and current > budget;
+		if (over and not slot.over_budget) {
+			TOAST_WARN(
+			    "Memory", "{} is over its budget: {:.1f} KiB live, budget {:.1f} KiB", name(tag), kilobytes(current), kilobytes(budget)
+			);
+		}
+		slot.over_budget = over;
+
+#ifdef TRACY_ENABLE
+		static const auto plot_names = [] {
+			std::array<std::string, static_cast<size_t>(MemoryTag::count)> names;
+			for (size_t n = 0; n < names.size(); ++n) {
+				names[n] = std::format("{} memory (KB)", memory_tag_names[n]);
+			}
+			return names;
+		}();
+		TracyPlot(plot_names[i].c_str(), static_cast<int64_t>(current / 1024));
+#endif
+	}
+}
+
+auto MemoryTracker::reportLeaks() noexcept -> size_t {
+	size_t leaking = 0;
+	for (size_t i = 0; i < slots.size(); ++i) {
+		const Counters c = counters(static_cast<MemoryTag>(i));
+		if (c.live_blocks == 0 and c.current == 0) {
+			continue;
+		}
+		++leaking;
+		TOAST_WARN(
+		    "Memory", "{} still holds {:.1f} KiB in {} allocations (peak {:.1f} KiB)", c.name, kilobytes(c.current), c.live_blocks, kilobytes(c.peak)
+		);
+	}
+	return leaking;
+}
+
+}
@@ -0,0 +1,115 @@
+/**
+ * @file memory_tracker.hpp
+ * @author Xein
+ * @date 18 Oct 2026
+ *
+ * @brief Per-subsystem memory counters with budgets and a leak report, cheap enough for release builds
+ */
+
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <string_view>
+#include <toast/export.hpp>
+
+namespace toast {
+
+/// Subsystems with their own counters; each allocator that knows its subsystem reports to one
+enum class MemoryTag : uint8_t {
+	nodes,       ///< live nodes, by their NodePool slot size
+	assets,      ///< cached assets, by the size of their source data
+	lua,         ///< every Lua state, through the state's allocator
+	events,      ///< event queue pages
+	renderer,    ///< VMA device memory
+	count
+};
+
+/**
+ * @brief Counts what each subsystem has live, its peak and its allocation rate
+ *
+ * A tracked allocation costs two relaxed atomic adds, plus a compare when it sets a new peak, so
+ * the counters stay on in release builds. Allocators report to it directly (NodePool, the Lua
+ * allocator, the VMA callbacks), or allocate through resource(tag). update() runs once per frame,
+ * turns the totals into rates and warns when a tag goes over its budget
+ *
+ * The counters are static so allocations made before the Engine exists, or after it's gone, are
+ * still counted
+ */
+class TOAST_API MemoryTracker {
+public:
+	struct Counters {
+		std::string_view name;
+		uint64_t current = 0;          ///< bytes live right now
+		uint64_t peak = 0;
+		uint64_t allocations = 0;      ///< allocations ever made
+		uint64_t live_blocks = 0;      ///< allocations not freed yet
+		double bytes_per_second = 0.0;    ///< allocated, averaged over the last second
+		uint64_t budget = 0;           ///< 0 when the tag has no budget
+	};
+
+	MemoryTracker() = delete;
+
+	static void allocated(MemoryTag tag, std::size_t bytes) noexcept {
+		Slot& slot = slots[static_cast<size_t>(tag)];
+		const uint64_t current = slot.current.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+		slot.allocated.fetch_add(bytes, std::memory_order_relaxed);
+		slot.blocks.fetch_add(1, std::memory_order_relaxed);
+		slot.allocations.fetch_add(1, std::memory_order_relaxed);
+
+		uint64_t peak = slot.peak.load(std::memory_order_relaxed);
+		while (current > peak and not slot.peak.compare_exchange_weak(peak, current, std::memory_order_relaxed)) { }
+	}
+
+	static void freed(MemoryTag tag, std::size_t bytes) noexcept {
+		Slot& slot = slots[static_cast<size_t>(tag)];
+		slot.current.fetch_sub(bytes, std::memory_order_relaxed);
+		slot.blocks.fetch_sub(1, std::memory_order_relaxed);
+	}
+
+	/// @brief A memory_resource over the global heap that counts into @p tag; lives for the whole program
+	[[nodiscard]]
+	static auto resource(MemoryTag tag) noexcept -> std::pmr::memory_resource*;
+
+	[[nodiscard]]
+	static auto counters(MemoryTag tag) noexcept -> Counters;
+
+	[[nodiscard]]
+	static auto name(MemoryTag tag) noexcept -> std::string_view;
+
+	/// @param bytes 0 removes the budget
+	static void setBudget(MemoryTag tag, uint64_t bytes) noexcept;
+
+	/// @brief Refreshes the rates, plots the counters and warns once each time a tag crosses its budget
+	/// @param delta seconds since the last call
+	static void update(double delta) noexcept;
+
+	/// @brief Logs every tag that still has live allocations, e.g. at shutdown once its subsystem is gone
+	/// @returns the number of tags with live allocations
+	static auto reportLeaks() noexcept -> size_t;
+
+private:
+	struct alignas(64) Slot {
+		std::atomic<uint64_t> current = 0;
+		std::atomic<uint64_t> peak = 0;
+		std::atomic<uint64_t> allocated = 0;    ///< bytes ever allocated, for the rate
+		std::atomic<uint64_t> blocks = 0;
+		std::atomic<uint64_t> allocations = 0;
+		std::atomic<uint64_t> budget = 0;
+
+		std::atomic<double> rate = 0.0;
+
+		// update() only, main thread
+		uint64_t rate_base = 0;
+		double rate_window = 0.0;
+		bool over_budget = false;
+	};
+
+	static std::array<Slot, static_cast<size_t>(MemoryTag::count)> slots;
+};
+
+inline std::array<MemoryTracker::Slot, static_cast<size_t>(MemoryTag::count)> MemoryTracker::slots {};
+
+}
@@ -0,0 +1,20 @@
+#include "box_collider.hpp"
+
+#include "physics_backend.hpp"
+
+namespace toast {
+
+auto BoxCollider::extents() const -> glm::vec3 {
+	return m_extents;
+}
+
+void BoxCollider::extents(glm::vec3 value) {
+	m_extents = value;
+}
+
+void BoxCollider::writeShape(physics::PhysicsBody& body) const {
+	body.shape = physics::ShapeType::box;
+	body.extents = glm::abs(m_extents * world_scale);
+}
+
+}
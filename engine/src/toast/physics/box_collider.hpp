@@ -0,0 +1,30 @@
+/**
+ * @file box_collider.hpp
+ * @author Xein
+ * @date 18 Oct 2026
+ *
+ * @brief Axis-aligned box collider
+ */
+
+#pragma once
+#include "collider.hpp"
+
+namespace toast {
+
+/**
+ * @brief Box collider; the built-in backend keeps it axis-aligned and ignores the node's rotation
+ */
+class TOAST_API [[ToastNode]] BoxCollider : public Collider {
+public:
+	[[nodiscard]]
+	auto extents() const -> glm::vec3;
+	void extents(glm::vec3 value);
+
+protected:
+	void writeShape(physics::PhysicsBody& body) const override;
+
+	[[Reflect, Unit("m")]]
+	glm::vec3 m_extents = glm::vec3 {0.5f};    ///< half-extents in local space
+};
+
+}
@@ -0,0 +1,176 @@
+#include "broadphase.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <tracy/Tracy.hpp>
+
+namespace physics {
+
+namespace {
+
+// Another axis must spread boxes this much wider before the sweep switches to it
+constexpr float sap_axis_hysteresis = 1.5f;
+// Column width in average box sizes; narrower columns duplicate more boxes, wider ones sweep more candidates
+constexpr float sap_column_scale = 4.0f;
+constexpr uint32_t sap_max_cells = 256;    // per grid axis
+
+struct SapGrid {
+	float origin = 0.0f;
+	float inv_width = 0.0f;
+	uint32_t cells = 1;
+
+	// Cells a few average boxes wide over the extent of all boxes on one axis
+	static auto fit(std::span<const Aabb> bounds, int axis) -> SapGrid {
+		float lo = std::numeric_limits<float>::max();
+		float hi = std::numeric_limits<float>::lowest();
+		float size = 0.0f;
+		for (const Aabb& box : bounds) {
+			lo = std::min(lo, box.min[axis]);
+			hi = std::max(hi, box.max[axis]);
+			size += box.max[axis] - box.min[axis];
+		}
+
+		const float width = std::max(size / static_cast<float>(bounds.size()) * sap_column_scale, (hi - lo) / sap_max_cells);
+		if (not(width > 0.0f)) {
+			return {lo, 0.0f, 1};    // every box is flat and at the same spot
+		}
+		return {lo, 1.0f / width, std::min(static_cast<uint32_t>((hi - lo) / width) + 1, sap_max_cells)};
+	}
+
+	[[nodiscard]]
+	auto cellOf(float value) const -> uint32_t {
+		return std::min(static_cast<uint32_t>((value - origin) * inv_width), cells - 1);
+	}
+};
+
+auto centerVariance(std::span<const Aabb> bounds) -> glm::vec3 {
+	glm::vec3 sum {0.0f};
+	glm::vec3 sum_sq {0.0f};
+	for (const Aabb& box : bounds) {
+		const glm::vec3 center = (box.min + box.max) * 0.5f;
+		sum += center;
+		sum_sq += center * center;
+	}
+
+	const float count = static_cast<float>(bounds.size());
+	return sum_sq / count - (sum / count) * (sum / count);
+}
+
+}
+
+void SweepAndPrune::invalidate() noexcept {
+	m_valid = false;
+}
+
+void SweepAndPrune::findPairs(std::span<const Aabb> bounds, std::vector<BroadphasePair>& pairs) {
+	ZoneScoped;
+
+	pairs.clear();
+	const auto count = static_cast<uint32_t>(bounds.size());
+	if (count < 2) {
+		return;
+	}
+
+	// Sweep along the widest spread, grid the other two
+	const glm::vec3 variance = centerVariance(bounds);
+	int axis = m_valid ? m_axis : 0;
+	for (int i = 0; i < 3; ++i) {
+		if (variance[i] > variance[axis] * (m_valid ? sap_axis_hysteresis : 1.0f)) {
+			axis = i;
+		}
+	}
+	const int u = (axis + 1) % 3;
+	const int v = (axis + 2) % 3;
+
+	auto key = [&bounds, axis](uint32_t index) {
+		return bounds[index].min[axis];
+	};
+
+	if (not m_valid or m_order.size() != count or axis != m_axis) {
+		ZoneScopedN("full sort");
+		m_order.resize(count);
+		std::iota(m_order.begin(), m_order.end(), 0u);
+		std::ranges::sort(m_order, {}, key);
+		m_axis = axis;
+		m_valid = true;
+	} else {
+		// Bodies barely move between steps, so the previous order is almost sorted already
+		ZoneScopedN("insertion sort");
+		for (uint32_t i = 1; i < count; ++i) {
+			const uint32_t index = m_order[i];
+			const float value = key(index);
+			uint32_t j = i;
+			while (j > 0 and key(m_order[j - 1]) > value) {
+				m_order[j] = m_order[j - 1];
+				--j;
+			}
+			m_order[j] = index;
+		}
+	}
+
+	const SapGrid grid_u = SapGrid::fit(bounds, u);
+	const SapGrid grid_v = SapGrid::fit(bounds, v);
+	const uint32_t columns = grid_u.cells * grid_v.cells;
+
+	{
+		// Counting sort into columns; walking m_order keeps every column in sweep order
+		ZoneScopedN("columns");
+		m_column_offsets.assign(columns + 1, 0);
+		m_sorted.resize(count);
+		m_cells.resize(count * 4);
+		for (uint32_t i = 0; i < count; ++i) {
+			const Aabb& box = bounds[m_order[i]];
+			m_sorted[i] = {box.min[axis], box.max[axis], box.min[u], box.max[u], box.min[v], box.max[v], m_order[i]};
+
+			uint32_t* cells = &m_cells[i * 4];
+			cells[0] = grid_u.cellOf(box.min[u]);
+			cells[1] = grid_u.cellOf(box.max[u]);
+			cells[2] = grid_v.cellOf(box.min[v]);
+			cells[3] = grid_v.cellOf(box.max[v]);
+			for (uint32_t cv = cells[2]; cv <= cells[3]; ++cv) {
+				for (uint32_t cu = cells[0]; cu <= cells[1]; ++cu) {
+					++m_column_offsets[cv * grid_u.cells + cu + 1];
+				}
+			}
+		}
+		std::partial_sum(m_column_offsets.begin(), m_column_offsets.end(), m_column_offsets.begin());
+
+		std::vector<uint32_t> cursor(m_column_offsets.begin(), m_column_offsets.end() - 1);
+		m_entries.resize(m_column_offsets.back());
+		for (uint32_t i = 0; i < count; ++i) {
+			const uint32_t* cells = &m_cells[i * 4];
+			for (uint32_t cv = cells[2]; cv <= cells[3]; ++cv) {
+				for (uint32_t cu = cells[0]; cu <= cells[1]; ++cu) {
+					m_entries[cursor[cv * grid_u.cells + cu]++] = m_sorted[i];
+				}
+			}
+		}
+	}
+
+	{
+		ZoneScopedN("sweep");
+		for (uint32_t column = 0; column < columns; ++column) {
+			const uint32_t end = m_column_offsets[column + 1];
+			for (uint32_t i = m_column_offsets[column]; i < end; ++i) {
+				const Entry& a = m_entries[i];
+				for (uint32_t j = i + 1; j < end and m_entries[j].lo <= a.hi; ++j) {
+					const Entry& b = m_entries[j];
+					if ((a.min_u > b.max_u) | (b.min_u > a.max_u) | (a.min_v > b.max_v) | (b.min_v > a.max_v)) {
+						continue;
+					}
+					// Boxes spanning several columns meet in each; only the column where their overlap starts reports them
+					const uint32_t owner = grid_v.cellOf(std::max(a.min_v, b.min_v)) * grid_u.cells + grid_u.cellOf(std::max(a.min_u, b.min_u));
+					if (owner != column) {
+						continue;
+					}
+					pairs.push_back({std::min(a.index, b.index), std::max(a.index, b.index)});
+				}
+			}
+		}
+	}
+
+	std::ranges::sort(pairs);
+}
+
+}
@@ -0,0 +1,121 @@
+#include "collider.hpp"
+
+#include "physics_scene.hpp"
+
+namespace toast {
+
+auto Collider::isDynamic() const -> bool {
+	return m_dynamic;
+}
+
+void Collider::isDynamic(bool value) {
+	m_dynamic = value;
+}
+
+auto Collider::isTrigger() const -> bool {
+	return m_trigger;
+}
+
+void Collider::isTrigger(bool value) {
+	m_trigger = value;
+}
+
+auto Collider::mass() const -> float {
+	return m_mass;
+}
+
+void Collider::mass(float value) {
+	m_mass = value;
+}
+
+auto Collider::restitution() const -> float {
+	return m_restitution;
+}
+
+void Collider::restitution(float value) {
+	m_restitution = value;
+}
+
+auto Collider::gravityScale() const -> float {
+	return m_gravity_scale;
+}
+
+void Collider::gravityScale(float value) {
+	m_gravity_scale = value;
+}
+
+auto Collider::velocity() const -> glm::vec3 {
+	return m_velocity;
+}
+
+void Collider::velocity(glm::vec3 value) {
+	m_velocity = value;
+}
+
+auto Collider::layer() const -> uint32_t {
+	return m_layer;
+}
+
+void Collider::layer(uint32_t value) {
+	m_layer = value;
+}
+
+auto Collider::mask() const -> uint32_t {
+	return m_mask;
+}
+
+void Collider::mask(uint32_t value) {
+	m_mask = value;
+}
+
+auto Collider::contactCount() const noexcept -> uint32_t {
+	return m_contact_count;
+}
+
+auto Collider::physicsScene() const noexcept -> physics::PhysicsScene* {
+	return m_owner ? m_owner->physicsScene() : nullptr;
+}
+
+void Collider::onEnable() {
+	if (auto* scene = physicsScene()) {
+		scene->add(*this);
+	}
+}
+
+void Collider::onDisable() {
+	if (auto* scene = physicsScene()) {
+		scene->remove(*this);
+	}
+}
+
+void Collider::end() {
+	onDisable();
+}
+
+void Collider::gather(physics::PhysicsBody& body) const {
+	syncTransform();
+
+	body.position = world_position;
+	body.velocity = m_velocity;
+	body.inv_mass = m_dynamic and m_mass > 0.0f ? 1.0f / m_mass : 0.0f;
+	body.restitution = m_restitution;
+	body.gravity_scale = m_gravity_scale;
+	body.layer = m_layer;
+	body.mask = m_mask;
+	body.trigger = m_trigger;
+	writeShape(body);
+}
+
+void Collider::applySimulation(const physics::PhysicsBody& body) {
+	m_velocity = body.velocity;
+	if (body.position == world_position) {
+		return;
+	}
+
+	// Physics works in world space; the node keeps its local transform as the source of truth
+	const Node3D* parent = transformParent();
+	position = parent ? glm::vec3(glm::inverse(parent->getWorldTransform()) * glm::vec4(body.position, 1.0f)) : body.position;
+	syncTransform();
+}
+
+}
@@ -0,0 +1,112 @@
+/**
+ * @file collider.hpp
+ * @author Xein
+ * @date 18 Oct 2026
+ *
+ * @brief Base node for everything the physics stage simulates
+ */
+
+#pragma once
+#include <toast/export.hpp>
+#include <toast/world/node_3d.hpp>
+
+namespace physics {
+class PhysicsScene;
+struct PhysicsBody;
+}
+
+namespace toast {
+
+/**
+ * @brief Node3D that takes part in the owner's physics stage while enabled
+ *
+ * Static colliders (the default) only block; dynamic ones are integrated and pushed by contacts
+ * and get their position written back after every fixed step. Triggers report contacts without
+ * any response. The shape is centered on the node origin and sized by the world scale
+ */
+class TOAST_API [[ToastNode, Hidden, Interface]] Collider : public Node3D {
+	friend class physics::PhysicsScene;
+
+public:
+	[[nodiscard]]
+	auto isDynamic() const -> bool;
+	void isDynamic(bool value);
+
+	[[nodiscard]]
+	auto isTrigger() const -> bool;
+	void isTrigger(bool value);
+
+	[[nodiscard]]
+	auto mass() const -> float;
+	void mass(float value);
+
+	[[nodiscard]]
+	auto restitution() const -> float;
+	void restitution(float value);
+
+	[[nodiscard]]
+	auto gravityScale() const -> float;
+	void gravityScale(float value);
+
+	[[nodiscard]]
+	auto velocity() const -> glm::vec3;
+	void velocity(glm::vec3 value);
+
+	[[nodiscard]]
+	auto layer() const -> uint32_t;
+	void layer(uint32_t value);
+
+	[[nodiscard]]
+	auto mask() const -> uint32_t;
+	void mask(uint32_t value);
+
+	/// Number of colliders this one touched during the last physics step
+	[[nodiscard]]
+	auto contactCount() const noexcept -> uint32_t;
+
+	/// Physics stage of the owner, or null in owners that never simulate (editor workspaces)
+	[[nodiscard]]
+	auto physicsScene() const noexcept -> physics::PhysicsScene*;
+
+protected:
+	/// Fills shape and extents of body from the node's current world transform
+	virtual void writeShape(physics::PhysicsBody& body) const = 0;
+
+private:
+	void onEnable();
+	void onDisable();
+	void end();
+
+	void gather(physics::PhysicsBody& body) const;
+	void applySimulation(const physics::PhysicsBody& body);
+
+	[[Reflect]]
+	bool m_dynamic = false;
+
+	[[Reflect]]
+	bool m_trigger = false;
+
+	[[Reflect, Unit("kg")]]
+	float m_mass = 1.0f;
+
+	[[Reflect, Range(0.0, 1.0)]]
+	float m_restitution = 0.0f;
+
+	[[Reflect]]
+	float m_gravity_scale = 1.0f;
+
+	[[Reflect, Unit("m/s")]]
+	glm::vec3 m_velocity = glm::vec3(0.0f);
+
+	[[Reflect, Group("Filtering")]]
+	uint32_t m_layer = 1;
+
+	[[Reflect, Group("Filtering")]]
+	uint32_t m_mask = 0xFFFFFFFF;
+
+	static constexpr uint32_t no_body = ~0u;
+	uint32_t m_body = no_body;    ///< index in the scene's collider list
+	uint32_t m_contact_count = 0;
+};
+
+}
@@ -0,0 +1,164 @@
+#include "cpu_backend.hpp"
+
+#include <algorithm>
+#include <tracy/Tracy.hpp>
+
+namespace physics {
+
+namespace {
+
+constexpr float contact_slop = 0.005f;         // penetration left alone so resting bodies keep touching
+constexpr float contact_correction = 0.8f;    // fraction of the remaining penetration removed per sub-step
+constexpr float contact_epsilon = 1e-6f;
+
+auto collideSpheres(const PhysicsBody& a, const PhysicsBody& b, Contact& contact) -> bool {
+	const glm::vec3 delta = b.position - a.position;
+	const float radius = a.extents.x + b.extents.x;
+	const float distance_sq = glm::dot(delta, delta);
+	if (distance_sq > radius * radius) {
+		return false;
+	}
+
+	const float distance = glm::sqrt(distance_sq);
+	contact.normal = distance > contact_epsilon ? delta / distance : glm::vec3 {0.0f, 0.0f, 1.0f};
+	contact.depth = radius - distance;
+	return true;
+}
+
+auto collideBoxes(const PhysicsBody& a, const PhysicsBody& b, Contact& contact) -> bool {
+	const glm::vec3 delta = b.position - a.position;
+	const glm::vec3 overlap = a.extents + b.extents - glm::abs(delta);
+	if (overlap.x < 0.0f or overlap.y < 0.0f or overlap.z < 0.0f) {
+		return false;
+	}
+
+	// Separate along the axis of least penetration
+	int axis = 0;
+	for (int i = 1; i < 3; ++i) {
+		if (overlap[i] < overlap[axis]) {
+			axis = i;
+		}
+	}
+	contact.normal = glm::vec3 {0.0f};
+	contact.normal[axis] = delta[axis] < 0.0f ? -1.0f : 1.0f;
+	contact.depth = overlap[axis];
+	return true;
+}
+
+// Normal points from the sphere to the box
+auto collideSphereBox(const PhysicsBody& sphere, const PhysicsBody& box, Contact& contact) -> bool {
+	const float radius = sphere.extents.x;
+	const glm::vec3 closest = glm::clamp(sphere.position, box.position - box.extents, box.position + box.extents);
+	const glm::vec3 delta = closest - sphere.position;
+	const float distance_sq = glm::dot(delta, delta);
+	if (distance_sq > radius * radius) {
+		return false;
+	}
+
+	if (distance_sq > contact_epsilon * contact_epsilon) {
+		const float distance = glm::sqrt(distance_sq);
+		contact.normal = delta / distance;
+		contact.depth = radius - distance;
+		return true;
+	}
+
+	// Center is inside the box: push out through the nearest face
+	const glm::vec3 local = sphere.position - box.position;
+	const glm::vec3 penetration = box.extents - glm::abs(local);
+	int axis = 0;
+	for (int i = 1; i < 3; ++i) {
+		if (penetration[i] < penetration[axis]) {
+			axis = i;
+		}
+	}
+	contact.normal = glm::vec3 {0.0f};
+	contact.normal[axis] = local[axis] < 0.0f ? 1.0f : -1.0f;
+	contact.depth = penetration[axis] + radius;
+	return true;
+}
+
+void resolveContact(PhysicsBody& a, PhysicsBody& b, const Contact& contact) {
+	const float total_inv_mass = a.inv_mass + b.inv_mass;
+
+	const float correction = std::max(contact.depth - contact_slop, 0.0f) * contact_correction / total_inv_mass;
+	a.position -= contact.normal * (correction * a.inv_mass);
+	b.position += contact.normal * (correction * b.inv_mass);
+
+	const float approach = glm::dot(b.velocity - a.velocity, contact.normal);
+	if (approach >= 0.0f) {
+		return;    // already separating
+	}
+
+	const float restitution = std::max(a.restitution, b.restitution);
+	const float impulse = -(1.0f + restitution) * approach / total_inv_mass;
+	a.velocity -= contact.normal * (impulse * a.inv_mass);
+	b.velocity += contact.normal * (impulse * b.inv_mass);
+}
+
+}
+
+auto collide(const PhysicsBody& a, const PhysicsBody& b, Contact& contact) noexcept -> bool {
+	if (a.shape == ShapeType::sphere and b.shape == ShapeType::sphere) {
+		return collideSpheres(a, b, contact);
+	}
+	if (a.shape == ShapeType::box and b.shape == ShapeType::box) {
+		return collideBoxes(a, b, contact);
+	}
+	if (a.shape == ShapeType::sphere) {
+		return collideSphereBox(a, b, contact);
+	}
+
+	const bool hit = collideSphereBox(b, a, contact);
+	contact.normal = -contact.normal;
+	return hit;
+}
+
+void CpuPhysicsBackend::bodiesChanged() {
+	m_broadphase.invalidate();
+}
+
+void CpuPhysicsBackend::step(PhysicsState& state, float dt) {
+	ZoneScoped;
+
+	auto& bodies = state.bodies;
+	{
+		ZoneScopedN("integrate");
+		for (PhysicsBody& body : bodies) {
+			if (body.isStatic()) {
+				continue;
+			}
+			body.velocity += state.gravity * (body.gravity_scale * dt);
+			body.position += body.velocity * dt;
+		}
+	}
+
+	m_bounds.resize(bodies.size());
+	for (size_t i = 0; i < bodies.size(); ++i) {
+		m_bounds[i] = bodies[i].bounds();
+	}
+	m_broadphase.findPairs(m_bounds, m_pairs);
+
+	ZoneScopedN("narrowphase");
+	for (const BroadphasePair& pair : m_pairs) {
+		PhysicsBody& a = bodies[pair.a];
+		PhysicsBody& b = bodies[pair.b];
+		if (a.isStatic() and b.isStatic()) {
+			continue;
+		}
+		if (not(a.layer & b.mask) or not(b.layer & a.mask)) {
+			continue;
+		}
+
+		Contact contact {.a = pair.a, .b = pair.b};
+		if (not collide(a, b, contact)) {
+			continue;
+		}
+		state.contacts.push_back(contact);
+
+		if (not a.trigger and not b.trigger) {
+			resolveContact(a, b, contact);
+		}
+	}
+}
+
+}
@@ -0,0 +1,44 @@
+/**
+ * @file cpu_backend.hpp
+ * @author Xein
+ * @date 18 Oct 2026
+ *
+ * @brief Built-in single-threaded physics solver
+ */
+
+#pragma once
+#include "physics_backend.hpp"
+
+namespace physics {
+
+/**
+ * @brief Semi-implicit Euler integration with sweep-and-prune and impulse contacts
+ *
+ * Handles spheres and axis-aligned boxes; body rotation is not simulated. Enough for gameplay
+ * overlap queries, pickups and simple stacking. Anything heavier should go in its own backend
+ */
+class TOAST_API CpuPhysicsBackend final : public IPhysicsBackend {
+public:
+	[[nodiscard]]
+	auto name() const noexcept -> std::string_view override {
+		return "cpu";
+	}
+
+	void bodiesChanged() override;
+	void step(PhysicsState& state, float dt) override;
+
+private:
+	std::vector<Aabb> m_bounds;
+	std::vector<BroadphasePair> m_pairs;
+	SweepAndPrune m_broadphase;
+};
+
+/**
+ * @brief Tests two shapes for penetration
+ * @param contact Filled with normal (a to b) and depth when the shapes touch; indices are left alone
+ * @return true if the shapes overlap
+ */
+[[nodiscard]]
+TOAST_API auto collide(const PhysicsBody& a, const PhysicsBody& b, Contact& contact) noexcept -> bool;
+
+}
@@ -0,0 +1,13 @@
+/**
+ * @file nodes.hpp
+ * @author Xein
+ * @date 18 Oct 2026
+ * @brief Wrapper file with all collider node files
+ *
+ * TOAST_API
+ */
+
+#pragma once
+#include "box_collider.hpp"
+#include "collider.hpp"
+#include "sphere_collider.hpp"
@@ -0,0 +1,91 @@
+/**
+ * @file physics_backend.hpp
+ * @author Xein
+ * @date 18 Oct 2026
+ *
+ * @brief Body data shared with physics solvers and the interface they implement
+ */
+
+#pragma once
+#include "broadphase.hpp"
+
+#include <cstdint>
+#include <glm/glm.hpp>
+#include <string_view>
+#include <toast/export.hpp>
+#include <vector>
+
+namespace physics {
+
+enum class ShapeType : uint8_t {
+	sphere,
+	box,
+};
+
+/**
+ * @brief World-space snapshot of one collider, gathered by PhysicsScene before each step
+ *
+ * Backends read and write position and velocity; everything else is input only
+ */
+struct PhysicsBody {
+	glm::vec3 position {0.0f};
+	glm::vec3 velocity {0.0f};
+	glm::vec3 extents {0.0f};    ///< box: world half-extents; sphere: radius in x
+	float inv_mass = 0.0f;       ///< 0 for static bodies
+	float restitution = 0.0f;
+	float gravity_scale = 1.0f;
+	uint32_t layer = 1;
+	uint32_t mask = ~0u;    ///< layers this body collides with; a pair needs both masks to match
+	ShapeType shape = ShapeType::sphere;
+	bool trigger = false;    ///< reports contacts but is never pushed and never pushes
+
+	[[nodiscard]]
+	auto bounds() const noexcept -> Aabb {
+		const glm::vec3 half = shape == ShapeType::sphere ? glm::vec3(extents.x) : extents;
+		return {position - half, position + half};
+	}
+
+	[[nodiscard]]
+	auto isStatic() const noexcept -> bool {
+		return inv_mass == 0.0f;
+	}
+};
+
+/// Two touching bodies by index; normal points from a to b
+struct Contact {
+	uint32_t a = 0;
+	uint32_t b = 0;
+	glm::vec3 normal {0.0f, 0.0f, 1.0f};
+	float depth = 0.0f;
+};
+
+struct PhysicsState {
+	std::vector<PhysicsBody> bodies;
+	std::vector<Contact> contacts;    ///< cleared by PhysicsScene before every sub-step
+	glm::vec3 gravity {0.0f, 0.0f, -9.81f};
+};
+
+/**
+ * @brief Solver plugged into a PhysicsScene
+ *
+ * The scene owns the bodies and the Node3D write-back; a backend only has to advance the state by
+ * one sub-step. The built-in one is CpuPhysicsBackend
+ */
+class TOAST_API IPhysicsBackend {
+public:
+	virtual ~IPhysicsBackend() = default;
+
+	[[nodiscard]]
+	virtual auto name() const noexcept -> std::string_view = 0;
+
+	/// Bodies were added, removed or reordered; indices from earlier steps no longer mean the same body
+	virtual void bodiesChanged() { }
+
+	/**
+	 * @brief Advances every body by dt and appends the contacts found to state.contacts
+	 * @param dt Sub-step length in seconds, never 0
+	 */
+	virtual void step(PhysicsState& state, float dt) = 0;
+};
+
+}
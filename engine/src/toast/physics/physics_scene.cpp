@@ -0,0 +1,205 @@
+#include "physics_scene.hpp"
+
+#include "collider.hpp"
+#include "cpu_backend.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <toast/log.hpp>
+#include <toast/profiler.hpp>
+#include <tracy/Tracy.hpp>
+#include <tuple>
+
+namespace physics {
+
+namespace {
+
+auto hierarchyDepth(toast::Node& node) -> uint32_t {
+	uint32_t depth = 0;
+	for (toast::Box<toast::Node> parent = node.parent(); parent.exists(); parent = parent->parent()) {
+		++depth;
+	}
+	return depth;
+}
+
+}
+
+PhysicsScene::PhysicsScene() : PhysicsScene(std::make_unique<CpuPhysicsBackend>()) { }
+
+PhysicsScene::PhysicsScene(std::unique_ptr<IPhysicsBackend> backend) : m_backend(std::move(backend)) { }
+
+// Colliders are not touched here; they look the scene up through their owner every time
+PhysicsScene::~PhysicsScene() = default;
+
+void PhysicsScene::setBackend(std::unique_ptr<IPhysicsBackend> backend) {
+	m_backend = backend ? std::move(backend) : std::make_unique<CpuPhysicsBackend>();
+	m_backend->bodiesChanged();
+	TOAST_INFO("Physics", "Using the {} physics backend", m_backend->name());
+}
+
+auto PhysicsScene::backend() const noexcept -> IPhysicsBackend& {
+	return *m_backend;
+}
+
+void PhysicsScene::add(toast::Collider& collider) {
+	std::scoped_lock lock(m_mutex);
+	if (collider.m_body != toast::Collider::no_body) {
+		return;
+	}
+
+	collider.m_body = static_cast<uint32_t>(m_colliders.size());
+	m_colliders.push_back(&collider);
+	m_dirty = true;
+}
+
+void PhysicsScene::remove(toast::Collider& collider) {
+	std::scoped_lock lock(m_mutex);
+	if (collider.m_body == toast::Collider::no_body) {
+		return;
+	}
+
+	m_colliders[collider.m_body] = nullptr;
+	collider.m_body = toast::Collider::no_body;
+	collider.m_contact_count = 0;
+	m_dirty = true;
+
+	std::erase_if(m_contacts, [&collider](const ColliderContact& contact) {
+		return contact.a == &collider or contact.b == &collider;
+	});
+}
+
+void PhysicsScene::step(float dt) {
+	TOAST_ZONE("PhysicsScene::step");
+
+	if (dt <= 0.0f) {
+		return;
+	}
+
+	{
+		std::scoped_lock lock(m_mutex);
+		if (m_dirty) {
+			rebuild();
+			m_dirty = false;
+		}
+	}
+
+	for (toast::Collider* collider : m_colliders) {
+		collider->m_contact_count = 0;
+	}
+	m_contacts.clear();
+	m_step_contacts.clear();
+	if (m_colliders.empty()) {
+		return;
+	}
+
+	gather();
+
+	// The small bias keeps 1/60 * 120 from rounding up to a third sub-step
+	const double wanted = m_substep_rate > 0.0 ? std::ceil(dt * m_substep_rate - 1e-3) : 1.0;
+	const uint32_t substeps = std::clamp(static_cast<uint32_t>(wanted), 1u, std::max(m_max_substeps, 1u));
+	const float substep = dt / static_cast<float>(substeps);
+	ZoneValue(substeps);
+
+	for (uint32_t i = 0; i < substeps; ++i) {
+		m_state.contacts.clear();
+		m_backend->step(m_state, substep);
+		m_step_contacts.insert(m_step_contacts.end(), m_state.contacts.begin(), m_state.contacts.end());
+	}
+
+	writeBack();
+	collectContacts();
+}
+
+void PhysicsScene::rebuild() {
+	ZoneScoped;
+
+	std::erase(m_colliders, nullptr);
+
+	// Write-back goes in this order, so a parent collider has its new world transform before its children read it
+	std::vector<std::pair<uint32_t, toast::Collider*>> by_depth;
+	by_depth.reserve(m_colliders.size());
+	for (toast::Collider* collider : m_colliders) {
+		by_depth.emplace_back(hierarchyDepth(*collider), collider);
+	}
+	std::ranges::stable_sort(by_depth, {}, &std::pair<uint32_t, toast::Collider*>::first);
+
+	for (uint32_t i = 0; i < by_depth.size(); ++i) {
+		m_colliders[i] = by_depth[i].second;
+		m_colliders[i]->m_body = i;
+	}
+
+	m_state.bodies.resize(m_colliders.size());
+	m_backend->bodiesChanged();
+}
+
+void PhysicsScene::gather() {
+	ZoneScoped;
+
+	for (size_t i = 0; i < m_colliders.size(); ++i) {
+		m_colliders[i]->gather(m_state.bodies[i]);
+	}
+}
+
+void PhysicsScene::writeBack() {
+	ZoneScoped;
+
+	for (size_t i = 0; i < m_colliders.size(); ++i) {
+		if (not m_state.bodies[i].isStatic()) {
+			m_colliders[i]->applySimulation(m_state.bodies[i]);
+		}
+	}
+}
+
+void PhysicsScene::collectContacts() {
+	// A pair touching in several sub-steps is reported once, with its first contact
+	std::ranges::stable_sort(m_step_contacts, [](const Contact& lhs, const Contact& rhs) {
+		return std::tie(lhs.a, lhs.b) < std::tie(rhs.a, rhs.b);
+	});
+	const auto duplicates = std::ranges::unique(m_step_contacts, [](const Contact& lhs, const Contact& rhs) {
+		return lhs.a == rhs.a and lhs.b == rhs.b;
+	});
+	m_step_contacts.erase(duplicates.begin(), duplicates.end());
+
+	m_contacts.reserve(m_step_contacts.size());
+	for (const Contact& contact : m_step_contacts) {
+		toast::Collider* a = m_colliders[contact.a];
+		toast::Collider* b = m_colliders[contact.b];
+		++a->m_contact_count;
+		++b->m_contact_count;
+		m_contacts.push_back({a, b, contact.normal, contact.depth});
+	}
+}
+
+auto PhysicsScene::gravity() const noexcept -> glm::vec3 {
+	return m_state.gravity;
+}
+
+void PhysicsScene::gravity(glm::vec3 value) noexcept {
+	m_state.gravity = value;
+}
+
+auto PhysicsScene::substepRate() const noexcept -> double {
+	return m_substep_rate;
+}
+
+void PhysicsScene::substepRate(double hz) noexcept {
+	m_substep_rate = hz;
+}
+
+auto PhysicsScene::maxSubsteps() const noexcept -> uint32_t {
+	return m_max_substeps;
+}
+
+void PhysicsScene::maxSubsteps(uint32_t value) noexcept {
+	m_max_substeps = value;
+}
+
+auto PhysicsScene::bodyCount() const noexcept -> size_t {
+	return m_colliders.size();
+}
+
+auto PhysicsScene::contacts() const noexcept -> std::span<const ColliderContact> {
+	return m_contacts;
+}
+
+}
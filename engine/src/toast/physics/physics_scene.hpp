@@ -0,0 +1,107 @@
+/**
+ * @file physics_scene.hpp
+ * @author Xein
+ * @date 18 Oct 2026
+ *
+ * @brief Per-owner physics stage that runs between the tick and post_physics phases
+ */
+
+#pragma once
+#include "physics_backend.hpp"
+
+#include <memory>
+#include <mutex>
+#include <span>
+#include <toast/export.hpp>
+#include <vector>
+
+namespace toast {
+class Collider;
+}
+
+namespace physics {
+
+/// Contact between two colliders found during the last step; pointers stay valid until the next one
+struct ColliderContact {
+	toast::Collider* a = nullptr;
+	toast::Collider* b = nullptr;
+	glm::vec3 normal {0.0f, 0.0f, 1.0f};    ///< from a to b
+	float depth = 0.0f;
+};
+
+/**
+ * @brief Collects the colliders of one node owner and steps them through an IPhysicsBackend
+ *
+ * Every fixed step the scene gathers the enabled colliders into PhysicsState, runs the backend
+ * once per sub-step and writes the results back into the Node3D hierarchy in one pass, parents
+ * before children. Sub-steps split the fixed step so no sub-step is longer than 1 / substepRate()
+ *
+ * Colliders register themselves on enable; nothing here is reflected or serialized
+ */
+class TOAST_API PhysicsScene {
+public:
+	PhysicsScene();
+	explicit PhysicsScene(std::unique_ptr<IPhysicsBackend> backend);
+	~PhysicsScene();
+
+	PhysicsScene(const PhysicsScene&) = delete;
+	auto operator=(const PhysicsScene&) -> PhysicsScene& = delete;
+
+	/// Replaces the solver; the new backend starts from the current body state
+	void setBackend(std::unique_ptr<IPhysicsBackend> backend);
+
+	[[nodiscard]]
+	auto backend() const noexcept -> IPhysicsBackend&;
+
+	void add(toast::Collider& collider);
+	void remove(toast::Collider& collider);
+
+	/**
+	 * @brief Runs the physics stage for one fixed step
+	 * @param dt Length of the step, normally Time::delta() inside the tick; 0 skips the stage
+	 */
+	void step(float dt);
+
+	[[nodiscard]]
+	auto gravity() const noexcept -> glm::vec3;
+	void gravity(glm::vec3 value) noexcept;
+
+	/// Sub-steps per second; a 60 Hz step at the default 120 runs two sub-steps
+	[[nodiscard]]
+	auto substepRate() const noexcept -> double;
+	void substepRate(double hz) noexcept;
+
+	/// Most sub-steps one step may run; long variable-rate steps get longer sub-steps instead
+	[[nodiscard]]
+	auto maxSubsteps() const noexcept -> uint32_t;
+	void maxSubsteps(uint32_t value) noexcept;
+
+	[[nodiscard]]
+	auto bodyCount() const noexcept -> size_t;
+
+	/// Every pair that touched during any sub-step of the last step, once per pair
+	[[nodiscard]]
+	auto contacts() const noexcept -> std::span<const ColliderContact>;
+
+private:
+	/// Drops removed colliders and sorts the rest by hierarchy depth so write-back runs parents first
+	void rebuild();
+	void gather();
+	void writeBack();
+	void collectContacts();
+
+	std::unique_ptr<IPhysicsBackend> m_backend;
+	PhysicsState m_state;
+
+	std::mutex m_mutex;    ///< colliders may be enabled or disabled from tick jobs
+	std::vector<toast::Collider*> m_colliders;    ///< null where a collider was removed since the last rebuild
+	bool m_dirty = false;
+
+	std::vector<Contact> m_step_contacts;    ///< all sub-step contacts of the current step, by body index
+	std::vector<ColliderContact> m_contacts;
+
+	double m_substep_rate = 120.0;
+	uint32_t m_max_substeps = 8;
+};
+
+}
@@ -0,0 +1,21 @@
+#include "sphere_collider.hpp"
+
+#include "physics_backend.hpp"
+
+namespace toast {
+
+auto SphereCollider::radius() const -> float {
+	return m_radius;
+}
+
+void SphereCollider::radius(float value) {
+	m_radius = value;
+}
+
+void SphereCollider::writeShape(physics::PhysicsBody& body) const {
+	const glm::vec3 scale = glm::abs(world_scale);
+	body.shape = physics::ShapeType::sphere;
+	body.extents = glm::vec3(m_radius * glm::max(scale.x, glm::max(scale.y, scale.z)), 0.0f, 0.0f);
+}
+
+}
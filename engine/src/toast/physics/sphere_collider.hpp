@@ -0,0 +1,30 @@
+/**
+ * @file sphere_collider.hpp
+ * @author Xein
+ * @date 18 Oct 2026
+ *
+ * @brief Sphere collider
+ */
+
+#pragma once
+#include "collider.hpp"
+
+namespace toast {
+
+/**
+ * @brief Sphere collider; non-uniform scale uses the largest axis
+ */
+class TOAST_API [[ToastNode]] SphereCollider : public Collider {
+public:
+	[[nodiscard]]
+	auto radius() const -> float;
+	void radius(float value);
+
+protected:
+	void writeShape(physics::PhysicsBody& body) const override;
+
+	[[Reflect, Unit("m")]]
+	float m_radius = 0.5f;
+};
+
+}
@@ -0,0 +1,277 @@
+#include "profiler.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <limits>
+#include <toast/log.hpp>
+#include <utility>
+
+namespace toast {
+
+namespace {
+
+constexpr uint32_t no_open_zone = std::numeric_limits<uint32_t>::max();
+
+std::atomic<uint64_t> profiler_generations = 0;
+
+template<typename Duration>
+auto profilerMs(Duration duration) -> double {
+	return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+}
+
+struct Profiler::ThreadZones {
+	struct Record {
+		const char* name;
+		uint32_t parent;
+		uint32_t depth;
+		Clock::time_point start;
+		Clock::time_point end;
+	};
+
+	uint32_t thread = 0;    ///< registration order, only used to label the dumps
+	uint32_t open = no_open_zone;
+	uint32_t depth = 0;
+	std::vector<Record> records;
+};
+
+namespace {
+
+// Cached per thread; the generation tells a buffer of a destroyed Profiler from the current one's
+thread_local Profiler::ThreadZones* profiler_thread_zones = nullptr;
+thread_local uint64_t profiler_thread_generation = 0;
+
+}
+
+Profiler::Scope::Scope(const char* name) noexcept {
+	Profiler* profiler = instance;
+	if (profiler == nullptr or not profiler->m_enabled.load(std::memory_order_relaxed)) {
+		return;
+	}
+
+	m_zones = profiler->threadZones();
+	m_index = static_cast<uint32_t>(m_zones->records.size());
+	m_zones->records.push_back({name, m_zones->open, m_zones->depth, Clock::now(), {}});
+	m_zones->open = m_index;
+	++m_zones->depth;
+}
+
+Profiler::Scope::~Scope() {
+	if (m_zones == nullptr) {
+		return;
+	}
+
+	auto& record = m_zones->records[m_index];
+	record.end = Clock::now();
+	m_zones->open = record.parent;
+	--m_zones->depth;
+}
+
+Profiler::Profiler() : m_generation(++profiler_generations), m_frame_start(Clock::now()) {
+	instance = this;
+	findZone(frame_zone);
+}
+
+Profiler::~Profiler() {
+	if (instance == this) {
+		instance = nullptr;
+	}
+}
+
+auto Profiler::get() noexcept -> Profiler* {
+	return instance;
+}
+
+void Profiler::setEnabled(bool enabled) noexcept {
+	m_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+auto Profiler::enabled() const noexcept -> bool {
+	return m_enabled.load(std::memory_order_relaxed);
+}
+
+void Profiler::setBudget(std::string_view zone, double ms) {
+	std::scoped_lock lock(m_zones_mutex);
+	m_zones[findZone(zone)].budget_ms = std::max(ms, 0.0);
+}
+
+void Profiler::setSpikeDirectory(std::filesystem::path directory, uint32_t max_dumps) {
+	std::scoped_lock lock(m_zones_mutex);
+	m_spike_directory = std::move(directory);
+	m_max_spike_dumps = max_dumps;
+}
+
+auto Profiler::threadZones() -> ThreadZones* {
+	if (profiler_thread_generation == m_generation) {
+		return profiler_thread_zones;
+	}
+
+	std::scoped_lock lock(m_threads_mutex);
+	auto zones = std::make_unique<ThreadZones>();
+	zones->thread = static_cast<uint32_t>(m_threads.size());
+	zones->records.reserve(64);
+	profiler_thread_zones = zones.get();
+	profiler_thread_generation = m_generation;
+	m_threads.push_back(std::move(zones));
+	return profiler_thread_zones;
+}
+
+auto Profiler::findZone(std::string_view name) -> uint32_t {
+	for (uint32_t i = 0; i < m_zones.size(); ++i) {
+		if (m_zones[i].name == name) {
+			return i;
+		}
+	}
+
+	m_zones.push_back({.name = std::string(name)});
+	m_zones.back().history.reserve(history_frames);
+	m_frame_totals.push_back(0.0);
+	return static_cast<uint32_t>(m_zones.size() - 1);
+}
+
+auto Profiler::zoneIndex(const char* name) -> uint32_t {
+	// Names are literals or long-lived strings, so the pointer is a good key; the compare guards reuse
+	if (const auto it = m_zone_by_pointer.find(name); it != m_zone_by_pointer.end() and m_zones[it->second].name == name) {
+		return it->second;
+	}
+	const uint32_t index = findZone(name);
+	m_zone_by_pointer[name] = index;
+	return index;
+}
+
+void Profiler::endFrame() {
+	ZoneScoped;
+
+	const auto now = Clock::now();
+	const auto frame_start = std::exchange(m_frame_start, now);
+	const double frame_ms = profilerMs(now - frame_start);
+
+	std::scoped_lock lock(m_threads_mutex, m_zones_mutex);
+	std::ranges::fill(m_frame_totals, 0.0);
+	m_frame_totals[0] = frame_ms;
+
+	for (const auto& thread : m_threads) {
+		// Still inside a zone; it gets folded into the frame it closes in
+		if (thread->open != no_open_zone) {
+			continue;
+		}
+		for (const auto& record : thread->records) {
+			if (record.parent != no_open_zone and std::strcmp(thread->records[record.parent].name, record.name) == 0) {
+				continue;
+			}
+			m_frame_totals[zoneIndex(record.name)] += profilerMs(record.end - record.start);
+		}
+	}
+
+	std::vector<uint32_t> offenders;
+	for (uint32_t i = 0; i < m_zones.size(); ++i) {
+		Zone& zone = m_zones[i];
+		zone.last_ms = m_frame_totals[i];
+		if (zone.history.size() < history_frames) {
+			zone.history.push_back(static_cast<float>(zone.last_ms));
+		} else {
+			zone.history[zone.cursor] = static_cast<float>(zone.last_ms);
+		}
+		zone.cursor = (zone.cursor + 1) % history_frames;
+
+		if (zone.budget_ms > 0.0 and zone.last_ms > zone.budget_ms) {
+			++zone.over_budget;
+			offenders.push_back(i);
+		}
+	}
+	++m_frames;
+
+	if (not offenders.empty()) {
+		++m_over_budget_frames;
+		TracyMessageL("Frame over budget");
+		if (not m_spike_directory.empty() and m_spike_dumps < m_max_spike_dumps) {
+			dumpSpike(offenders, frame_start, frame_ms);
+		}
+	}
+
+	for (const auto& thread : m_threads) {
+		if (thread->open == no_open_zone) {
+			thread->records.clear();
+		}
+	}
+}
+
+void Profiler::dumpSpike(const std::vector<uint32_t>& offenders, Clock::time_point frame_start, double frame_ms) {
+	std::error_code ec;
+	std::filesystem::create_directories(m_spike_directory, ec);
+	const auto path = m_spike_directory / std::format("frame_{}.txt", m_frames);
+	std::ofstream out(path, std::ios::trunc);
+	if (!out.is_open()) {
+		TOAST_WARN("Profiler", "Cannot write spike dump {}", path.string());
+		return;
+	}
+	++m_spike_dumps;
+
+	out << std::format("frame {}  {:.3f} ms\n", m_frames, frame_ms);
+	for (const uint32_t index : offenders) {
+		const Zone& zone = m_zones[index];
+		out << std::format("over budget: {}  {:.3f} ms > {:.3f} ms\n", zone.name, zone.last_ms, zone.budget_ms);
+	}
+
+	// Records are stored in the order they opened, so walking them in order prints the tree
+	for (const auto& thread : m_threads) {
+		if (thread->records.empty() or thread->open != no_open_zone) {
+			continue;
+		}
+		out << std::format("\nthread {}\n    start (ms)  duration (ms)  zone\n", thread->thread);
+		for (const auto& record : thread->records) {
+			out << std::format(
+			    "{:14.3f} {:14.3f}  {:{}}{}\n",
+			    profilerMs(record.start - frame_start),
+			    profilerMs(record.end - record.start),
+			    "",
+			    record.depth * 2,
+			    record.name
+			);
+		}
+	}
+
+	TOAST_WARN("Profiler", "Frame {} went over budget at {:.2f} ms; zone tree written to {}", m_frames, frame_ms, path.string());
+}
+
+auto Profiler::stats() const -> std::vector<Stats> {
+	std::scoped_lock lock(m_zones_mutex);
+	std::vector<Stats> out;
+	out.reserve(m_zones.size());
+
+	std::vector<float> sorted;
+	for (const Zone& zone : m_zones) {
+		Stats stats {.name = zone.name, .last_ms = zone.last_ms, .budget_ms = zone.budget_ms, .over_budget = zone.over_budget};
+		if (not zone.history.empty()) {
+			sorted.assign(zone.history.begin(), zone.history.end());
+			std::ranges::sort(sorted);
+			const auto percentile = [&](double p) {
+				return sorted[std::min(sorted.size() - 1, static_cast<size_t>(p * static_cast<double>(sorted.size() - 1) + 0.5))];
+			};
+			stats.p50_ms = percentile(0.50);
+			stats.p99_ms = percentile(0.99);
+			stats.max_ms = sorted.back();
+		}
+		out.push_back(std::move(stats));
+	}
+	return out;
+}
+
+void Profiler::logSummary() const {
+	for (const Stats& zone : stats()) {
+		TOAST_INFO(
+		    "Profiler",
+		    "{:<32} p50 {:8.3f}  p99 {:8.3f}  max {:8.3f} ms  budget {}",
+		    zone.name,
+		    zone.p50_ms,
+		    zone.p99_ms,
+		    zone.max_ms,
+		    zone.budget_ms > 0.0 ? std::format("{:.3f} ms, over in {} frames", zone.budget_ms, zone.over_budget) : "none"
+		);
+	}
+}
+
+}
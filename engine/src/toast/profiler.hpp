@@ -0,0 +1,160 @@
+/**
+ * @file profiler.hpp
+ * @author Xein
+ * @date 18 Oct 2026
+ *
+ * @brief Always-on frame profiler: rolling per-zone statistics, budgets and spike dumps without Tracy
+ */
+
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <toast/export.hpp>
+#include <tracy/Tracy.hpp>
+#include <unordered_map>
+#include <vector>
+
+namespace toast {
+
+/**
+ * @brief Aggregates TOAST_ZONE scopes into per-zone frame totals and checks them against budgets
+ *
+ * Every thread appends its zones to its own buffer, so opening a zone costs two clock reads and a
+ * push_back. endFrame() folds the buffers into rolling histories of the last history_frames frames.
+ * A frame over its budget, or with any zone over its own, gets its zone tree written to the spike
+ * directory
+ *
+ * Zones with the same name add up within a frame; a zone nested in one of the same name doesn't
+ * count twice
+ */
+class TOAST_API Profiler {
+public:
+	/// Name of the pseudo-zone covering the whole frame, from one endFrame() to the next
+	static constexpr std::string_view frame_zone = "Frame";
+	static constexpr uint32_t history_frames = 300;
+
+	struct ThreadZones;    ///< @internal one buffer per thread that opened a zone
+
+	struct Stats {
+		std::string name;
+		double last_ms = 0.0;
+		double p50_ms = 0.0;
+		double p99_ms = 0.0;
+		double max_ms = 0.0;
+		double budget_ms = 0.0;       ///< 0 when the zone has no budget
+		uint64_t over_budget = 0;     ///< frames this zone went over its budget, over the whole run
+	};
+
+	/// RAII zone; prefer the TOAST_ZONE macro, which also opens the matching Tracy zone
+	class TOAST_API Scope {
+	public:
+		/// @param name must outlive the frame; string literals and stage names do
+		explicit Scope(const char* name) noexcept;
+		~Scope();
+
+		Scope(const Scope&) = delete;
+		auto operator=(const Scope&) -> Scope& = delete;
+
+	private:
+		ThreadZones* m_zones = nullptr;
+		uint32_t m_index = 0;
+	};
+
+	Profiler();
+	~Profiler();
+
+	Profiler(const Profiler&) = delete;
+	auto operator=(const Profiler&) -> Profiler& = delete;
+
+	static auto get() noexcept -> Profiler*;
+
+	/// Disabled zones return before touching the clock
+	void setEnabled(bool enabled) noexcept;
+
+	[[nodiscard]]
+	auto enabled() const noexcept -> bool;
+
+	/// @param ms 0 removes the budget; frame_zone sets the whole-frame budget
+	void setBudget(std::string_view zone, double ms);
+
+	/// @param directory where over-budget frames are dumped; empty disables the dumps
+	/// @param max_dumps dumps written per run, so a bad level doesn't fill the disk
+	void setSpikeDirectory(std::filesystem::path directory, uint32_t max_dumps = 16);
+
+	/**
+	 * @brief Closes the frame: folds every thread's zones into the histories and checks the budgets
+	 * @note Call where no zone is open on any thread; Engine::tick does after the stage barrier
+	 */
+	void endFrame();
+
+	/// frame_zone first, then every zone in the order it was first seen or given a budget
+	[[nodiscard]]
+	auto stats() const -> std::vector<Stats>;
+
+	[[nodiscard]]
+	auto frames() const noexcept -> uint64_t {
+		return m_frames;
+	}
+
+	/// Frames where the frame or any zone went over budget
+	[[nodiscard]]
+	auto overBudgetFrames() const noexcept -> uint64_t {
+		return m_over_budget_frames;
+	}
+
+	/// Writes one line per zone with its p50, p99, max and budget to the log
+	void logSummary() const;
+
+private:
+	using Clock = std::chrono::steady_clock;
+
+	struct Zone {
+		std::string name;
+		double budget_ms = 0.0;
+		std::vector<float> history;    ///< per-frame totals, a ring once it reaches history_frames
+		uint32_t cursor = 0;
+		double last_ms = 0.0;
+		uint64_t over_budget = 0;
+	};
+
+	auto zoneIndex(const char* name) -> uint32_t;
+	auto findZone(std::string_view name) -> uint32_t;
+	auto threadZones() -> ThreadZones*;
+	void dumpSpike(const std::vector<uint32_t>& offenders, Clock::time_point frame_start, double frame_ms);
+
+	static inline Profiler* instance = nullptr;
+
+	std::atomic<bool> m_enabled = true;
+	uint64_t m_generation = 0;    ///< tells thread buffers of a previous Profiler apart
+	uint64_t m_frames = 0;
+	uint64_t m_over_budget_frames = 0;
+	Clock::time_point m_frame_start;
+
+	std::mutex m_threads_mutex;
+	std::vector<std::unique_ptr<ThreadZones>> m_threads;
+
+	mutable std::mutex m_zones_mutex;    ///< stats() may be called from the editor's thread
+	std::vector<Zone> m_zones;
+	std::unordered_map<const char*, uint32_t> m_zone_by_pointer;
+	std::vector<double> m_frame_totals;
+
+	std::filesystem::path m_spike_directory;
+	uint32_t m_max_spike_dumps = 16;
+	uint32_t m_spike_dumps = 0;
+};
+
+}
+
+#define TOAST_ZONE_CAT_IMPL(a, b) a##b
+#define TOAST_ZONE_CAT(a, b) TOAST_ZONE_CAT_IMPL(a, b)
+
+/// @brief A Tracy zone that the in-engine Profiler also counts; name must be a string literal
+#define TOAST_ZONE(name)                                                                     \
+	ZoneScopedN(name);                                                                         \
+	const ::toast::Profiler::Scope TOAST_ZONE_CAT(toast_zone_, __LINE__) { name }
@@ -46,6 +46,8 @@ ProjectSettings::ProjectSettings(const std::filesystem::path& path) {
 			if (auto uri = (*gameplay)["player"].value<std::string>()) {
 				m_gameplay_settings.m_player = make_handle(*uri);
 			}
+			m_gameplay_settings.m_tick_rate = (*gameplay)["tick_rate"].value_or(60.0);
+			m_gameplay_settings.m_max_steps_per_frame = (*gameplay)["max_steps_per_frame"].value_or(8u);
 		}
 
 		if (auto* ui = table["ui"].as_table()) {
@@ -65,6 +67,27 @@ ProjectSettings::ProjectSettings(const std::filesystem::path& path) {
 			}
 		}
 
+		if (auto* profiler = table["profiler"].as_table()) {
+			m_profiler_settings.m_frame_budget_ms = (*profiler)["frame_budget_ms"].value_or(0.0);
+			m_profiler_settings.m_spike_directory = (*profiler)["spike_dir"].value_or<std::string>("profiler");
+			m_profiler_settings.m_max_spike_dumps = (*profiler)["max_spike_dumps"].value_or(16u);
+			if (auto* budgets = (*profiler)["budgets"].as_table()) {
+				for (const auto& [zone, ms] : *budgets) {
+					if (auto value = ms.value<double>()) {
+						m_profiler_settings.m_budgets.emplace_back(std::string(zone.str()), *value);
+					}
+				}
+			}
+			if (auto* budgets = (*profiler)["memory_budgets_mb"].as_table()) {
+				for (const auto& [tag, mb] : *budgets) {
+					if (auto value = mb.value<double>()) {
+						m_profiler_settings.m_memory_budgets.emplace_back(std::string(tag.str()), static_cast<uint64_t>(*value * 1024.0 * 1024.0));
+					}
+				}
+			}
+			m_profiler_settings.m_leak_report = (*profiler)["leak_report"].value_or(false);
+		}
+
 		TOAST_INFO("ProjectSettings", "Loaded '{}' {} — {} database(s)", m_name, version(), m_databases.size());
 
 	} catch (const std::exception& e) {
@@ -12,6 +12,7 @@
 #include <string_view>
 #include <toast/assets/types.hpp>
 #include <toast/export.hpp>
+#include <utility>
 #include <vector>
 
 namespace toast {
@@ -28,10 +29,24 @@ public:
 		return m_player;
 	}
 
+	/// Fixed simulation steps per second; 0 ticks once per frame with the variable delta
+	[[nodiscard]]
+	auto tickRate() const {
+		return m_tick_rate;
+	}
+
+	/// Most fixed steps one frame may run before the backlog is dropped
+	[[nodiscard]]
+	auto maxStepsPerFrame() const {
+		return m_max_steps_per_frame;
+	}
+
 private:
 	friend class ProjectSettings;
 	assets::Handle<assets::Prefab> m_init_scene;
 	assets::Handle<assets::Prefab> m_player;
+	double m_tick_rate = 60.0;
+	unsigned m_max_steps_per_frame = 8;
 };
 
 class TOAST_API UISettings {
@@ -53,6 +68,53 @@ private:
 	std::vector<std::string> m_languages {"en"};
 };
 
+class TOAST_API ProfilerSettings {
+public:
+	/// Whole-frame budget in milliseconds; 0 means none
+	[[nodiscard]]
+	auto frameBudgetMs() const {
+		return m_frame_budget_ms;
+	}
+
+	/// Per-zone budgets in milliseconds, keyed by TOAST_ZONE or frame stage name
+	[[nodiscard]]
+	auto budgets() const -> const std::vector<std::pair<std::string, double>>& {
+		return m_budgets;
+	}
+
+	/// Folder under cache:// that over-budget frames are dumped to; empty disables the dumps
+	[[nodiscard]]
+	auto spikeDirectory() const -> const std::string& {
+		return m_spike_directory;
+	}
+
+	[[nodiscard]]
+	auto maxSpikeDumps() const {
+		return m_max_spike_dumps;
+	}
+
+	/// Per-subsystem memory budgets in bytes, keyed by MemoryTracker tag name
+	[[nodiscard]]
+	auto memoryBudgets() const -> const std::vector<std::pair<std::string, uint64_t>>& {
+		return m_memory_budgets;
+	}
+
+	/// Log what each subsystem still holds once the engine shut down
+	[[nodiscard]]
+	auto leakReport() const {
+		return m_leak_report;
+	}
+
+private:
+	friend class ProjectSettings;
+	double m_frame_budget_ms = 0.0;
+	std::vector<std::pair<std::string, double>> m_budgets;
+	std::string m_spike_directory = "profiler";
+	unsigned m_max_spike_dumps = 16;
+	std::vector<std::pair<std::string, uint64_t>> m_memory_budgets;
+	bool m_leak_report = false;
+};
+
 class TOAST_API ProjectSettings {
 public:
 	explicit ProjectSettings(const std::filesystem::path& path);
@@ -72,6 +134,8 @@ public:
 
 	static auto uiSettings() -> const UISettings& { return instance->m_ui_settings; }
 
+	static auto profilerSettings() -> const ProfilerSettings& { return instance->m_profiler_settings; }
+
 private:
 	static inline ProjectSettings* instance = nullptr;
 	std::string m_name;
@@ -79,6 +143,7 @@ private:
 	std::vector<std::string> m_databases;
 	GameplaySettings m_gameplay_settings;
 	UISettings m_ui_settings;
+	ProfilerSettings m_profiler_settings;
 };
 
 }
@@ -44,17 +44,46 @@ enum class FieldType : uint8_t {
 	quaternion_t,
 };
 
+/**
+ * @brief Field attributes the generator understands, compiled to bits so hot paths never touch the JSON
+ *
+ * Attributes that carry values (Name, Group, Range, Unit...) stay in FieldInfo::attributes; they are
+ * only read by the inspector and the editor
+ */
+enum class FieldFlags : uint16_t {
+	none = 0,
+	read_only = 1 << 0,              ///< ReadOnly
+	no_serialize = 1 << 1,           ///< NoSerialize
+	hidden = 1 << 2,                 ///< Hidden
+	inspector_no_modify = 1 << 3,    ///< InspectorNoModify
+	color = 1 << 4,                  ///< Color
+	enumeration = 1 << 5,            ///< Enum
+	/// Fields that are never read back from prefabs or written to them
+	transient = read_only | no_serialize,
+};
+
+constexpr auto operator&(FieldFlags lhs, FieldFlags rhs) -> FieldFlags {
+	return static_cast<FieldFlags>(static_cast<uint16_t>(lhs) & static_cast<uint16_t>(rhs));
+}
+
+constexpr auto operator|(FieldFlags lhs, FieldFlags rhs) -> FieldFlags {
+	return static_cast<FieldFlags>(static_cast<uint16_t>(lhs) | static_cast<uint16_t>(rhs));
+}
+
 /**
  * @brief Runtime descriptor for one reflected field
  *
  * Holds type metadata, JSON attributes parsed from the header annotation (e.g. Group, Name),
  * and a type-erased getter/setter pair that works without knowing the concrete Node subtype.
+ * Generated fields also carry their exact C++ type and a thunk to the member's address, so
+ * callers that know the type can read and write it directly through typed()
  *
  * @note The getter returns std::any; the setter silently does nothing on a type mismatch
  */
 struct TOAST_API FieldInfo {
 	using FieldGetterPtr = std::any (*)(void*);
-	using FieldSetterPtr = void (*)(void*, std::any);
+	using FieldSetterPtr = void (*)(void*, const std::any&);
+	using FieldAddressPtr = void* (*)(void*);
 
 	std::string_view name;
 	std::string_view type;    // C++ type name
@@ -65,6 +94,36 @@ struct TOAST_API FieldInfo {
 	FieldGetterPtr get;
 	FieldSetterPtr set;
 
+	FieldFlags flags = FieldFlags::none;          // known attributes, see FieldFlags
+	const std::type_info* type_id = nullptr;      // typeid of the member as declared
+	FieldAddressPtr address = nullptr;            // pointer to the member inside obj
+
+	/// Checks compiled attribute bits; prefer this over hasAttribute() on hot paths
+	[[nodiscard]]
+	constexpr auto hasFlag(FieldFlags flag) const -> bool {
+		return (flags & flag) != FieldFlags::none;
+	}
+
+	/**
+	 * @brief Direct access to the member when its declared type is exactly T
+	 * @return Pointer to the member inside obj, or nullptr if the type differs or the field has no address thunk
+	 * @note No conversions happen here; Box<Derived> fields are not reachable as Box<Node>, use get/set for that
+	 */
+	template<typename T>
+	[[nodiscard]]
+	auto typed(void* obj) const -> T* {
+		if (address == nullptr || type_id == nullptr || *type_id != typeid(T)) {
+			return nullptr;
+		}
+		return static_cast<T*>(address(obj));
+	}
+
+	template<typename T>
+	[[nodiscard]]
+	auto typed(const void* obj) const -> const T* {
+		return typed<T>(const_cast<void*>(obj));
+	}
+
 	/**
 	 * @brief Returns the generated attribute objectpr
 	 */
@@ -243,6 +302,12 @@ struct Robber {
 
 template<typename Tag, typename Tag::type Ptr>
 Robber<Tag, Ptr> Robber<Tag, Ptr>::instance;
+
+/// FieldInfo::address thunk shared by every accessor kind
+template<class Class, typename Tag>
+auto memberAddress(void* obj) -> void* {
+	return &(static_cast<Class*>(obj)->*Accessor<Tag>::member);
+}
 }
 
 /**
@@ -260,36 +325,28 @@ template<class Class, typename FieldType, typename Tag>
 struct FieldAccess {
 	static auto get(void* obj) -> std::any { return static_cast<Class*>(obj)->*_detail::template Accessor<Tag>::member; }
 
-	static void set(void* obj, std::any value) {
-		if (auto* typed = std::any_cast<FieldType>(&value)) {
-			static_cast<Class*>(obj)->*_detail::template Accessor<Tag>::member = *typed;
+	static void set(void* obj, const std::any& value) {
+		auto& member = static_cast<Class*>(obj)->*_detail::template Accessor<Tag>::member;
+		if (const auto* typed = std::any_cast<FieldType>(&value)) {
+			member = *typed;
 			return;
 		}
 
-		// HACK: Try integer type conversion if exact match fails
+		// Prefabs and scripts hand integers over as whatever width they parsed; narrow them here
 		if constexpr (std::is_integral_v<FieldType>) {
-			const auto& type_info = value.type();
-			if (type_info == typeid(int)) {
-				static_cast<Class*>(obj)->*_detail::template Accessor<Tag>::member = static_cast<FieldType>(std::any_cast<int>(value));
-			} else if (type_info == typeid(unsigned int)) {
-				static_cast<Class*>(obj)->*_detail::template Accessor<Tag>::member =
-				    static_cast<FieldType>(std::any_cast<unsigned int>(value));
-			} else if (type_info == typeid(long)) {
-				static_cast<Class*>(obj)->*_detail::template Accessor<Tag>::member = static_cast<FieldType>(std::any_cast<long>(value));
-			} else if (type_info == typeid(unsigned long)) {
-				static_cast<Class*>(obj)->*_detail::template Accessor<Tag>::member =
-				    static_cast<FieldType>(std::any_cast<unsigned long>(value));
-			} else if (type_info == typeid(short)) {
-				static_cast<Class*>(obj)->*_detail::template Accessor<Tag>::member = static_cast<FieldType>(std::any_cast<short>(value));
-			} else if (type_info == typeid(unsigned short)) {
-				static_cast<Class*>(obj)->*_detail::template Accessor<Tag>::member =
-				    static_cast<FieldType>(std::any_cast<unsigned short>(value));
-			} else if (type_info == typeid(char)) {
-				static_cast<Class*>(obj)->*_detail::template Accessor<Tag>::member = static_cast<FieldType>(std::any_cast<char>(value));
-			} else if (type_info == typeid(unsigned char)) {
-				static_cast<Class*>(obj)->*_detail::template Accessor<Tag>::member =
-				    static_cast<FieldType>(std::any_cast<unsigned char>(value));
-			}
+			auto assign = [&]<typename Source>() {
+				if (const auto* v = std::any_cast<Source>(&value)) {
+					member = static_cast<FieldType>(*v);
+					return true;
+				}
+				return false;
+			};
+			static_cast<void>(
+			    assign.template operator()<int>() || assign.template operator()<unsigned int>() ||
+			    assign.template operator()<long>() || assign.template operator()<unsigned long>() ||
+			    assign.template operator()<short>() || assign.template operator()<unsigned short>() ||
+			    assign.template operator()<char>() || assign.template operator()<unsigned char>()
+			);
 		}
 	}
 };
@@ -313,7 +370,7 @@ struct EnumFieldAccess {
 		}
 	}
 
-	static void set(void* obj, std::any value) {
+	static void set(void* obj, const std::any& value) {
 		if constexpr (std::is_enum_v<FieldType>) {
 			auto assign = [obj](auto numeric) {
 				using Underlying = std::underlying_type_t<FieldType>;
@@ -343,7 +400,7 @@ struct EnumFieldAccess {
 				assign(*v);
 			}
 		} else {
-			FieldAccess<Class, FieldType, Tag>::set(obj, std::move(value));
+			FieldAccess<Class, FieldType, Tag>::set(obj, value);
 		}
 	}
 };
@@ -361,8 +418,8 @@ struct FieldAccess<Class, Box<T>, Tag> {
 		return std::any {Box<Node>(src)};
 	}
 
-	static void set(void* obj, std::any value) {
-		if (auto* box = std::any_cast<Box<Node>>(&value)) {
+	static void set(void* obj, const std::any& value) {
+		if (const auto* box = std::any_cast<Box<Node>>(&value)) {
 			static_cast<Class*>(obj)->*_detail::template Accessor<Tag>::member = box->as<T>();
 		}
 	}
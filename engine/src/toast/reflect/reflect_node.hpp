@@ -7,6 +7,7 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <toast/reflect/reflect.hpp>
 #include <type_traits>
 #include <unordered_map>
@@ -174,6 +175,47 @@ struct TOAST_API GroupInfo {
 	}
 };
 
+/**
+ * @brief Perfect-hash table over a type's flattened field or method names
+ *
+ * Emitted by the reflection generator next to each NodeInfo. The table folds in every base type
+ * that was generated in the same run, so a lookup is a single hash, slot load and name compare
+ * instead of a linear scan per inheritance level.
+ *
+ * @note hash() must stay in sync with lookup_hash() in tools/reflection_generator/src/lookup.rs
+ */
+template<typename T>
+struct NameLookup {
+	uint32_t seed = 0;
+	std::span<const T* const> slots;    ///< Power-of-two sized; nullptr marks an empty slot
+
+	[[nodiscard]]
+	static constexpr auto hash(std::string_view name, uint32_t seed) -> uint32_t {
+		uint32_t h = 2166136261u ^ seed;
+		for (char c : name) {
+			h ^= static_cast<uint8_t>(c);
+			h *= 16777619u;
+		}
+		// FNV has weak low bits and we mask with the table size
+		h ^= h >> 16;
+		h *= 0x7feb352du;
+		h ^= h >> 15;
+		return h;
+	}
+
+	[[nodiscard]]
+	constexpr auto empty() const -> bool {
+		return slots.empty();
+	}
+
+	/// @return The entry called name, or nullptr if the table doesn't contain it
+	[[nodiscard]]
+	auto find(std::string_view name) const -> const T* {
+		const T* candidate = slots[hash(name, seed) & (slots.size() - 1)];
+		return candidate != nullptr && candidate->name == name ? candidate : nullptr;
+	}
+};
+
 /**
  * @brief Complete reflection record for a registered Node type
  *
@@ -200,13 +242,27 @@ struct TOAST_API NodeInfo {
 	Factory construct = nullptr;
 	Deleter destroy = nullptr;
 
+	NameLookup<FieldInfo> field_lookup;        ///< Flattened fields of this type and its generated bases
+	NameLookup<FunctionInfo> method_lookup;    ///< Flattened methods of this type and its generated bases
+	const NodeInfo* lookup_base = nullptr;     ///< First base type not folded into the lookup tables
+
 	/**
-	 * @brief Finds a field by name in this type's all_fields, then walks base_type if not found
+	 * @brief Finds a field by name in this type or any of its base types
+	 *
+	 * Uses the generated lookup table when present; hand-built NodeInfos without one fall back to
+	 * scanning all_fields and walking base_type
+	 *
 	 * @param field_name The reflected field name to look up
 	 * @return Pointer to the matching FieldInfo, or nullptr if the field is not reflected anywhere in the hierarchy
 	 */
 	[[nodiscard]]
 	auto getField(std::string_view field_name) const -> const FieldInfo* {
+		if (!field_lookup.empty()) {
+			if (const auto* f = field_lookup.find(field_name)) {
+				return f;
+			}
+			return lookup_base ? lookup_base->getField(field_name) : nullptr;
+		}
 		for (const auto& f : all_fields) {
 			if (field_name == f.name) {
 				return &f;
@@ -219,12 +275,18 @@ struct TOAST_API NodeInfo {
 	}
 
 	/**
-	 * @brief Finds a reflected function by name in this type, then walks base_type if not found
+	 * @brief Finds a reflected function by name in this type or any of its base types, same lookup rules as getField()
 	 * @param method_name The reflected function name to look up
 	 * @return Pointer to the matching FunctionInfo, or nullptr if the function is not reflected anywhere in the hierarchy
 	 */
 	[[nodiscard]]
 	auto getMethod(std::string_view method_name) const -> const FunctionInfo* {
+		if (!method_lookup.empty()) {
+			if (const auto* m = method_lookup.find(method_name)) {
+				return m;
+			}
+			return lookup_base ? lookup_base->getMethod(method_name) : nullptr;
+		}
 		for (const auto& m : methods) {
 			if (method_name == m.name) {
 				return &m;
@@ -350,15 +412,7 @@ struct TOAST_API NodeInfo {
 	 */
 	[[nodiscard]]
 	auto search(std::string_view field_name) const -> const FieldInfo* {
-		for (const auto& f : all_fields) {
-			if (field_name == f.name) {
-				return &f;
-			}
-		}
-		if (base_type) {
-			return base_type->search(field_name);
-		}
-		return nullptr;
+		return getField(field_name);
 	}
 
 	/**
@@ -421,7 +475,16 @@ public:
 	NodeRegistry() { instance = this; }
 
 	/// Called by the generated registration function; inserts a type into the registry
-	static void registerNode(const NodeInfo* info) { (*instance).types[info->type] = info; }
+	static void registerNode(const NodeInfo* info) {
+		(*instance).types[info->type] = info;
+		(*instance).generation_counter.fetch_add(1, std::memory_order_release);
+	}
+
+	/// Bumped on every registration; caches built from NodeInfo pointers compare it to detect a type reload
+	[[nodiscard]]
+	static auto generation() noexcept -> uint32_t {
+		return instance ? instance->generation_counter.load(std::memory_order_acquire) : 0;
+	}
 
 	/**
 	 * @brief Looks up a Node type by its fully-qualified C++ name
@@ -434,9 +497,9 @@ public:
 		if (name.starts_with("::")) {
 			name.remove_prefix(2);
 		}
-		auto types = (*instance).types;
-		auto it = (*instance).types.find(name);
-		return it != (*instance).types.end() ? it->second : nullptr;
+		const auto& types = instance->types;
+		auto it = types.find(name);
+		return it != types.end() ? it->second : nullptr;
 	}
 
 	/// Calls fn(info) for every registered node type
@@ -451,6 +514,7 @@ public:
 
 private:
 	std::unordered_map<std::string_view, const NodeInfo*> types;
+	std::atomic<uint32_t> generation_counter = 0;
 	static inline NodeRegistry* instance = nullptr;
 };
 
@@ -0,0 +1,129 @@
+#include "headless_renderer.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <toast/assets/material.hpp>
+#include <toast/assets/mesh.hpp>
+#include <toast/log.hpp>
+#include <toast/time.hpp>
+#include <toast/world/camera.hpp>
+#include <toast/world/mesh_node.hpp>
+#include <tracy/Tracy.hpp>
+#include <tuple>
+
+namespace renderer {
+
+namespace {
+
+using FrustumPlanes = std::array<glm::vec4, 6>;
+
+// Gribb/Hartmann: the planes fall out of the rows of the view-projection matrix
+auto extractFrustum(const glm::mat4& view_projection) -> FrustumPlanes {
+	const glm::vec4 row0 {view_projection[0][0], view_projection[1][0], view_projection[2][0], view_projection[3][0]};
+	const glm::vec4 row1 {view_projection[0][1], view_projection[1][1], view_projection[2][1], view_projection[3][1]};
+	const glm::vec4 row2 {view_projection[0][2], view_projection[1][2], view_projection[2][2], view_projection[3][2]};
+	const glm::vec4 row3 {view_projection[0][3], view_projection[1][3], view_projection[2][3], view_projection[3][3]};
+
+	// The near plane assumes a -1..1 depth range, which is looser than 0..1 and so never culls a visible mesh
+	FrustumPlanes planes {row3 + row0, row3 - row0, row3 + row1, row3 - row1, row3 + row2, row3 - row2};
+	for (auto& plane : planes) {
+		plane /= glm::length(glm::vec3(plane));
+	}
+	return planes;
+}
+
+auto sphereVisible(const FrustumPlanes& planes, const glm::vec3& centre, float radius) -> bool {
+	return std::ranges::all_of(planes, [&](const glm::vec4& plane) {
+		return glm::dot(glm::vec3(plane), centre) + plane.w >= -radius;
+	});
+}
+
+}
+
+HeadlessRenderer* HeadlessRenderer::instance = nullptr;
+
+HeadlessRenderer::HeadlessRenderer() {
+	TOAST_ASSERT(instance == nullptr, "Render", "A HeadlessRenderer already exists");
+	instance = this;
+}
+
+HeadlessRenderer::~HeadlessRenderer() {
+	instance = nullptr;
+}
+
+void HeadlessRenderer::tick(float /*time*/) noexcept {
+	ZoneScopedN("HeadlessRenderer::tick()");
+
+	m_draws.clear();
+	m_stats = {};
+	if (m_camera == nullptr) {
+		return;
+	}
+
+	{
+		std::scoped_lock lock(m_mesh_proxy_mutex);
+		m_snapshot = m_mesh_proxy_nodes;
+	}
+
+	// Same interpolation as the GPU path so culling sees what would be drawn
+	const float alpha = static_cast<float>(Time::alpha());
+	const glm::mat4 view = m_camera->getView(alpha);
+	const FrustumPlanes planes = extractFrustum(m_camera->getProjection(m_aspect) * view);
+
+	for (auto* node : m_snapshot) {
+		if (node == nullptr || !node->enabled() || !node->getMesh().hasValue()) {
+			continue;
+		}
+		++m_stats.proxies;
+
+		const assets::Mesh& mesh = node->getMesh().get();
+		const glm::mat4 model = node->worldTransformForRender(alpha);
+		const glm::vec4& bounds = mesh.bounds();
+		const glm::vec3 centre = glm::vec3(model * glm::vec4(glm::vec3(bounds), 1.0f));
+		const float scale = std::max({glm::length(glm::vec3(model[0])), glm::length(glm::vec3(model[1])), glm::length(glm::vec3(model[2]))});
+
+		if (!sphereVisible(planes, centre, bounds.w * scale)) {
+			++m_stats.culled;
+			continue;
+		}
+
+		const auto& material = node->getMaterial();
+		m_draws.push_back({
+		    .mesh = &mesh,
+		    .material = material.hasValue() ? &material.get() : nullptr,
+		    .model = model,
+		    .depth = -(view * glm::vec4(centre, 1.0f)).z,
+		});
+	}
+	m_stats.visible = static_cast<uint32_t>(m_draws.size());
+
+	// Group by material to minimise pipeline switches, front to back inside a group for early-z
+	std::ranges::sort(m_draws, [](const DrawItem& a, const DrawItem& b) {
+		return std::tie(a.material, a.depth) < std::tie(b.material, b.depth);
+	});
+
+	TracyPlot("Headless visible meshes", static_cast<int64_t>(m_stats.visible));
+}
+
+void HeadlessRenderer::registerMeshNodeProxy(toast::MeshNode* node) {
+	if (node == nullptr) {
+		return;
+	}
+
+	std::scoped_lock lock(m_mesh_proxy_mutex);
+	if (!std::ranges::contains(m_mesh_proxy_nodes, node)) {
+		m_mesh_proxy_nodes.push_back(node);
+	}
+}
+
+void HeadlessRenderer::unregisterMeshNodeProxy(toast::MeshNode* node) {
+	if (node == nullptr) {
+		return;
+	}
+
+	std::scoped_lock lock(m_mesh_proxy_mutex);
+	std::erase(m_mesh_proxy_nodes, node);
+}
+
+}
@@ -0,0 +1,101 @@
+/**
+ * @file headless_renderer.hpp
+ * @author Xein
+ * @date 18 Oct 2026
+ *
+ * @brief CPU-only stand-in for VulkanRenderer used by headless runs
+ */
+
+#pragma once
+#include <cstdint>
+#include <glm/glm.hpp>
+#include <mutex>
+#include <toast/export.hpp>
+#include <vector>
+
+namespace assets {
+class Mesh;
+class Material;
+}
+
+namespace toast {
+class Camera;
+class MeshNode;
+}
+
+namespace renderer {
+
+/**
+ * @brief Builds the same draw list as VulkanRenderer::tick() without a GPU
+ *
+ * Gathers the registered mesh proxies, frustum culls their bounding spheres against the active camera
+ * and sorts the survivors by material, then front to back. Nothing is drawn, so CI and soak runs keep
+ * the CPU cost of a real frame with no window or device
+ */
+class TOAST_API HeadlessRenderer {
+public:
+	struct DrawItem {
+		const assets::Mesh* mesh = nullptr;
+		const assets::Material* material = nullptr;    ///< null when the node has no material
+		glm::mat4 model {1.0f};
+		float depth = 0.0f;    ///< view-space distance along the camera forward
+	};
+
+	struct Stats {
+		uint32_t proxies = 0;    ///< enabled mesh nodes with a mesh
+		uint32_t visible = 0;
+		uint32_t culled = 0;
+	};
+
+	HeadlessRenderer();
+	~HeadlessRenderer();
+
+	HeadlessRenderer(const HeadlessRenderer&) = delete;
+	auto operator=(const HeadlessRenderer&) -> HeadlessRenderer& = delete;
+
+	static HeadlessRenderer* instance;
+
+	/// @brief Culls and sorts this frame's draw list; @p time is unused and kept for parity with VulkanRenderer
+	void tick(float time) noexcept;
+
+	void registerMeshNodeProxy(toast::MeshNode* node);
+	void unregisterMeshNodeProxy(toast::MeshNode* node);
+
+	void setActiveCamera(toast::Camera* camera) noexcept {
+		m_camera = camera;
+	}
+
+	[[nodiscard]]
+	auto getActiveCamera() const noexcept -> toast::Camera* {
+		return m_camera;
+	}
+
+	/// Aspect ratio the projection is built with, 1080x720 unless changed
+	void setAspect(float aspect) noexcept {
+		m_aspect = aspect;
+	}
+
+	/// The sorted draw list of the last tick()
+	[[nodiscard]]
+	auto draws() const noexcept -> const std::vector<DrawItem>& {
+		return m_draws;
+	}
+
+	[[nodiscard]]
+	auto stats() const noexcept -> const Stats& {
+		return m_stats;
+	}
+
+private:
+	std::mutex m_mesh_proxy_mutex;
+	std::vector<toast::MeshNode*> m_mesh_proxy_nodes;
+	std::vector<toast::MeshNode*> m_snapshot;    ///< reused every tick so a frame doesn't allocate
+
+	toast::Camera* m_camera = nullptr;
+	float m_aspect = 1080.0f / 720.0f;
+
+	std::vector<DrawItem> m_draws;
+	Stats m_stats;
+};
+
+}
@@ -9,6 +9,7 @@
 #include <limits>
 #include <toast/log.hpp>
 #include <toast/logger.hpp>
+#include <toast/memory_tracker.hpp>
 
 #if defined(__linux__)
 #include <dlfcn.h>
@@ -23,15 +24,19 @@ namespace {
 constexpr std::size_t k_gigabyte_bytes = 1024ull * 1024ull * 1024ull;
 constexpr uint32_t k_invalid_queue_family = std::numeric_limits<uint32_t>::max();
 
+void trackVmaAllocate(VmaAllocator, uint32_t, VkDeviceMemory memory, VkDeviceSize size, void*) {
+	toast::MemoryTracker::allocated(toast::MemoryTag::renderer, size);
 #ifdef TRACY_ENABLE
-void tracyVmaAllocate(VmaAllocator, uint32_t, VkDeviceMemory memory, VkDeviceSize size, void*) {
 	TracyAllocN(reinterpret_cast<void*>(memory), size, "VRAM");
+#endif
 }
 
-void tracyVmaFree(VmaAllocator, uint32_t, VkDeviceMemory memory, VkDeviceSize, void*) {
+void trackVmaFree(VmaAllocator, uint32_t, VkDeviceMemory memory, VkDeviceSize size, void*) {
+	toast::MemoryTracker::freed(toast::MemoryTag::renderer, size);
+#ifdef TRACY_ENABLE
 	TracyFreeN(reinterpret_cast<void*>(memory), "VRAM");
-}
 #endif
+}
 
 struct QueueFamilySelection {
 	uint32_t graphics = k_invalid_queue_family;
@@ -513,10 +518,8 @@ void VulkanCore::createLogicalDeviceAndAllocator(std::span<const char* const> re
 	allocator_ci.vulkanApiVersion = VK_API_VERSION_1_4;
 	allocator_ci.physicalDevice = *m_physical_device;
 
-#ifdef TRACY_ENABLE
-	static constexpr vma::DeviceMemoryCallbacks tracy_memory_callbacks {&tracyVmaAllocate, &tracyVmaFree, nullptr};
-	allocator_ci.pDeviceMemoryCallbacks = &tracy_memory_callbacks;
-#endif
+	static constexpr vma::DeviceMemoryCallbacks memory_callbacks {&trackVmaAllocate, &trackVmaFree, nullptr};
+	allocator_ci.pDeviceMemoryCallbacks = &memory_callbacks;
 
 	m_allocator.emplace(m_instance, m_device, allocator_ci);
 }
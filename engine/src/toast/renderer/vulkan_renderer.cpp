@@ -900,6 +900,9 @@ void VulkanRenderer::tick(float time) noexcept {
 	}
 	frame.mesh_instances.reserve(mesh_nodes_snapshot.size());
 
+	// Simulation runs at a fixed rate; draw where it would be between the last two steps
+	const float alpha = static_cast<float>(Time::alpha());
+
 	for (auto* node : mesh_nodes_snapshot) {
 		if (node == nullptr || !node->enabled()) {
 			continue;
@@ -934,7 +937,7 @@ void VulkanRenderer::tick(float time) noexcept {
 			continue;
 		}
 
-		const auto world_transform = node->worldTransformForRender();
+		const auto world_transform = node->worldTransformForRender(alpha);
 
 		frame.mesh_instances.push_back(
 		    MeshInstanceProxy {
@@ -954,14 +957,14 @@ void VulkanRenderer::tick(float time) noexcept {
 	    extent.height > 0 ? static_cast<float>(extent.width) / static_cast<float>(extent.height) : (1080.0f / 720.0f);
 
 	frame.frame_data = FrameUBO {
-	  .view = m_camera->getView(),
+	  .view = m_camera->getView(alpha),
 	  .projection = m_camera->getProjection(aspect),
-	  .view_projection = m_camera->getProjection(aspect) * m_camera->getView(),
+	  .view_projection = m_camera->getProjection(aspect) * m_camera->getView(alpha),
 	  .camera_position = m_camera->world_position,
 	  .time = time
 	};
 
-	// UI contexts update and record their draw data on the main thread
+	// UI contexts record their draw data on whichever thread builds the frame (the engine's Render build stage)
 	if (m_ui_frame_builder) {
 		m_ui_frame_builder(frame);
 	}
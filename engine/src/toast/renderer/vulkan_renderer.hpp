@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "headless_renderer.hpp"
 #include "output_target_base.hpp"
 #include "render_pass_base.hpp"
 #include "vulkan_core.hpp"
@@ -151,7 +152,8 @@ public:
 	/**
 	 * @brief Builds the next RenderFrame from the active camera and registered mesh proxies, then submits it
 	 *
-	 * Called once per simulation tick; does nothing if there's no free render slot available
+	 * Called once per frame after the fixed steps; meshes are drawn at Time::alpha() between the last two
+	 * steps. Does nothing if there's no free render slot available
 	 *
 	 * @param time Elapsed time in seconds, forwarded into the frame's FrameUBO
 	 */
@@ -385,23 +387,40 @@ inline void submitFrame() {
 	VulkanRenderer::instance->submitFrame();
 }
 
+// Scene-facing calls fall back to the HeadlessRenderer when there is no GPU renderer
+
 inline auto getActiveCamera() -> toast::Camera* {
+	if (HeadlessRenderer::instance) {
+		return HeadlessRenderer::instance->getActiveCamera();
+	}
 	return VulkanRenderer::instance->getActiveCamera();
 }
 
-inline void setActiveCamera(toast::Camera& camera) {
-	VulkanRenderer::instance->setActiveCamera(&camera);
-}
-
 inline void setActiveCamera(toast::Camera* camera) {
+	if (HeadlessRenderer::instance) {
+		HeadlessRenderer::instance->setActiveCamera(camera);
+		return;
+	}
 	VulkanRenderer::instance->setActiveCamera(camera);
 }
 
+inline void setActiveCamera(toast::Camera& camera) {
+	setActiveCamera(&camera);
+}
+
 inline void registerMeshNodeProxy(toast::MeshNode* node) {
+	if (HeadlessRenderer::instance) {
+		HeadlessRenderer::instance->registerMeshNodeProxy(node);
+		return;
+	}
 	VulkanRenderer::instance->registerMeshNodeProxy(node);
 }
 
 inline void unregisterMeshNodeProxy(toast::MeshNode* node) {
+	if (HeadlessRenderer::instance) {
+		HeadlessRenderer::instance->unregisterMeshNodeProxy(node);
+		return;
+	}
 	VulkanRenderer::instance->unregisterMeshNodeProxy(node);
 }
 
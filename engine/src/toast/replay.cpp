@@ -0,0 +1,336 @@
+#include "replay.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <toast/log.hpp>
+
+namespace toast {
+
+namespace {
+
+Replay* active_replay = nullptr;
+
+constexpr std::array<char, 4> replay_magic = {'T', 'R', 'P', 'L'};
+constexpr uint16_t replay_version = 1;
+
+auto sameSample(const input::InputSample& a, const input::InputSample& b) -> bool {
+	return a.scalar == b.scalar and a.vector == b.vector and a.is_vector == b.is_vector and a.present == b.present;
+}
+
+}
+
+Replay::Replay(Mode mode, const std::filesystem::path& path, uint16_t checkpoint_interval)
+    : m_mode(mode),
+      m_checkpoint_interval(std::max<uint16_t>(checkpoint_interval, 1)) {
+	TOAST_ASSERT(active_replay == nullptr, "Replay", "A replay is already recording or playing");
+	active_replay = this;
+
+	if (m_mode == Mode::record) {
+		m_out.open(path, std::ios::binary | std::ios::trunc);
+		m_out.write(replay_magic.data(), replay_magic.size());
+		m_out.write(reinterpret_cast<const char*>(&replay_version), sizeof(replay_version));
+		m_out.write(reinterpret_cast<const char*>(&m_checkpoint_interval), sizeof(m_checkpoint_interval));
+		m_valid = m_out.good();
+	} else {
+		m_in.open(path, std::ios::binary);
+		std::array<char, 4> magic {};
+		uint16_t version = 0;
+		m_in.read(magic.data(), magic.size());
+		m_in.read(reinterpret_cast<char*>(&version), sizeof(version));
+		m_in.read(reinterpret_cast<char*>(&m_checkpoint_interval), sizeof(m_checkpoint_interval));
+		m_valid = m_in.good() and magic == replay_magic and version == replay_version and m_checkpoint_interval > 0;
+	}
+
+	if (!m_valid) {
+		TOAST_ERROR("Replay", "Cannot {} replay {}", m_mode == Mode::record ? "write" : "read", path.string());
+		return;
+	}
+	TOAST_INFO("Replay", "{} {}", m_mode == Mode::record ? "Recording to" : "Playing back", path.string());
+}
+
+Replay::~Replay() {
+	if (recording() and m_frame > 0) {
+		flushFrame();
+		TOAST_INFO("Replay", "Recorded {} frames", m_frame);
+	}
+	active_replay = nullptr;
+}
+
+auto Replay::get() noexcept -> Replay* {
+	return active_replay;
+}
+
+template<typename T>
+void Replay::put(const T& value) {
+	const auto* bytes = reinterpret_cast<const uint8_t*>(&value);
+	m_body.insert(m_body.end(), bytes, bytes + sizeof(T));
+}
+
+template<typename T>
+auto Replay::take(T& value) -> bool {
+	if (m_cursor + sizeof(T) > m_body.size()) {
+		return false;
+	}
+	std::memcpy(&value, m_body.data() + m_cursor, sizeof(T));
+	m_cursor += sizeof(T);
+	return true;
+}
+
+auto Replay::beginFrame(double raw_delta) -> double {
+	if (recording()) {
+		if (m_frame > 0) {
+			flushFrame();
+		}
+		m_delta = raw_delta;
+		++m_frame;
+		return raw_delta;
+	}
+
+	if (!playing()) {
+		return raw_delta;
+	}
+
+	// Extra samples diverge as they're taken, missing ones only show once the frame is over
+	if (m_frame > 0 and m_sample_cursor < m_samples.size()) {
+		diverge("fewer input samples than recorded");
+	}
+
+	if (!readFrame()) {
+		m_finished = true;
+		m_context.reset();
+		m_loads.clear();
+		m_spawns.clear();
+		m_destroys.clear();
+		m_checkpoint.reset();
+		TOAST_INFO("Replay", "Playback finished after {} frames{}", m_frame, m_diverged ? ", diverged" : "");
+		return raw_delta;
+	}
+	++m_frame;
+	return m_delta;
+}
+
+void Replay::flushFrame() {
+	// Only the samples that changed since the previous frame
+	std::vector<uint16_t> changed;
+	for (size_t i = 0; i < m_samples.size(); ++i) {
+		if (i >= m_previous_samples.size() or !sameSample(m_samples[i], m_previous_samples[i])) {
+			changed.push_back(static_cast<uint16_t>(i));
+		}
+	}
+	if (!changed.empty() or m_samples.size() != m_previous_samples.size()) {
+		put(Tag::input_samples);
+		put(static_cast<uint16_t>(m_samples.size()));
+		put(static_cast<uint16_t>(changed.size()));
+		for (const uint16_t index : changed) {
+			const auto& sample = m_samples[index];
+			put(index);
+			put(static_cast<uint8_t>((sample.present ? 1 : 0) | (sample.is_vector ? 2 : 0)));
+			put(sample.scalar);
+			put(sample.vector.x);
+			put(sample.vector.y);
+		}
+	}
+	m_previous_samples = std::move(m_samples);
+	m_samples.clear();
+
+	const auto size = static_cast<uint32_t>(m_body.size());
+	m_out.write(reinterpret_cast<const char*>(&size), sizeof(size));
+	m_out.write(reinterpret_cast<const char*>(&m_delta), sizeof(m_delta));
+	m_out.write(reinterpret_cast<const char*>(m_body.data()), static_cast<std::streamsize>(m_body.size()));
+	m_body.clear();
+}
+
+auto Replay::readFrame() -> bool {
+	uint32_t size = 0;
+	m_in.read(reinterpret_cast<char*>(&size), sizeof(size));
+	m_in.read(reinterpret_cast<char*>(&m_delta), sizeof(m_delta));
+	m_body.resize(size);
+	m_in.read(reinterpret_cast<char*>(m_body.data()), size);
+	if (!m_in) {
+		return false;
+	}
+
+	m_cursor = 0;
+	m_context.reset();
+	m_loads.clear();
+	m_spawns.clear();
+	m_destroys.clear();
+	m_checkpoint.reset();
+	m_sample_cursor = 0;
+
+	Tag tag {};
+	while (take(tag)) {
+		uint32_t count = 0;
+		switch (tag) {
+			case Tag::input_context: {
+				input::EvalContext context;
+				take(context.delta);
+				take(context.mods);
+				take(context.viewport_pos);
+				take(context.viewport_size);
+				m_context = context;
+				break;
+			}
+			case Tag::input_samples: {
+				uint16_t total = 0;
+				uint16_t changed = 0;
+				take(total);
+				take(changed);
+				m_samples.resize(total);
+				for (uint16_t i = 0; i < changed; ++i) {
+					uint16_t index = 0;
+					uint8_t flags = 0;
+					input::InputSample sample;
+					take(index);
+					take(flags);
+					take(sample.scalar);
+					take(sample.vector.x);
+					take(sample.vector.y);
+					sample.present = (flags & 1) != 0;
+					sample.is_vector = (flags & 2) != 0;
+					if (index < total) {
+						m_samples[index] = sample;
+					}
+				}
+				break;
+			}
+			case Tag::loads:
+			case Tag::destroys: {
+				take(count);
+				auto& uids = tag == Tag::loads ? m_loads : m_destroys;
+				for (uint32_t i = 0; i < count; ++i) {
+					uint64_t uid = 0;
+					take(uid);
+					uids.emplace_back(uid);
+				}
+				break;
+			}
+			case Tag::spawns: {
+				take(count);
+				for (uint32_t i = 0; i < count; ++i) {
+					uint64_t parent = 0;
+					uint64_t name_hash = 0;
+					uint64_t uid = 0;
+					take(parent);
+					take(name_hash);
+					take(uid);
+					m_spawns.push_back({UID(parent), name_hash, UID(uid)});
+				}
+				break;
+			}
+			case Tag::checkpoint: {
+				uint64_t hash = 0;
+				take(hash);
+				m_checkpoint = hash;
+				break;
+			}
+			default:
+				TOAST_ERROR("Replay", "Unknown record {} in frame {}; the rest of the replay is skipped", static_cast<int>(tag), m_frame + 1);
+				return false;
+		}
+	}
+	return true;
+}
+
+auto Replay::inputContext(const input::EvalContext& live) -> input::EvalContext {
+	if (recording()) {
+		put(Tag::input_context);
+		put(live.delta);
+		put(live.mods);
+		put(live.viewport_pos);
+		put(live.viewport_size);
+		return live;
+	}
+	return playing() and m_context ? *m_context : live;
+}
+
+auto Replay::inputSample(const input::InputSample& live) -> input::InputSample {
+	if (recording()) {
+		m_samples.push_back(live);
+		return live;
+	}
+	if (!playing()) {
+		return live;
+	}
+	if (m_sample_cursor >= m_samples.size()) {
+		diverge("more input samples than recorded");
+		return live;
+	}
+	return m_samples[m_sample_cursor++];
+}
+
+void Replay::loaded(std::span<const UID> order) {
+	if (!recording() or order.empty()) {
+		return;
+	}
+	put(Tag::loads);
+	put(static_cast<uint32_t>(order.size()));
+	for (const UID& uid : order) {
+		put(uid.data());
+	}
+}
+
+auto Replay::expectedLoads() const -> const std::vector<UID>& {
+	return m_loads;
+}
+
+void Replay::spawned(std::span<const SpawnRecord> order) {
+	if (!recording() or order.empty()) {
+		return;
+	}
+	put(Tag::spawns);
+	put(static_cast<uint32_t>(order.size()));
+	for (const SpawnRecord& spawn : order) {
+		put(spawn.parent.data());
+		put(spawn.name_hash);
+		put(spawn.uid.data());
+	}
+}
+
+auto Replay::expectedSpawns() const -> const std::vector<SpawnRecord>& {
+	return m_spawns;
+}
+
+void Replay::destroyed(std::span<const UID> uids) {
+	if (recording() and !uids.empty()) {
+		put(Tag::destroys);
+		put(static_cast<uint32_t>(uids.size()));
+		for (const UID& uid : uids) {
+			put(uid.data());
+		}
+	} else if (playing()) {
+		const bool same = std::ranges::equal(uids, m_destroys, [](const UID& a, const UID& b) { return a.data() == b.data(); });
+		if (!same) {
+			diverge("destroyed nodes differ from the recording");
+		}
+	}
+}
+
+void Replay::checkpoint(uint64_t world_hash) {
+	if (recording()) {
+		put(Tag::checkpoint);
+		put(world_hash);
+	} else if (playing() and m_checkpoint and *m_checkpoint != world_hash) {
+		diverge("world hash differs from the recording");
+	}
+}
+
+void Replay::diverge(std::string_view what) {
+	if (m_diverged) {
+		return;
+	}
+	m_diverged = true;
+	TOAST_WARN("Replay", "Replay diverged at frame {}: {}", m_frame, what);
+}
+
+auto Replay::nameHash(std::string_view name) noexcept -> uint64_t {
+	uint64_t hash = 14695981039346656037ull;
+	for (const char c : name) {
+		hash ^= static_cast<uint8_t>(c);
+		hash *= 1099511628211ull;
+	}
+	return hash;
+}
+
+}
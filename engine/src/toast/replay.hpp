@@ -0,0 +1,191 @@
+/**
+ * @file replay.hpp
+ * @author Xein
+ * @date 18 Oct 2026
+ *
+ * @brief Records a run's nondeterministic inputs to a binary stream and feeds them back frame by frame
+ */
+
+#pragma once
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <toast/export.hpp>
+#include <toast/input/value.hpp>
+#include <toast/uid.hpp>
+#include <vector>
+
+namespace toast {
+
+/**
+ * @brief Deterministic record and replay of everything that makes two runs of a scene differ
+ *
+ * Captured per frame: the raw frame delta Time sees, the input context and every input sample the
+ * actions evaluate, the order async loads and spawns are drained in (and the UIDs spawns get), and
+ * the nodes destroyed. Playback returns the recorded values from the same hooks and holds async
+ * results back until the frame they were drained on, so the simulation takes the same path.
+ *
+ * Every checkpointInterval() frames the World hash goes in the stream; playback compares it and
+ * logs the first frame that diverges, which narrows a bisect down to a handful of frames
+ *
+ * File layout: "TRPL" magic, u16 version, u16 checkpoint interval, then one block per frame of
+ * u32 body size, f64 raw delta and the body's tagged records
+ */
+class TOAST_API Replay {
+public:
+	enum class Mode : uint8_t {
+		record,
+		play,
+	};
+
+	struct SpawnRecord {
+		UID parent;
+		uint64_t name_hash = 0;    ///< of the spawned root's name, to tell spawns under one parent apart
+		UID uid;                   ///< the UID the spawned root ended up with
+	};
+
+	Replay(Mode mode, const std::filesystem::path& path, uint16_t checkpoint_interval = 30);
+	~Replay();
+
+	Replay(const Replay&) = delete;
+	auto operator=(const Replay&) -> Replay& = delete;
+
+	/// @returns The replay being recorded or played, or null
+	[[nodiscard]]
+	static auto get() noexcept -> Replay*;
+
+	[[nodiscard]]
+	auto mode() const noexcept -> Mode {
+		return m_mode;
+	}
+
+	/// False if the file couldn't be opened or isn't a replay
+	[[nodiscard]]
+	auto valid() const noexcept -> bool {
+		return m_valid;
+	}
+
+	[[nodiscard]]
+	auto recording() const noexcept -> bool {
+		return m_valid and m_mode == Mode::record;
+	}
+
+	/// True while there are recorded frames left to play
+	[[nodiscard]]
+	auto playing() const noexcept -> bool {
+		return m_valid and m_mode == Mode::play and not m_finished;
+	}
+
+	[[nodiscard]]
+	auto finished() const noexcept -> bool {
+		return m_finished;
+	}
+
+	/// True once a checkpoint or a drained load/spawn/destroy didn't match the recording
+	[[nodiscard]]
+	auto diverged() const noexcept -> bool {
+		return m_diverged;
+	}
+
+	/// Frames begun so far
+	[[nodiscard]]
+	auto frame() const noexcept -> uint64_t {
+		return m_frame;
+	}
+
+	[[nodiscard]]
+	auto checkpointInterval() const noexcept -> uint16_t {
+		return m_checkpoint_interval;
+	}
+
+	/// True on frames that carry a world hash
+	[[nodiscard]]
+	auto checkpointDue() const noexcept -> bool {
+		return m_frame % m_checkpoint_interval == 0;
+	}
+
+	// Hooks; each passes the live value through when recording and returns the recorded one when playing
+
+	/// @brief Starts the next frame; called by Time::tick() with the unscaled wall-clock delta
+	auto beginFrame(double raw_delta) -> double;
+
+	auto inputContext(const input::EvalContext& live) -> input::EvalContext;
+
+	/**
+	 * @brief One sampled key; actions sample in a fixed order, so the n-th call of a frame is the n-th sample
+	 *
+	 * Playing back, taking more samples than the frame recorded diverges at once and taking fewer
+	 * diverges when the next frame begins
+	 */
+	auto inputSample(const input::InputSample& live) -> input::InputSample;
+
+	void loaded(std::span<const UID> order);
+	/// Loaded prefab roots to drain this frame, in order
+	[[nodiscard]]
+	auto expectedLoads() const -> const std::vector<UID>&;
+
+	void spawned(std::span<const SpawnRecord> order);
+	[[nodiscard]]
+	auto expectedSpawns() const -> const std::vector<SpawnRecord>&;
+
+	/// @brief Roots drained from the destroy queue, every frame even when empty; compared with the recording when playing
+	void destroyed(std::span<const UID> uids);
+
+	/// @brief Writes @p world_hash, or compares it with the recorded one
+	void checkpoint(uint64_t world_hash);
+
+	/// @brief Marks the replay as diverged and logs @p what once
+	void diverge(std::string_view what);
+
+	[[nodiscard]]
+	static auto nameHash(std::string_view name) noexcept -> uint64_t;
+
+private:
+	enum class Tag : uint8_t {
+		input_context = 1,
+		input_samples,
+		loads,
+		spawns,
+		destroys,
+		checkpoint,
+	};
+
+	void flushFrame();
+	auto readFrame() -> bool;
+
+	template<typename T>
+	void put(const T& value);
+	template<typename T>
+	auto take(T& value) -> bool;
+
+	Mode m_mode;
+	bool m_valid = false;
+	bool m_finished = false;
+	bool m_diverged = false;
+	uint16_t m_checkpoint_interval;
+	uint64_t m_frame = 0;
+
+	std::ofstream m_out;
+	std::ifstream m_in;
+
+	std::vector<uint8_t> m_body;    ///< records of the frame being written or read
+	size_t m_cursor = 0;            ///< read position in m_body
+	double m_delta = 0.0;           ///< raw delta of the frame being written
+
+	// Input samples are stored as changes from the previous frame
+	std::vector<input::InputSample> m_samples;
+	std::vector<input::InputSample> m_previous_samples;
+	size_t m_sample_cursor = 0;
+
+	// Playback: the current frame's records, split by kind
+	std::optional<input::EvalContext> m_context;
+	std::vector<UID> m_loads;
+	std::vector<SpawnRecord> m_spawns;
+	std::vector<UID> m_destroys;
+	std::optional<uint64_t> m_checkpoint;
+};
+
+}
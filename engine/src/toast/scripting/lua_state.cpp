@@ -10,6 +10,7 @@
 #include <chrono>
 #include <cmath>
 #include <cstdint>
+#include <cstdlib>
 #include <format>
 #include <glm/common.hpp>
 #include <glm/geometric.hpp>
@@ -22,6 +23,7 @@
 #include <toast/assets/asset_registry.hpp>
 #include <toast/assets/assets.hpp>
 #include <toast/log.hpp>
+#include <toast/memory_tracker.hpp>
 #include <toast/reflect/reflect_node.hpp>
 #include <toast/time.hpp>
 #include <toast/ui/ui_system.hpp>
@@ -38,6 +40,27 @@ auto stripNamespace(std::string_view qualified) noexcept -> std::string_view {
 	return pos != std::string_view::npos ? qualified.substr(pos + 2) : qualified;
 }
 
+// Same contract as the stock allocator; osize is the block's old size, or a type tag when ptr is null
+auto luaTrackedAlloc(void*, void* ptr, size_t osize, size_t nsize) -> void* {
+	const size_t old_bytes = ptr ? osize : 0;
+	if (nsize == 0) {
+		if (ptr) {
+			toast::MemoryTracker::freed(toast::MemoryTag::lua, old_bytes);
+		}
+		std::free(ptr);    // NOLINT(cppcoreguidelines-no-malloc)
+		return nullptr;
+	}
+
+	void* block = std::realloc(ptr, nsize);    // NOLINT(cppcoreguidelines-no-malloc)
+	if (block) {
+		if (ptr) {
+			toast::MemoryTracker::freed(toast::MemoryTag::lua, old_bytes);
+		}
+		toast::MemoryTracker::allocated(toast::MemoryTag::lua, nsize);
+	}
+	return block;
+}
+
 auto luaPrint(lua_State* state) -> int {
 	int nargs = lua_gettop(state);
 	std::string output;
@@ -232,7 +255,7 @@ LuaState::LuaState() {
 	LuaState::instance = this;
 
 	for (Entry& entry : m_entries) {
-		entry.state = luaL_newstate();
+		entry.state = lua_newstate(luaTrackedAlloc, nullptr);
 		TOAST_ASSERT(entry.state != nullptr, "Lua", "Failed to create Lua state");
 		luaL_openlibs(entry.state);
 
@@ -550,6 +573,12 @@ void LuaState::registerApi(lua_State* state) noexcept {
 	    .addFunction(
 	        "frame", +[]() -> uint64_t { return Time::frame(); }
 	    )
+	    .addFunction(
+	        "step", +[]() -> uint64_t { return Time::step(); }
+	    )
+	    .addFunction(
+	        "fixedDelta", +[]() -> double { return Time::fixedDelta(); }
+	    )
 	    .addFunction(
 	        "uptime", +[]() -> double { return Time::uptime(); }
 	    )
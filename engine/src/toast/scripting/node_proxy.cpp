@@ -13,6 +13,7 @@
 #include <glm/vec4.hpp>
 #include <lua.hpp>
 #include <luabridge3/LuaBridge/LuaBridge.h>
+#include <optional>
 #include <toast/log.hpp>
 #include <toast/reflect/reflect.hpp>
 #include <toast/reflect/reflect_node.hpp>
@@ -493,6 +494,26 @@ auto luaTableToAny(lua_State* l, const luabridge::LuaRef& table, const toast::Fi
 	return v;
 }
 
+// Reads plain scalar fields straight from the member, skipping the std::any round trip
+auto typedToLuaRef(lua_State* l, toast::Node* node, const toast::FieldInfo& field) -> std::optional<luabridge::LuaRef> {
+	if (field.is_array) {
+		return std::nullopt;
+	}
+	if (const auto* v = field.typed<float>(node)) {
+		return luabridge::LuaRef {l, static_cast<lua_Number>(*v)};
+	}
+	if (const auto* v = field.typed<bool>(node)) {
+		return luabridge::LuaRef {l, *v};
+	}
+	if (const auto* v = field.typed<int>(node)) {
+		return luabridge::LuaRef {l, *v};
+	}
+	if (const auto* v = field.typed<double>(node)) {
+		return luabridge::LuaRef {l, static_cast<lua_Number>(*v)};
+	}
+	return std::nullopt;
+}
+
 // Converts a std::any to a LuaRef
 auto anyToLuaRef(lua_State* l, const std::any& value, const toast::FieldInfo& field) -> luabridge::LuaRef {
 	using luabridge::LuaRef;
@@ -501,7 +522,7 @@ auto anyToLuaRef(lua_State* l, const std::any& value, const toast::FieldInfo& fi
 	// dispatch on field.type since value_type defaults to int_t for unknown vectors
 	if (field.is_array && field.value_type != FieldType::uid_t) {
 		// [[Color]] vec arrays surface as color usertypes
-		if (field.hasAttribute("Color")) {
+		if (field.hasFlag(toast::FieldFlags::color)) {
 			if (field.value_type == FieldType::vec3_t) {
 				return pushColorTable<Color3, glm::vec3>(l, value);
 			}
@@ -578,7 +599,7 @@ auto anyToLuaRef(lua_State* l, const std::any& value, const toast::FieldInfo& fi
 
 		case FieldType::vec3_t:
 			if (const auto* v = std::any_cast<glm::vec3>(&value)) {
-				if (field.hasAttribute("Color")) {
+				if (field.hasFlag(toast::FieldFlags::color)) {
 					return {l, Color3(*v)};
 				}
 				return {l, *v};
@@ -587,7 +608,7 @@ auto anyToLuaRef(lua_State* l, const std::any& value, const toast::FieldInfo& fi
 
 		case FieldType::vec4_t:
 			if (const auto* v = std::any_cast<glm::vec4>(&value)) {
-				if (field.hasAttribute("Color")) {
+				if (field.hasFlag(toast::FieldFlags::color)) {
 					return {l, Color4(*v)};
 				}
 				return {l, *v};
@@ -903,6 +924,9 @@ auto nodeProxyIndex(NodeProxy& proxy, const luabridge::LuaRef& key, lua_State* l
 
 	const toast::FieldInfo* f = lookupField(info, key_str);
 	if (f) {
+		if (auto direct = typedToLuaRef(l, n, *f)) {
+			return *direct;
+		}
 		std::any value = f->get(n);
 		return anyToLuaRef(l, value, *f);
 	}
@@ -0,0 +1,185 @@
+#include "stage_graph.hpp"
+
+#include "profiler.hpp"
+#include "thread_pool.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <tracy/Tracy.hpp>
+#include <utility>
+
+namespace toast {
+
+namespace {
+
+auto touches(FrameResource mask, FrameResource resources) -> bool {
+	return (mask & resources) != FrameResource::none;
+}
+
+}
+
+StageGraph::~StageGraph() {
+	for (auto& job : m_tail) {
+		job.wait();
+	}
+}
+
+void StageGraph::addStage(std::string name, FrameResource reads, FrameResource writes, std::function<void()> fn) {
+	finish();
+	m_stages.push_back({std::move(name), reads, writes, std::move(fn)});
+	m_dirty = true;
+}
+
+void StageGraph::setParallel(bool value) {
+	finish();
+	m_parallel = value;
+}
+
+auto StageGraph::waves() -> const std::vector<std::vector<uint32_t>>& {
+	if (m_dirty) {
+		computeWaves();
+	}
+	return m_waves;
+}
+
+void StageGraph::computeWaves() {
+	std::vector<uint32_t> wave_of(m_stages.size(), 0);
+	m_waves.clear();
+	for (uint32_t i = 0; i < m_stages.size(); ++i) {
+		const Stage& stage = m_stages[i];
+		for (uint32_t j = 0; j < i; ++j) {
+			const Stage& earlier = m_stages[j];
+			const bool conflict = touches(earlier.writes, stage.reads | stage.writes) or touches(stage.writes, earlier.reads);
+			if (conflict) {
+				wave_of[i] = std::max(wave_of[i], wave_of[j] + 1);
+			}
+		}
+
+		if (wave_of[i] >= m_waves.size()) {
+			m_waves.resize(wave_of[i] + 1);
+		}
+		m_waves[wave_of[i]].push_back(i);
+	}
+
+	m_timings.resize(m_stages.size());
+	m_errors.resize(m_stages.size());
+	for (uint32_t i = 0; i < m_stages.size(); ++i) {
+		m_timings[i] = {m_stages[i].name, wave_of[i], 0.0};
+	}
+	m_dirty = false;
+
+	// e.g. "Frame stages: Audio, UI, Lua | Assets | Render build"
+	std::string layout = "Frame stages:";
+	for (size_t w = 0; w < m_waves.size(); ++w) {
+		layout += w == 0 ? " " : " | ";
+		for (size_t k = 0; k < m_waves[w].size(); ++k) {
+			layout += (k == 0 ? "" : ", ") + m_stages[m_waves[w][k]].name;
+		}
+	}
+	TracyMessage(layout.data(), layout.size());
+}
+
+void StageGraph::runStage(uint32_t index) noexcept {
+	const Stage& stage = m_stages[index];
+	ZoneScoped;
+	ZoneName(stage.name.data(), stage.name.size());
+	const Profiler::Scope profile(stage.name.c_str());
+
+	const auto start = std::chrono::steady_clock::now();
+	try {
+		stage.fn();
+	} catch (...) { m_errors[index] = std::current_exception(); }
+	m_timings[index].ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+void StageGraph::joinWave(std::vector<std::future<void>>& futures) {
+	for (auto& job : futures) {
+		ThreadPool::wait(job);
+		job.get();
+	}
+	futures.clear();
+
+	for (auto& error : m_errors) {
+		if (error) {
+			const std::exception_ptr first = std::exchange(error, nullptr);
+			std::ranges::fill(m_errors, nullptr);
+			std::rethrow_exception(first);
+		}
+	}
+}
+
+void StageGraph::run() {
+	ZoneScoped;
+
+	finish();
+	if (m_dirty) {
+		computeWaves();
+	}
+
+	if (not m_parallel) {
+		for (const auto& wave : m_waves) {
+			for (const uint32_t index : wave) {
+				runStage(index);
+			}
+		}
+		joinWave(m_tail);
+		TracyPlot("Frame stages critical path (ms)", criticalPathMs());
+		return;
+	}
+
+	std::vector<std::future<void>> jobs;
+	for (size_t w = 0; w < m_waves.size(); ++w) {
+		const auto& wave = m_waves[w];
+		if (w + 1 == m_waves.size()) {
+			// The last wave keeps running while the caller moves on to the next frame
+			for (const uint32_t index : wave) {
+				m_tail.emplace_back(ThreadPool::push([this, index] { runStage(index); }));
+			}
+			break;
+		}
+
+		// The calling thread takes the first stage instead of idling at the barrier
+		for (size_t k = 1; k < wave.size(); ++k) {
+			jobs.emplace_back(ThreadPool::push([this, index = wave[k]] { runStage(index); }));
+		}
+		runStage(wave[0]);
+		joinWave(jobs);
+	}
+}
+
+void StageGraph::finish() {
+	if (m_tail.empty() and std::ranges::none_of(m_errors, [](const auto& error) { return error != nullptr; })) {
+		return;
+	}
+
+	{
+		ZoneScopedN("Frame stages barrier");
+		std::vector<std::future<void>> tail = std::move(m_tail);
+		m_tail.clear();
+		joinWave(tail);
+	}
+
+	TracyPlot("Frame stages critical path (ms)", criticalPathMs());
+}
+
+auto StageGraph::serialMs() const noexcept -> double {
+	double total = 0.0;
+	for (const Timing& timing : m_timings) {
+		total += timing.ms;
+	}
+	return total;
+}
+
+auto StageGraph::criticalPathMs() const noexcept -> double {
+	double total = 0.0;
+	for (const auto& wave : m_waves) {
+		double slowest = 0.0;
+		for (const uint32_t index : wave) {
+			slowest = std::max(slowest, m_timings[index].ms);
+		}
+		total += slowest;
+	}
+	return total;
+}
+
+}
@@ -0,0 +1,132 @@
+/**
+ * @file stage_graph.hpp
+ * @author Xein
+ * @date 18 Oct 2026
+ *
+ * @brief Per-frame engine stages that run in parallel according to the data they touch
+ */
+
+#pragma once
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <future>
+#include <span>
+#include <string>
+#include <toast/export.hpp>
+#include <vector>
+
+namespace toast {
+
+/// Engine state a frame stage reads or writes; two stages conflict when one writes what the other touches
+enum class FrameResource : uint16_t {
+	none = 0,
+	world = 1 << 0,           ///< node trees, transforms and mesh proxies
+	assets = 1 << 1,          ///< AssetManager caches
+	audio = 1 << 2,           ///< FMOD system and event instances
+	ui = 1 << 3,              ///< RmlUi contexts and their draw data
+	render_frame = 1 << 4,    ///< the renderer's frame slots
+	lua = 1 << 5,             ///< the shared Lua state
+	time = 1 << 6,            ///< Time and the frame timers
+};
+
+constexpr auto operator&(FrameResource lhs, FrameResource rhs) -> FrameResource {
+	return static_cast<FrameResource>(static_cast<uint16_t>(lhs) & static_cast<uint16_t>(rhs));
+}
+
+constexpr auto operator|(FrameResource lhs, FrameResource rhs) -> FrameResource {
+	return static_cast<FrameResource>(static_cast<uint16_t>(lhs) | static_cast<uint16_t>(rhs));
+}
+
+/**
+ * @brief Runs the engine's post-simulation stages in waves on the ThreadPool
+ *
+ * Every stage declares the resources it reads and writes. A stage lands one wave after the
+ * latest earlier stage it conflicts with, so declaration order decides who goes first and
+ * stages that don't share anything run side by side.
+ *
+ * The last wave is left in flight when run() returns. That lets the caller do main-thread work
+ * of the next frame (pumping the window) while e.g. the render frame is still being built.
+ * finish() joins it, and must be called before anything the last wave reads is modified
+ *
+ * Each stage shows up as its own Tracy zone, and the wave layout is sent as a Tracy message
+ * whenever it changes
+ */
+class TOAST_API StageGraph {
+public:
+	/// Timing of one stage in the last finished frame
+	struct Timing {
+		std::string_view name;
+		uint32_t wave = 0;
+		double ms = 0.0;
+	};
+
+	StageGraph() = default;
+	~StageGraph();
+
+	StageGraph(const StageGraph&) = delete;
+	auto operator=(const StageGraph&) -> StageGraph& = delete;
+
+	/**
+	 * @brief Appends a stage
+	 * @param name Shown in Tracy and in timings(); should be a literal or outlive the graph
+	 * @param reads Resources the stage only reads
+	 * @param writes Resources the stage modifies
+	 * @param fn The work; the first exception thrown in a frame is rethrown by finish()
+	 */
+	void addStage(std::string name, FrameResource reads, FrameResource writes, std::function<void()> fn);
+
+	/// Off runs every stage on the calling thread in declaration order, and run() returns with nothing in flight
+	void setParallel(bool value);
+
+	/// Runs one frame of stages; finishes the previous frame first if it's still in flight
+	void run();
+
+	/// Blocks until the last wave of run() finished; no-op when nothing is in flight
+	void finish();
+
+	[[nodiscard]]
+	auto inFlight() const noexcept -> bool {
+		return not m_tail.empty();
+	}
+
+	/// Stage indices per wave, in declaration order
+	[[nodiscard]]
+	auto waves() -> const std::vector<std::vector<uint32_t>>&;
+
+	/// One entry per stage, valid after finish()
+	[[nodiscard]]
+	auto timings() const noexcept -> std::span<const Timing> {
+		return m_timings;
+	}
+
+	/// Sum of every stage's time in the last frame; what running them back to back would cost
+	[[nodiscard]]
+	auto serialMs() const noexcept -> double;
+
+	/// Sum of the slowest stage of each wave in the last frame; the lower bound with enough workers
+	[[nodiscard]]
+	auto criticalPathMs() const noexcept -> double;
+
+private:
+	struct Stage {
+		std::string name;
+		FrameResource reads = FrameResource::none;
+		FrameResource writes = FrameResource::none;
+		std::function<void()> fn;
+	};
+
+	void computeWaves();
+	void runStage(uint32_t index) noexcept;
+	void joinWave(std::vector<std::future<void>>& futures);
+
+	std::vector<Stage> m_stages;
+	std::vector<std::vector<uint32_t>> m_waves;
+	std::vector<Timing> m_timings;
+	std::vector<std::future<void>> m_tail;    ///< jobs of the last wave still running
+	std::vector<std::exception_ptr> m_errors;    ///< per stage, collected so the first one in declaration order wins
+	bool m_dirty = true;
+	bool m_parallel = true;
+};
+
+}
@@ -4,6 +4,12 @@
 
 namespace toast {
 
+namespace {
+
+thread_local bool pool_worker_thread = false;
+
+}
+
 ThreadPool::ThreadPool(size_t size) {
 	// safety check, we don't want more threads than available
 	const size_t max_thread_num = std::thread::hardware_concurrency();
@@ -59,6 +65,7 @@ void ThreadPool::waitIdle() {
 void ThreadPool::threadLoop() {
 	static std::atomic<int> worker_id = 0;
 	thread_local static std::string name = std::format("ThreadPool::worker-{}", worker_id++);
+	pool_worker_thread = true;
 #ifdef TRACY_ENABLE
 	tracy::SetThreadName(name.c_str());
 #endif
@@ -83,12 +90,43 @@ void ThreadPool::threadLoop() {
 			job();
 		}
 
-		// Decrement and notify waitIdle() if pool is now fully idle
-		if (--m.active_jobs == 0) {
-			std::unique_lock<std::mutex> lock(m.queue_mutex);
-			if (m.jobs.empty()) {
-				m.all_done.notify_all();
-			}
+		finishJob();
+	}
+}
+
+auto ThreadPool::runPending() -> bool {
+	auto& o = get();
+	std::move_only_function<void()> job;
+
+	{
+		std::unique_lock<std::mutex> lock(o.m.queue_mutex);
+		if (o.m.jobs.empty()) {
+			return false;
+		}
+		job = std::move(o.m.jobs.front());
+		o.m.jobs.pop();
+		++o.m.active_jobs;
+	}
+
+	{
+		ZoneScopedN("ThreadPool::job() (helping)");
+		job();
+	}
+
+	o.finishJob();
+	return true;
+}
+
+auto ThreadPool::onWorker() noexcept -> bool {
+	return pool_worker_thread;
+}
+
+void ThreadPool::finishJob() {
+	// Decrement and notify waitIdle() if pool is now fully idle
+	if (--m.active_jobs == 0) {
+		std::unique_lock<std::mutex> lock(m.queue_mutex);
+		if (m.jobs.empty()) {
+			m.all_done.notify_all();
 		}
 	}
 }
@@ -6,6 +6,7 @@
  */
 #pragma once
 #include <atomic>
+#include <chrono>
 #include <cassert>
 #include <condition_variable>
 #include <functional>
@@ -77,6 +78,19 @@ public:
 	template<typename T>
 	static auto push(T&& job) -> std::future<std::invoke_result_t<T>>;
 
+	/**
+	 * @brief Blocks until the future is ready; on a worker, runs queued jobs meanwhile
+	 *
+	 * Use this instead of future.wait() in code that may itself run on a worker (e.g. a node owner
+	 * ticking its waves from inside a job); a plain wait there can leave every worker blocked on
+	 * jobs that nobody is left to run. Other threads just wait, so the main thread never picks up
+	 * a long asset load in the middle of a frame
+	 *
+	 * @param future Future returned by push(); still has to be get() afterwards to rethrow
+	 */
+	template<typename R>
+	static void wait(const std::future<R>& future);
+
 	/**
 	 * @brief Destroys the thread pool and waits for all workers to finish.
 	 *
@@ -125,6 +139,15 @@ private:
 	void threadLoop();
 	static void enqueue(std::move_only_function<void()>&& job);
 
+	/// Pops and runs one queued job on the calling thread; false if the queue was empty
+	static auto runPending() -> bool;
+
+	/// True on the pool's own worker threads
+	static auto onWorker() noexcept -> bool;
+
+	/// Bookkeeping after a job ran; wakes waitIdle() when the pool drained
+	void finishJob();
+
 	struct {
 		bool should_stop = false;    ///< Flag to signal workers to stop
 		std::atomic<int> active_jobs =
@@ -147,4 +170,18 @@ auto ThreadPool::push(T&& job) -> std::future<std::invoke_result_t<T>> {
 	return future;
 }
 
+template<typename R>
+void ThreadPool::wait(const std::future<R>& future) {
+	if (not onWorker()) {
+		future.wait();
+		return;
+	}
+
+	while (future.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+		if (not runPending()) {
+			future.wait_for(std::chrono::microseconds(50));
+		}
+	}
+}
+
 }
@@ -2,7 +2,35 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <toast/log.hpp>
+#include <toast/replay.hpp>
+
+auto FixedStepAccumulator::advance(double frame_delta) noexcept -> uint32_t {
+	if (step <= 0.0) {
+		accumulator = 0.0;
+		return 1;
+	}
+
+	accumulator += frame_delta;
+	uint32_t steps = 0;
+	while (accumulator >= step and steps < max_steps) {
+		accumulator -= step;
+		++steps;
+	}
+
+	// Spiral of death: keep the fraction for interpolation and forget the whole steps we can't afford
+	if (accumulator >= step) {
+		const double backlog = std::floor(accumulator / step);
+		dropped_steps += static_cast<uint64_t>(backlog);
+		accumulator -= backlog * step;
+	}
+	return steps;
+}
+
+auto FixedStepAccumulator::alpha() const noexcept -> double {
+	return step > 0.0 ? std::clamp(accumulator / step, 0.0, 1.0) : 1.0;
+}
 
 Time::Time() {
 	ZoneScoped;
@@ -32,8 +60,15 @@ void Time::tick() noexcept {
 	m_now = clock_t::now();
 
 	std::chrono::duration<double> t = m_now - m_previous;
+	advance(t.count());
+}
 
-	const double raw = t.count();
+void Time::advance(double raw_delta) noexcept {
+	// A replay substitutes the recorded delta so the fixed-step accumulator runs the same steps
+	double raw = raw_delta;
+	if (auto* replay = toast::Replay::get()) {
+		raw = replay->beginFrame(raw);
+	}
 	const bool is_paused = m_paused.load(std::memory_order_relaxed);
 
 	// goofy ahh loc
@@ -41,6 +76,17 @@ void Time::tick() noexcept {
 	    is_paused ? 0.0
 	              : std::min(raw * m_delta_scale.load(std::memory_order_relaxed), m_max_delta.load(std::memory_order_relaxed));
 
+	const double rate = m_fixed_rate.load(std::memory_order_relaxed);
+	m_fixed.step = rate > 0.0 ? 1.0 / rate : 0.0;
+	m_fixed.max_steps = std::max(m_max_steps.load(std::memory_order_relaxed), 1u);
+
+	const uint64_t dropped = m_fixed.dropped_steps;
+	m_pending_steps = m_fixed.advance(dt);
+	m_frame_delta = dt;
+	if (m_fixed.dropped_steps != dropped) {
+		TOAST_TRACE("Time", "Frame fell {} fixed steps behind, dropping them", m_fixed.dropped_steps - dropped);
+	}
+
 	// sequence lock write -x
 	// odd means write in progress
 	// even means stable
@@ -48,10 +94,28 @@ void Time::tick() noexcept {
 	m_pub_delta.store(dt, std::memory_order_relaxed);
 	m_pub_raw_delta.store(raw, std::memory_order_relaxed);
 	m_pub_frame.store(++m_sim_frame, std::memory_order_relaxed);
+	m_pub_alpha.store(m_fixed.alpha(), std::memory_order_relaxed);
 	m_pub_paused.store(is_paused, std::memory_order_relaxed);
 	m_sim_seq.fetch_add(1, std::memory_order_release);
 }
 
+void Time::beginStep() noexcept {
+	m_sim_seq.fetch_add(1, std::memory_order_release);
+	m_pub_delta.store(m_fixed.step > 0.0 ? m_fixed.step : m_frame_delta, std::memory_order_relaxed);
+	m_pub_step.store(++m_step_count, std::memory_order_relaxed);
+	m_sim_seq.fetch_add(1, std::memory_order_release);
+}
+
+void Time::endSteps() noexcept {
+	publishDelta(m_frame_delta);
+}
+
+void Time::publishDelta(double delta) noexcept {
+	m_sim_seq.fetch_add(1, std::memory_order_release);
+	m_pub_delta.store(delta, std::memory_order_relaxed);
+	m_sim_seq.fetch_add(1, std::memory_order_release);
+}
+
 void Time::renderTick() noexcept {
 	m_previous_render = m_now_render;
 	m_now_render = clock_t::now();
@@ -85,6 +149,14 @@ auto Time::renderFrame() noexcept -> uint64_t {
 	return instance->m_pub_render_frame.load(std::memory_order_acquire);
 }
 
+auto Time::step() noexcept -> uint64_t {
+	return instance ? instance->m_pub_step.load(std::memory_order_acquire) : 0;
+}
+
+auto Time::alpha() noexcept -> double {
+	return instance->m_pub_alpha.load(std::memory_order_acquire);
+}
+
 auto Time::snapshot() noexcept -> TimeSnapshot {
 	TimeSnapshot out;
 	uint32_t s1, s2;
@@ -98,6 +170,8 @@ auto Time::snapshot() noexcept -> TimeSnapshot {
 		out.delta = instance->m_pub_delta.load(std::memory_order_relaxed);
 		out.raw_delta = instance->m_pub_raw_delta.load(std::memory_order_relaxed);
 		out.frame = instance->m_pub_frame.load(std::memory_order_relaxed);
+		out.step = instance->m_pub_step.load(std::memory_order_relaxed);
+		out.alpha = instance->m_pub_alpha.load(std::memory_order_relaxed);
 		out.paused = instance->m_pub_paused.load(std::memory_order_relaxed);
 		std::atomic_thread_fence(std::memory_order_acquire);
 		s2 = instance->m_sim_seq.load(std::memory_order_relaxed);
@@ -162,3 +236,16 @@ auto Time::system() noexcept -> double {
 void Time::setMaxDelta(double delta) {
 	instance->m_max_delta.store(delta, std::memory_order_relaxed);
 }
+
+auto Time::fixedDelta() noexcept -> double {
+	const double rate = instance->m_fixed_rate.load(std::memory_order_relaxed);
+	return rate > 0.0 ? 1.0 / rate : 0.0;
+}
+
+void Time::setFixedRate(double hz) {
+	instance->m_fixed_rate.store(std::max(hz, 0.0), std::memory_order_relaxed);
+}
+
+void Time::setMaxSteps(uint32_t steps) {
+	instance->m_max_steps.store(steps, std::memory_order_relaxed);
+}
@@ -15,6 +15,10 @@
 
 namespace toast {
 class Engine;
+
+namespace _detail {
+struct WorldTestAccess;
+}
 }
 
 struct TOAST_API TimeSnapshot {
@@ -22,11 +26,36 @@ struct TOAST_API TimeSnapshot {
 	double raw_delta = 0.0;
 	double render_delta = 0.0;
 	double uptime = 0.0;
+	double alpha = 1.0;
 	uint64_t frame = 0;
+	uint64_t step = 0;
 	uint64_t render_frame = 0;
 	bool paused = false;
 };
 
+/**
+ * @brief Turns variable frame times into a whole number of fixed simulation steps
+ *
+ * Frame time goes into the accumulator and comes out in step-sized pieces; whatever is left is
+ * the interpolation alpha for rendering. When a frame would need more than max_steps, the backlog
+ * is dropped instead of simulated so a slow frame can't snowball into slower frames.
+ *
+ * A step of 0 disables the fixed rate: every frame runs exactly one step with its own delta.
+ */
+struct TOAST_API FixedStepAccumulator {
+	double step = 1.0 / 60.0;
+	uint32_t max_steps = 8;
+	double accumulator = 0.0;
+	uint64_t dropped_steps = 0;    ///< steps discarded by the max_steps cap since creation
+
+	/// Adds a frame's worth of simulation time and returns how many steps to run now
+	auto advance(double frame_delta) noexcept -> uint32_t;
+
+	/// @returns Leftover fraction of a step in [0, 1), or 1 when the fixed rate is disabled
+	[[nodiscard]]
+	auto alpha() const noexcept -> double;
+};
+
 /**
  *	@brief Class that controls the time of the application
  *
@@ -38,6 +67,7 @@ class TOAST_API Time final {
 	using clock_t = std::chrono::high_resolution_clock;
 	using time_point_t = clock_t::time_point;
 	friend struct toast::Engine;
+	friend struct toast::_detail::WorldTestAccess;
 
 public:
 	Time(const Time&) = delete;
@@ -56,7 +86,9 @@ public:
 	static auto rawDelta() noexcept -> double;          ///< @returns delta() without time scaling
 	static auto renderDelta() noexcept -> double;       ///< @returns Time the last render frame took
 
-	static auto frame() noexcept -> uint64_t;           ///< @returns Simulation frame counter
+	static auto frame() noexcept -> uint64_t;           ///< @returns Engine frame counter
+	static auto step() noexcept -> uint64_t;            ///< @returns Fixed simulation steps run so far; 0 before Time exists
+	static auto alpha() noexcept -> double;             ///< @returns How far rendering is between the last two steps
 	static auto renderFrame() noexcept -> uint64_t;     ///< @returns Render frame counter
 
 	static auto snapshot() noexcept -> TimeSnapshot;    ///< @returns Consistent snapshot of all time values
@@ -75,18 +107,45 @@ public:
 	static auto system() noexcept -> double;            ///< @returns System clock as seconds since epoch
 	static void setMaxDelta(double delta);              ///< Sets the maximum delta the simulation will report
 
+	static auto fixedDelta() noexcept -> double;        ///< @returns Length of one fixed step, 0 when running variable-rate
+	static void setFixedRate(double hz);                ///< Steps per second; 0 runs one variable-delta step per frame
+	static void setMaxSteps(uint32_t steps);            ///< Most steps a single frame may run before time is dropped
+
 private:
 	Time();
 	static inline Time* instance = nullptr;
 
+	void beginStep() noexcept;    ///< delta() reports the step length until endSteps()
+	void endSteps() noexcept;     ///< delta() goes back to the frame delta for per-frame systems
+
+	/// Runs @p step once per step the accumulator owes this frame, between beginStep() and endSteps()
+	template<typename F>
+	void runSteps(F&& step) {
+		for (uint32_t i = 0; i < m_pending_steps; ++i) {
+			beginStep();
+			step();
+		}
+		endSteps();
+	}
+
+	void advance(double raw_delta) noexcept;    ///< tick() once the wall-clock delta is measured
+
+	void publishDelta(double delta) noexcept;
+
 	std::atomic<double> m_max_delta {1.0 / 15.0};
 	std::atomic<double> m_delta_scale {1.0};
+	std::atomic<double> m_fixed_rate {60.0};
+	std::atomic<uint32_t> m_max_steps {8};
 
 	// main thread state
 	time_point_t m_now;
 	time_point_t m_previous;
 	time_point_t m_start_time;
 	uint64_t m_sim_frame = 0;
+	uint64_t m_step_count = 0;
+	double m_frame_delta = 0.0;
+	uint32_t m_pending_steps = 0;
+	FixedStepAccumulator m_fixed;
 
 	// render thread state
 	time_point_t m_now_render;
@@ -97,6 +156,8 @@ private:
 	alignas(64) std::atomic<double> m_pub_delta {0.0};
 	std::atomic<double> m_pub_raw_delta {0.0};
 	std::atomic<uint64_t> m_pub_frame {0};
+	std::atomic<uint64_t> m_pub_step {0};
+	std::atomic<double> m_pub_alpha {1.0};
 	std::atomic<bool> m_pub_paused {false};
 	std::atomic<bool> m_paused {false};
 	std::atomic<uint32_t> m_sim_seq {0};
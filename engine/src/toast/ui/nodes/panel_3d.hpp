@@ -47,8 +47,8 @@ public:
 	auto pixelSize() const -> glm::ivec2;
 
 	[[nodiscard]]
-	auto worldTransformForRender() -> const glm::mat4& {
-		return getWorldTransform();
+	auto worldTransformForRender(float alpha) -> glm::mat4 {
+		return interpolatedWorldTransform(alpha);
 	}
 
 	void reloadDocument();
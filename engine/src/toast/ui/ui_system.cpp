@@ -20,6 +20,7 @@
 #include <toast/log.hpp>
 #include <toast/project_settings.hpp>
 #include <toast/renderer/vulkan_core.hpp>
+#include <toast/time.hpp>
 #include <tracy/Tracy.hpp>
 
 namespace ui {
@@ -157,6 +158,7 @@ void UISystem::buildDrawFrame(renderer::VulkanRenderer::RenderFrame& frame) {
 	}
 
 	// World panels render to their own textures, drawn by the world UI pass
+	const float alpha = static_cast<float>(Time::alpha());
 	for (toast::Panel3D* panel : m_world_panels) {
 		Rml::Context* context = panel->rmlContext();
 		if (!panel->enabled() || !panel->participatesIn(toast::NodeOwnerParticipation::render) || context == nullptr) {
@@ -165,7 +167,7 @@ void UISystem::buildDrawFrame(renderer::VulkanRenderer::RenderFrame& frame) {
 		panel->syncContextDimensions();
 
 		if (const VkImageView view = record_context(context)) {
-			frame.ui_world_panels.push_back({.view = vk::ImageView(view), .model = panel->worldTransformForRender()});
+			frame.ui_world_panels.push_back({.view = vk::ImageView(view), .model = panel->worldTransformForRender(alpha)});
 		}
 	}
 }
@@ -82,6 +82,8 @@ struct WindowMouseScroll : Event<WindowMouseScroll> {
 /// });
 /// @endcode
 struct WindowResize : Event<WindowResize> {
+	static constexpr auto coalesce = Coalesce::latest;
+
 	int width, height;
 
 	WindowResize(int width, int height) : width(width), height(height) { }
@@ -89,6 +91,8 @@ struct WindowResize : Event<WindowResize> {
 
 /// @brief Event sent when the window's dpi ratio changes
 struct WindowDisplayScale : Event<WindowDisplayScale> {
+	static constexpr auto coalesce = Coalesce::latest;
+
 	float scale;
 
 	explicit WindowDisplayScale(float scale) : scale(scale) { }
@@ -31,21 +31,22 @@ void Camera::onDisable() {
 	}
 }
 
-auto Camera::getView() const -> glm::mat4 {
+auto Camera::getView(float alpha) const -> glm::mat4 {
 	syncTransform();
 
+	const glm::vec3 eye = alpha < 1.0f ? glm::vec3(interpolatedWorldTransform(alpha)[3]) : world_position;
 	glm::vec3 target(0.0f);
-	glm::vec3 delta = target - world_position;
+	glm::vec3 delta = target - eye;
 	if (glm::length(delta) < 0.0001f) {
-		target = world_position + forward();
-		delta = target - world_position;
+		target = eye + forward();
+		delta = target - eye;
 	}
 	const glm::vec3 direction = glm::normalize(delta);
 	glm::vec3 up(0.0f, 0.0f, 1.0f);
 	if (glm::abs(glm::dot(direction, up)) > 0.999f) {
 		up = glm::vec3(0.0f, 1.0f, 0.0f);
 	}
-	return glm::lookAt(world_position, target, up);
+	return glm::lookAt(eye, target, up);
 }
 
 auto Camera::getProjection(float aspect) const -> glm::mat4 {
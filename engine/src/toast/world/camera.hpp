@@ -33,8 +33,9 @@ public:
 
 	void setActiveCamera();
 
+	/// @param alpha Interpolation between the last two fixed steps, see Node3D::interpolatedWorldTransform
 	[[nodiscard]]
-	auto getView() const -> glm::mat4;
+	auto getView(float alpha = 1.0f) const -> glm::mat4;
 	[[nodiscard]]
 	auto getProjection(float aspect) const -> glm::mat4;
 
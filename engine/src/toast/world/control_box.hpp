@@ -23,9 +23,9 @@ struct WorldTestAccess;
 /**
  * @brief Reference-count control block embedded inside the Node allocation
  *
- * Lives immediately before the Node in a single contiguous heap block so that
- * Box<Node> handles need no separate allocation. ControlBox is an implementation
- * detail; user code should interact exclusively through Box<Node>.
+ * Lives in a slot of the owning INodeOwner's NodeSlots, outliving the Node until the
+ * last Box<Node> referencing it drops. ControlBox is an implementation detail; user
+ * code should interact exclusively through Box<Node>.
  *
  * @note Copy and move are deleted: the ControlBox must never move in memory
  *       because all Box handles hold raw pointers to it
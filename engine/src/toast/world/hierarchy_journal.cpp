@@ -0,0 +1,223 @@
+#include "hierarchy_journal.hpp"
+
+#include <algorithm>
+#include <tracy/Tracy.hpp>
+#include <utility>
+
+namespace toast {
+
+namespace {
+
+constexpr uint64_t hierarchy_fnv_basis = 0xcbf29ce484222325ull;
+constexpr uint64_t hierarchy_fnv_prime = 0x100000001b3ull;
+
+void hierarchyHash(uint64_t& hash, uint8_t byte) {
+	hash ^= byte;
+	hash *= hierarchy_fnv_prime;
+}
+
+void hierarchyHash(uint64_t& hash, std::string_view bytes) {
+	for (const char c : bytes) {
+		hierarchyHash(hash, static_cast<uint8_t>(c));
+	}
+	hierarchyHash(hash, uint8_t {0});
+}
+
+}
+
+void HierarchyMirror::detach(uint64_t uid, const Entry& entry) {
+	if (entry.parent.data() == 0) {
+		if (m_root == uid) {
+			m_root = 0;
+		}
+		return;
+	}
+	if (auto parent = m_entries.find(entry.parent.data()); parent != m_entries.end()) {
+		std::erase(parent->second.children, uid);
+	}
+}
+
+void HierarchyMirror::attach(uint64_t uid, Entry& entry, uint32_t index) {
+	if (entry.parent.data() == 0) {
+		m_root = uid;
+		return;
+	}
+	auto parent = m_entries.find(entry.parent.data());
+	if (parent == m_entries.end()) {
+		return;
+	}
+	auto& children = parent->second.children;
+	const auto position = std::min<std::size_t>(index, children.size());
+	children.insert(children.begin() + static_cast<std::ptrdiff_t>(position), uid);
+}
+
+void HierarchyMirror::apply(const HierarchyChange& change) {
+	const uint64_t uid = change.uid.data();
+	auto it = m_entries.find(uid);
+
+	switch (change.kind) {
+		case HierarchyChange::Kind::insert: {
+			if (it != m_entries.end()) {
+				return;
+			}
+			Entry& entry = m_entries[uid];
+			entry.parent = change.parent;
+			entry.uid_text = change.uid.get();
+			entry.name = change.name;
+			entry.type = change.type;
+			entry.enabled = change.enabled;
+			entry.is_prefab = change.is_prefab;
+			attach(uid, entry, change.index);
+			break;
+		}
+		case HierarchyChange::Kind::remove:
+			if (it == m_entries.end()) {
+				return;
+			}
+			detach(uid, it->second);
+			m_entries.erase(it);
+			break;
+		case HierarchyChange::Kind::move:
+			if (it == m_entries.end()) {
+				return;
+			}
+			detach(uid, it->second);
+			it->second.parent = change.parent;
+			attach(uid, it->second, change.index);
+			break;
+		case HierarchyChange::Kind::update:
+			if (it == m_entries.end()) {
+				return;
+			}
+			it->second.name = change.name;
+			it->second.type = change.type;
+			it->second.enabled = change.enabled;
+			it->second.is_prefab = change.is_prefab;
+			break;
+	}
+}
+
+void HierarchyMirror::clear() {
+	m_entries.clear();
+	m_root = 0;
+}
+
+auto HierarchyMirror::find(const UID& uid) const -> const Entry* {
+	auto it = m_entries.find(uid.data());
+	return it != m_entries.end() ? &it->second : nullptr;
+}
+
+auto HierarchyMirror::root() const noexcept -> UID {
+	return m_root;
+}
+
+auto HierarchyMirror::size() const noexcept -> std::size_t {
+	return m_entries.size();
+}
+
+auto HierarchyMirror::checksum() const -> uint64_t {
+	uint64_t hash = hierarchy_fnv_basis;
+	if (m_root == 0) {
+		return hash;
+	}
+
+	std::vector<uint64_t> stack {m_root};
+	while (not stack.empty()) {
+		auto it = m_entries.find(stack.back());
+		stack.pop_back();
+		if (it == m_entries.end()) {
+			continue;
+		}
+
+		const Entry& entry = it->second;
+		hierarchyHash(hash, entry.uid_text);
+		hierarchyHash(hash, entry.name);
+		hierarchyHash(hash, entry.type);
+		hierarchyHash(hash, static_cast<uint8_t>(entry.enabled));
+		hierarchyHash(hash, static_cast<uint8_t>(entry.is_prefab));
+		const auto count = static_cast<uint32_t>(entry.children.size());
+		for (int shift = 0; shift < 32; shift += 8) {
+			hierarchyHash(hash, static_cast<uint8_t>(count >> shift));
+		}
+		stack.insert(stack.end(), entry.children.rbegin(), entry.children.rend());
+	}
+	return hash;
+}
+
+void HierarchyJournal::begin() {
+	++m_pass;
+	m_changes.clear();
+}
+
+void HierarchyJournal::visit(
+    const UID& uid, const UID& parent, uint32_t index, std::string_view name, std::string_view type, bool enabled, bool is_prefab
+) {
+	auto it = m_mirror.m_entries.find(uid.data());
+	if (it == m_mirror.m_entries.end()) {
+		record({HierarchyChange::Kind::insert, uid, parent, index, std::string(name), std::string(type), enabled, is_prefab});
+		m_mirror.m_entries[uid.data()].visited = m_pass;
+		return;
+	}
+
+	HierarchyMirror::Entry& entry = it->second;
+	entry.visited = m_pass;
+
+	// Siblings are visited in order, so everything before index is already in place; anything else
+	// sitting there is on its way out or moving somewhere later in the walk
+	bool in_place = entry.parent == parent;
+	if (in_place and parent.data() != 0) {
+		const HierarchyMirror::Entry* owner = m_mirror.find(parent);
+		in_place = owner != nullptr and index < owner->children.size() and owner->children[index] == uid.data();
+	}
+	if (not in_place) {
+		record({HierarchyChange::Kind::move, uid, parent, index});
+	}
+
+	if (entry.name != name or entry.type != type or entry.enabled != enabled or entry.is_prefab != is_prefab) {
+		record({HierarchyChange::Kind::update, uid, {}, 0, std::string(name), std::string(type), enabled, is_prefab});
+	}
+}
+
+auto HierarchyJournal::end() -> std::vector<HierarchyChange> {
+	ZoneScoped;
+
+	std::vector<uint64_t> gone;
+	for (const auto& [uid, entry] : m_mirror.m_entries) {
+		if (entry.visited != m_pass) {
+			gone.push_back(uid);
+		}
+	}
+	for (const uint64_t uid : gone) {
+		record({HierarchyChange::Kind::remove, UID(uid)});
+	}
+
+	if (m_snapshot or not m_changes.empty()) {
+		++m_sequence;
+	}
+	m_snapshot = false;
+	return std::exchange(m_changes, {});
+}
+
+void HierarchyJournal::reset() {
+	m_mirror.clear();
+	m_snapshot = true;
+}
+
+auto HierarchyJournal::needsSnapshot() const noexcept -> bool {
+	return m_snapshot;
+}
+
+auto HierarchyJournal::sequence() const noexcept -> uint64_t {
+	return m_sequence;
+}
+
+auto HierarchyJournal::mirror() const noexcept -> const HierarchyMirror& {
+	return m_mirror;
+}
+
+void HierarchyJournal::record(HierarchyChange&& change) {
+	m_mirror.apply(change);
+	m_changes.push_back(std::move(change));
+}
+
+}
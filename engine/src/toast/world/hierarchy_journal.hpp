@@ -0,0 +1,139 @@
+/**
+ * @file hierarchy_journal.hpp
+ * @author Xein
+ * @date 18 Oct 2026
+ *
+ * @brief Structural diffs of a node tree for the editor hierarchy
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <toast/export.hpp>
+#include <toast/uid.hpp>
+#include <unordered_map>
+#include <vector>
+
+namespace toast {
+
+/// One structural change to the hierarchy the editor shows, keyed by the node's UID
+struct HierarchyChange {
+	enum class Kind : uint8_t {
+		insert,    ///< a new node under parent at index
+		remove,    ///< only the node itself; its children get their own remove or move
+		move,      ///< reparent and/or reorder to parent at index
+		update,    ///< name, type, enabled or is_prefab changed
+	};
+
+	Kind kind = Kind::insert;
+	UID uid;
+	UID parent;            ///< insert and move; 0 for the root
+	uint32_t index = 0;    ///< insert and move; position among parent's children
+	std::string name;      ///< insert and update
+	std::string type;      ///< insert and update
+	bool enabled = false;
+	bool is_prefab = false;
+};
+
+/**
+ * @brief The tree as the editor holds it: what a snapshot built plus every change applied since
+ *
+ * The engine keeps one per workspace to know what the editor already has, the editor applies the
+ * same rules in C#. Both sides agree on checksum(), which is how the editor notices it drifted
+ */
+class TOAST_API HierarchyMirror {
+public:
+	struct Entry {
+		UID parent;
+		std::string uid_text;    ///< the UID as it goes over the wire; it's what the checksum hashes
+		std::string name;
+		std::string type;
+		bool enabled = false;
+		bool is_prefab = false;
+		std::vector<uint64_t> children;
+		uint32_t visited = 0;    ///< HierarchyJournal pass that last saw it
+	};
+
+	/// Changes naming nodes that aren't there are ignored, the same way the editor ignores them
+	void apply(const HierarchyChange& change);
+	void clear();
+
+	[[nodiscard]]
+	auto find(const UID& uid) const -> const Entry*;
+
+	/// 0 while empty
+	[[nodiscard]]
+	auto root() const noexcept -> UID;
+
+	[[nodiscard]]
+	auto size() const noexcept -> std::size_t;
+
+	/**
+	 * @brief FNV-1a over the tree in preorder, starting at the root
+	 *
+	 * Per node: the UID text, name and type each followed by a zero byte, then enabled and is_prefab
+	 * as one byte each and the child count as four little-endian bytes. Nodes not reachable from the
+	 * root don't count
+	 */
+	[[nodiscard]]
+	auto checksum() const -> uint64_t;
+
+private:
+	friend class HierarchyJournal;
+
+	void detach(uint64_t uid, const Entry& entry);
+	void attach(uint64_t uid, Entry& entry, uint32_t index);
+
+	std::unordered_map<uint64_t, Entry> m_entries;
+	uint64_t m_root = 0;
+};
+
+/**
+ * @brief Turns a walk over the live tree into the changes the editor needs to catch up
+ *
+ * Visit every node in preorder between begin() and end(). Each one is compared by UID against the
+ * mirror of what the editor has; differences become inserts, moves and updates, applied to the mirror
+ * as they're found so the editor replaying them in order ends up with the same tree. end() removes
+ * whatever wasn't visited. An idle tree costs a hash lookup per node and produces nothing
+ */
+class TOAST_API HierarchyJournal {
+public:
+	void begin();
+
+	/// index is the node's position among its parent's children; parent is 0 for the root
+	void visit(
+	    const UID& uid, const UID& parent, uint32_t index, std::string_view name, std::string_view type, bool enabled,
+	    bool is_prefab
+	);
+
+	/// Changes since the last end(), in the order they have to be applied
+	[[nodiscard]]
+	auto end() -> std::vector<HierarchyChange>;
+
+	/// Forgets what the editor has; the next pass should go out as a snapshot
+	void reset();
+
+	/// True until a pass after reset() ended; the caller sends a snapshot instead of the changes
+	[[nodiscard]]
+	auto needsSnapshot() const noexcept -> bool;
+
+	/// Counts the passes that produced changes or a snapshot, so the editor can tell one went missing
+	[[nodiscard]]
+	auto sequence() const noexcept -> uint64_t;
+
+	[[nodiscard]]
+	auto mirror() const noexcept -> const HierarchyMirror&;
+
+private:
+	void record(HierarchyChange&& change);
+
+	HierarchyMirror m_mirror;
+	std::vector<HierarchyChange> m_changes;
+	uint32_t m_pass = 0;
+	uint64_t m_sequence = 0;
+	bool m_snapshot = true;
+};
+
+}
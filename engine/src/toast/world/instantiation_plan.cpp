@@ -0,0 +1,220 @@
+#include "instantiation_plan.hpp"
+
+#include "node.hpp"
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <optional>
+#include <toast/log.hpp>
+#include <toast/uid.hpp>
+#include <tracy/Tracy.hpp>
+#include <unordered_map>
+
+namespace toast {
+
+namespace {
+
+template<typename T>
+void copyField(void* dst, const void* src) {
+	*static_cast<T*>(dst) = *static_cast<const T*>(src);
+}
+
+// Mirrors FieldAccess::set: exact type first, then the integer widths prefabs and scripts hand over
+template<typename T>
+auto bindIntegral(InstantiationPlan::Store& store, const std::any& value, std::deque<std::any>& converted) -> bool {
+	if (const auto* exact = std::any_cast<T>(&value)) {
+		store.copy = &copyField<T>;
+		store.src = exact;
+		return true;
+	}
+
+	std::optional<T> narrowed;
+	auto from = [&]<typename Source>() {
+		if (const auto* v = std::any_cast<Source>(&value)) {
+			narrowed = static_cast<T>(*v);
+			return true;
+		}
+		return false;
+	};
+	static_cast<void>(
+	    from.template operator()<int>() || from.template operator()<unsigned int>() || from.template operator()<long>() ||
+	    from.template operator()<unsigned long>() || from.template operator()<short>() ||
+	    from.template operator()<unsigned short>() || from.template operator()<char>() ||
+	    from.template operator()<unsigned char>()
+	);
+	if (not narrowed) {
+		return false;
+	}
+
+	store.copy = &copyField<T>;
+	store.src = std::any_cast<T>(&converted.emplace_back(*narrowed));
+	return true;
+}
+
+template<typename T>
+auto bindExact(InstantiationPlan::Store& store, const std::any& value) -> bool {
+	if (const auto* exact = std::any_cast<T>(&value)) {
+		store.copy = &copyField<T>;
+		store.src = exact;
+		return true;
+	}
+	return false;
+}
+
+auto makeStore(const FieldInfo& field, const std::any& value, std::deque<std::any>& converted) -> InstantiationPlan::Store {
+	InstantiationPlan::Store store {.field = &field, .value = &value};
+	if (not field.address or not field.type_id) {
+		return store;
+	}
+
+	const std::type_info& target = *field.type_id;
+	auto integral = [&]<typename... Ts>() {
+		return ((target == typeid(Ts) && bindIntegral<Ts>(store, value, converted)) || ...);
+	};
+	auto exact = [&]<typename... Ts>() {
+		return ((target == typeid(Ts) && bindExact<Ts>(store, value)) || ...);
+	};
+
+	static_cast<void>(
+	    integral.template operator()<
+	        bool,
+	        char,
+	        signed char,
+	        unsigned char,
+	        short,
+	        unsigned short,
+	        int,
+	        unsigned int,
+	        long,
+	        unsigned long,
+	        long long,
+	        unsigned long long>() ||
+	    exact.template operator()<float, double, glm::vec2, glm::vec3, glm::vec4, glm::quat, UID, std::string>()
+	);
+	return store;
+}
+
+auto uidOf(const assets::Prefab::BasicNode& data, std::string_view field) -> std::optional<uint64_t> {
+	const auto* f = data.lookup(field);
+	if (f == nullptr) {
+		return std::nullopt;
+	}
+	if (const auto* uid = std::any_cast<UID>(&f->value)) {
+		return uid->data();
+	}
+	return std::nullopt;
+}
+
+}
+
+void InstantiationPlan::Store::apply(Node& node) const {
+	if (copy) {
+		copy(field->address(&node), src);
+	} else {
+		field->set(&node, *value);
+	}
+}
+
+auto InstantiationPlan::current() const noexcept -> bool {
+	return registry_generation == NodeRegistry::generation();
+}
+
+auto InstantiationPlan::apply(const NodePlan& plan, Node& node) -> bool {
+	if (node.info() != plan.info or plan.info == nullptr) {
+		return false;
+	}
+
+	node.name(plan.display_name);
+	for (const Store& store : plan.stores) {
+		store.apply(node);
+	}
+	return true;
+}
+
+auto InstantiationPlan::compile(const assets::Prefab& file) -> std::shared_ptr<const InstantiationPlan> {
+	ZoneScoped;
+
+	auto plan = std::make_shared<InstantiationPlan>();
+	plan->registry_generation = NodeRegistry::generation();
+	plan->nodes.resize(file.nodes.size());
+
+	std::unordered_map<uint64_t, int32_t> uid_index;
+	uid_index.reserve(file.nodes.size());
+
+	for (size_t i = 0; i < file.nodes.size(); ++i) {
+		const auto& data = file.nodes[i];
+		NodePlan& node = plan->nodes[i];
+
+		node.info = NodeRegistry::reflect(data.type);
+		node.display_name = _detail::snakeToNormalCase(data.name);
+		node.reference_uid = _detail::referenceUid(data);
+		plan->has_lua_vars |= not data.lua_vars.empty();
+
+		if (auto uid = uidOf(data, "m_uid")) {
+			uid_index.try_emplace(*uid, static_cast<int32_t>(i));
+		}
+		node.parent_uid = uidOf(data, "m_parent").value_or(0);
+
+		if (node.info == nullptr) {
+			continue;
+		}
+
+		// Same walk and filters as INodeOwner::applyFields, so stores land in the same order
+		node.info->forEachBaseType([&](const NodeInfo& level) {
+			for (const auto& f : level.all_fields) {
+				if (f.name == "m_source_prefab" or f.hasFlag(FieldFlags::transient) or not f.set) {
+					continue;
+				}
+				if (const auto* f_data = data.lookup(f.name)) {
+					node.stores.push_back(makeStore(f, f_data->value, plan->converted));
+				}
+			}
+		});
+	}
+
+	for (auto& node : plan->nodes) {
+		if (auto it = uid_index.find(node.parent_uid); node.parent_uid != 0 and it != uid_index.end()) {
+			node.parent = it->second;
+		}
+	}
+
+	return plan;
+}
+
+namespace _detail {
+
+auto referenceUid(const assets::Prefab::BasicNode& chunk) -> uint64_t {
+	if (auto field = chunk.find("m_source_prefab")) {
+		try {
+			return field->as<toast::UID>().data();
+		} catch (const std::bad_any_cast& e) { TOAST_ERROR("World", "Bad cast at {}: {}", chunk.name, e.what()); }
+	}
+	return 0;
+}
+
+auto snakeToNormalCase(const std::string& text) -> std::string {
+	if (text.empty()) {
+		return "";
+	}
+
+	std::string result;
+
+	for (char ch : text) {
+		if (ch == '_') {
+			result += ' ';
+		} else {
+			result += ch;
+		}
+	}
+
+	// cleanup if theres trailing spaces
+	if (!result.empty() && result.back() == ' ') {
+		result.pop_back();
+	}
+
+	return result;
+}
+
+}
+
+}
@@ -0,0 +1,83 @@
+/**
+ * @file instantiation_plan.hpp
+ * @author Xein
+ * @date 18 Oct 2026
+ *
+ * @brief Precompiled field stores and tree layout for instantiating a prefab
+ */
+
+#pragma once
+
+#include <any>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <string>
+#include <toast/assets/prefab.hpp>
+#include <toast/export.hpp>
+#include <toast/reflect/reflect_node.hpp>
+#include <vector>
+
+namespace toast {
+class Node;
+
+/**
+ * @brief Everything INodeOwner::instantiate derives from a prefab that doesn't depend on the instance
+ *
+ * Compiled once per prefab asset and cached on it. For every node it keeps the NodeInfo the stores
+ * were resolved against, the (field, value) pairs applyFields would apply in the same order, the
+ * display name, the nested prefab reference and the parent index. Values whose type matches the
+ * field (or that only need integer narrowing) are pre-converted into typed stores, everything else
+ * keeps going through FieldInfo::set.
+ *
+ * A plan points into the prefab's field data, so it dies with the prefab and has to be dropped with
+ * Prefab::invalidatePlan() if the nodes are edited in place. Reloading node types invalidates it too,
+ * see current().
+ */
+struct TOAST_API InstantiationPlan {
+	struct Store {
+		const FieldInfo* field = nullptr;
+		const std::any* value = nullptr;            ///< used by the FieldInfo::set fallback
+		void (*copy)(void*, const void*) = nullptr;    ///< typed assignment; null when falling back to set
+		const void* src = nullptr;                  ///< pre-converted value for copy
+
+		void apply(Node& node) const;
+	};
+
+	struct NodePlan {
+		const NodeInfo* info = nullptr;    ///< stores are only valid for nodes reflecting exactly this type
+		std::string display_name;
+		std::vector<Store> stores;
+		uint64_t reference_uid = 0;    ///< non-zero for a nested prefab instance
+		int32_t parent = -1;           ///< index into nodes, -1 when no node in the prefab carries parent_uid
+		uint64_t parent_uid = 0;
+	};
+
+	std::vector<NodePlan> nodes;
+	std::deque<std::any> converted;    ///< storage for narrowed values; deque keeps them in place
+	uint32_t registry_generation = 0;
+	bool has_lua_vars = false;
+
+	/// False once NodeRegistry changed since compilation
+	[[nodiscard]]
+	auto current() const noexcept -> bool;
+
+	/**
+	 * @brief Sets the display name and every field the plan holds for this node
+	 * @return false without touching the node when it doesn't reflect plan.info, so the caller can
+	 *         fall back to INodeOwner::applyFields
+	 */
+	static auto apply(const NodePlan& plan, Node& node) -> bool;
+
+	static auto compile(const assets::Prefab& file) -> std::shared_ptr<const InstantiationPlan>;
+};
+
+namespace _detail {
+/// UID of the prefab a chunk instances, or 0 for a plain node
+auto referenceUid(const assets::Prefab::BasicNode& chunk) -> uint64_t;
+
+/// Prefab node names are stored snake_case; the live node shows them with spaces
+auto snakeToNormalCase(const std::string& text) -> std::string;
+}
+
+}
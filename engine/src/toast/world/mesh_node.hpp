@@ -27,7 +27,7 @@ public:
 	    : m_mesh(std::move(mesh)),
 	      m_material(std::move(material)) { }
 
-	auto worldTransformForRender() -> const glm::mat4& { return getWorldTransform(); }
+	auto worldTransformForRender(float alpha) -> glm::mat4 { return interpolatedWorldTransform(alpha); }
 
 	[[nodiscard]]
 	auto getMesh() const -> const assets::Handle<assets::Mesh>& {
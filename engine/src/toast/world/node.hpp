@@ -323,6 +323,9 @@ public:
 	auto get(std::string_view name) const -> T {
 		if (m_info) {
 			if (const auto* f = m_info->getField(name)) {
+				if (const auto* direct = f->typed<T>(this)) {
+					return *direct;
+				}
 				std::any v = f->get(const_cast<Node*>(this));
 				if (auto* p = std::any_cast<T>(&v)) {
 					return *p;
@@ -344,7 +347,11 @@ public:
 	void set(std::string_view name, const T& value) {
 		if (m_info) {
 			if (const auto* f = m_info->getField(name)) {
-				f->set(this, std::any(value));
+				if (auto* direct = f->typed<T>(this)) {
+					*direct = value;
+				} else {
+					f->set(this, std::any(value));
+				}
 				onReflectedFieldChanged(f->name);
 			}
 		}
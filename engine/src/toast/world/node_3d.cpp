@@ -2,6 +2,7 @@
 
 #include "world.hpp"
 
+#include <toast/time.hpp>
 #include <tracy/Tracy.hpp>
 
 namespace toast {
@@ -136,13 +137,27 @@ void Node3D::syncTransform() const {
 
 	const bool world_changed = m_dirty_world;
 	if (m_dirty_world) {
+		// A node that was never synced has no previous step to blend from
+		const bool first_sync = m_step == 0;
+		if (const uint64_t step = Time::step(); m_step != step) {
+			m_step_world_position = m_previous_world_position;
+			m_step_world_rotation = m_previous_world_rotation;
+			m_step_world_scale = m_previous_world_scale;
+			m_step = step;
+		}
+
 		m_world_transform = parent_mat * m_transform;
+		++m_world_version;
 
 		decomposeTransform(m_world_transform, world_position, world_rotation, world_scale);
 		m_previous_world_position = world_position;
 		m_previous_world_rotation = world_rotation;
 		m_previous_world_scale = world_scale;
 		m_dirty_world = false;
+
+		if (first_sync) {
+			resetInterpolation();
+		}
 	}
 
 	if (world_changed) {
@@ -169,6 +184,32 @@ auto Node3D::getWorldTransform() const noexcept -> const glm::mat4& {
 	return m_world_transform;
 }
 
+auto Node3D::transformParent() const noexcept -> const Node3D* {
+	return m_transform_parent.exists() ? &*m_transform_parent : nullptr;
+}
+
+auto Node3D::interpolatedWorldTransform(float alpha) const -> glm::mat4 {
+	// Not moved during the last step, so both ends of the blend are the current transform
+	if (alpha >= 1.0f or m_step != Time::step()) {
+		return m_world_transform;
+	}
+
+	glm::mat4 blended;
+	composeTransform(
+	    blended,
+	    glm::mix(m_step_world_position, m_previous_world_position, alpha),
+	    glm::slerp(m_step_world_rotation, m_previous_world_rotation, alpha),
+	    glm::mix(m_step_world_scale, m_previous_world_scale, alpha)
+	);
+	return blended;
+}
+
+void Node3D::resetInterpolation() const {
+	m_step_world_position = m_previous_world_position;
+	m_step_world_rotation = m_previous_world_rotation;
+	m_step_world_scale = m_previous_world_scale;
+}
+
 void Node3D::init() {
 	// Find the closest Node3D parent
 	// we ONLY register dependency on the found one
@@ -65,12 +65,32 @@ public:
 	[[nodiscard]]
 	auto getWorldTransform() const noexcept -> const glm::mat4&;
 
+	/// Bumped every time syncTransform() recomputes the world transform; lets caches of it tell when they went stale
+	[[nodiscard]]
+	auto worldVersion() const noexcept -> uint64_t {
+		return m_world_version;
+	}
+
+	/**
+	 * @brief World transform blended between the last two fixed simulation steps
+	 * @param alpha Usually Time::alpha(); 1 returns the latest simulated transform
+	 */
+	[[nodiscard]]
+	auto interpolatedWorldTransform(float alpha) const -> glm::mat4;
+
+	/// Makes rendering show the current transform without blending from the last step, e.g. after a teleport
+	void resetInterpolation() const;
+
 	static constexpr glm::vec3 world_up = {0.0f, 0.0f, 1.0f};
 	static constexpr glm::vec3 world_forward = {0.0f, 1.0f, 0.0f};
 
 protected:
 	void init();
 
+	/// Node3D this node is positioned relative to, or null at the top of a tree
+	[[nodiscard]]
+	auto transformParent() const noexcept -> const Node3D*;
+
 private:
 	mutable bool m_dirty_world = true;
 	Box<Node3D> m_transform_parent;
@@ -82,6 +102,14 @@ private:
 	alignas(16) mutable glm::quat m_previous_world_rotation = glm::quat(1.0f, 0.0f, 0.0f, 0.0f);
 	alignas(16) mutable glm::vec3 m_previous_world_scale = glm::vec3(1.0f);
 
+	// Synced world transform as it was at the end of the previous fixed step; captured by the first
+	// syncTransform() of a step that moves the node, so static nodes never pay for it
+	alignas(16) mutable glm::vec3 m_step_world_position = glm::vec3(0.0f);
+	alignas(16) mutable glm::quat m_step_world_rotation = glm::quat(1.0f, 0.0f, 0.0f, 0.0f);
+	alignas(16) mutable glm::vec3 m_step_world_scale = glm::vec3(1.0f);
+	mutable uint64_t m_step = 0;    ///< Time::step() the above was captured in
+	mutable uint64_t m_world_version = 0;
+
 	mutable glm::mat4 m_transform = glm::mat4(1.0f);
 	mutable glm::mat4 m_world_transform = glm::mat4(1.0f);
 };
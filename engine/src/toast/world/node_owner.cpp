@@ -2,11 +2,15 @@
 
 #include "camera.hpp"
 #include "camera_controller.hpp"
+#include "instantiation_plan.hpp"
 #include "node.hpp"
 #include "node_3d.hpp"
+#include "node_pool.hpp"
 
 #include <algorithm>
 #include <charconv>
+#include <deque>
+#include <exception>
 #include <future>
 #include <memory>
 #include <toast/assets/asset_manager.hpp>
@@ -207,40 +211,6 @@ auto INodeOwner::activeRenderCamera() noexcept -> Camera* {
 	return m_active_camera.exists() ? &*m_active_camera : nullptr;
 }
 
-namespace {
-auto referenceUid(const assets::Prefab::BasicNode& chunk) -> uint64_t {
-	if (auto field = chunk.find("m_source_prefab")) {
-		try {
-			return field->as<toast::UID>().data();
-		} catch (const std::bad_any_cast& e) { TOAST_ERROR("World", "Bad cast at {}: {}", chunk.name, e.what()); }
-	}
-	return 0;
-}
-
-auto snakeToNormalCase(const std::string& text) -> std::string {
-	if (text.empty()) {
-		return "";
-	}
-
-	std::string result;
-
-	for (char ch : text) {
-		if (ch == '_') {
-			result += ' ';
-		} else {
-			result += ch;
-		}
-	}
-
-	// cleanup if theres trailing spaces
-	if (!result.empty() && result.back() == ' ') {
-		result.pop_back();
-	}
-
-	return result;
-}
-}
-
 auto INodeOwner::requestRuntimeCreate(Node& parent, std::string_view type) -> Box<Node> {
 	ZoneScoped;
 
@@ -352,7 +322,7 @@ auto INodeOwner::uniqueChildName(const Node& parent, std::string_view base) -> s
 	}
 }
 
-auto INodeOwner::nodeAllocation(std::string_view type) noexcept -> Box<Node> {
+auto INodeOwner::nodeAllocation(std::string_view type, SlotTarget target) noexcept -> Box<Node> {
 	ZoneScoped;
 
 	const NodeInfo* info = NodeRegistry::reflect(type);
@@ -371,10 +341,11 @@ auto INodeOwner::nodeAllocation(std::string_view type) noexcept -> Box<Node> {
 	Node* raw_node = (info && info->construct) ? info->construct() : new Node();
 #endif
 
-	{
+	if (target.reservation) {
+		target.reservation->emplace(target.index, raw_node, info ? info->destroy : nullptr);
+	} else {
 		std::scoped_lock lock(nodes_mutex);
-		auto [it, result] = nodes.emplace(raw_node);
-		TOAST_ASSERT(result, "World", "Node allocation failed");
+		nodes.emplace(raw_node, info ? info->destroy : nullptr);
 	}
 	raw_node->m_info = info;     // attach reflection data
 	raw_node->m_reflect_type_name = info->type;
@@ -383,10 +354,14 @@ auto INodeOwner::nodeAllocation(std::string_view type) noexcept -> Box<Node> {
 	return raw_node->box();
 }
 
-auto INodeOwner::nodeAllocation(const assets::Prefab::BasicNode& node_data) noexcept -> Box<Node> {
+auto INodeOwner::nodeAllocation(
+    const assets::Prefab::BasicNode& node_data, const InstantiationPlan::NodePlan* plan, SlotTarget target
+) noexcept -> Box<Node> {
 	std::string type = node_data.type;
-	auto box = nodeAllocation(type);
-	applyFields(*box, node_data);
+	auto box = nodeAllocation(type, target);
+	if (not plan or not InstantiationPlan::apply(*plan, *box)) {
+		applyFields(*box, node_data);
+	}
 	box->loadScripts();
 	return box;
 }
@@ -394,7 +369,7 @@ auto INodeOwner::nodeAllocation(const assets::Prefab::BasicNode& node_data) noex
 void INodeOwner::applyFields(Node& node, const assets::Prefab::BasicNode& data) {
 	ZoneScoped;
 
-	std::string proper_name = snakeToNormalCase(data.name);
+	std::string proper_name = _detail::snakeToNormalCase(data.name);
 	node.name(proper_name);
 
 	const NodeInfo* info = node.info();
@@ -408,14 +383,14 @@ void INodeOwner::applyFields(Node& node, const assets::Prefab::BasicNode& data)
 				continue;
 			}
 
-			auto f_data = data.find(f.name);
-			if (not f_data.has_value()) {
+			const auto* f_data = data.lookup(f.name);
+			if (f_data == nullptr) {
 				continue;
 			}
 
 			// Read-only and transient fields are never restored from persisted data. Checking
 			// NoSerialize here also keeps older files containing those fields safe to load.
-			if (f.hasAttribute("ReadOnly") || f.hasAttribute("NoSerialize")) {
+			if (f.hasFlag(FieldFlags::transient)) {
 				continue;
 			}
 
@@ -464,24 +439,35 @@ void INodeOwner::applyLuaOverrides(Node& node, const assets::Prefab::BasicNode&
 	}
 }
 
-auto INodeOwner::buildTree(std::vector<Box<Node>>&& nodes, const assets::Handle<assets::Prefab>& file) -> Box<Node> {
+auto INodeOwner::buildTree(
+    std::vector<Box<Node>>&& nodes, const assets::Handle<assets::Prefab>& file, const InstantiationPlan* plan
+) -> Box<Node> {
 	ZoneScoped;
 
+	// The plan already knows every parent index, so the UID map is only built when something needs it
 	std::unordered_map<uint64_t, Box<Node>> uid_map;
-	uid_map.reserve(nodes.size());
-	for (auto& node : nodes) {
-		auto [it, inserted] = uid_map.emplace(node->uid().data(), node);
-#ifndef NDEBUG
-		if (not inserted) {
-			TOAST_WARN(
-			    "World",
-			    "Duplicate UID {} within a single prefab ({} and {}); keeping the first",
-			    node->uid(),
-			    it->second->name(),
-			    node->name()
-			);
+	auto build_uid_map = [&] {
+		if (not uid_map.empty()) {
+			return;
 		}
+		uid_map.reserve(nodes.size());
+		for (auto& node : nodes) {
+			auto [it, inserted] = uid_map.emplace(node->uid().data(), node);
+#ifndef NDEBUG
+			if (not inserted and not plan) {
+				TOAST_WARN(
+				    "World",
+				    "Duplicate UID {} within a single prefab ({} and {}); keeping the first",
+				    node->uid(),
+				    it->second->name(),
+				    node->name()
+				);
+			}
 #endif
+		}
+	};
+	if (not plan or plan->has_lua_vars) {
+		build_uid_map();
 	}
 
 	Box<Node> root;
@@ -490,14 +476,22 @@ auto INodeOwner::buildTree(std::vector<Box<Node>>&& nodes, const assets::Handle<
 	for (size_t i = 0; i < nodes.size(); ++i) {
 		auto& node = nodes[i];
 		const auto& data = file->nodes[i];
-
-		auto parent_field = data.find("m_parent");
 		bool has_parent = false;
 
-		if (parent_field.has_value()) {
+		// A nested instance root may keep its own UID when the chunk doesn't override it; only trust
+		// the planned index while the live parent still carries the UID the plan resolved
+		const InstantiationPlan::NodePlan* np = plan ? &plan->nodes[i] : nullptr;
+		const bool planned_parent = np and np->parent >= 0 and nodes[np->parent]->uid().data() == np->parent_uid;
+
+		if (planned_parent) {
+			node->m_parent = nodes[np->parent];
+			nodes[np->parent]->m_children.emplace_back(node);
+			has_parent = true;
+		} else if (auto parent_field = data.find("m_parent")) {
 			try {
 				UID parent_uid = parent_field->as<UID>();
 
+				build_uid_map();
 				auto it = uid_map.find(parent_uid.data());
 				if (it != uid_map.end()) {
 					node->m_parent = it->second;
@@ -556,6 +550,40 @@ auto INodeOwner::buildTree(std::vector<Box<Node>>&& nodes, const assets::Handle<
 	return root;
 }
 
+namespace {
+
+// Prefab entries allocated per ThreadPool job; big enough to amortize the dispatch, small enough to spread a level
+constexpr size_t instantiate_batch_size = 256;
+
+// One prefab occurrence inside an instantiation: the outer file or any nested prefab it expands to
+struct PrefabInstanceJob {
+	enum class Entry : uint8_t {
+		leaf,
+		nested,
+		unresolved,
+	};
+
+	assets::Handle<assets::Prefab> file;
+	std::shared_ptr<const InstantiationPlan> plan;
+	std::vector<Entry> entries;
+	std::vector<size_t> nested;    ///< job index of each nested entry
+	std::vector<Box<Node>> slots;
+	size_t first_slot = 0;         ///< offset of entry 0 in the shared reservation
+	Box<Node> root;
+
+	[[nodiscard]]
+	auto nodePlan(size_t i) const -> const InstantiationPlan::NodePlan* {
+		return plan ? &plan->nodes[i] : nullptr;
+	}
+
+	[[nodiscard]]
+	auto referenceUid(size_t i) const -> uint64_t {
+		return plan ? plan->nodes[i].reference_uid : _detail::referenceUid(file->nodes[i]);
+	}
+};
+
+}
+
 auto INodeOwner::instantiate(const assets::Handle<assets::Prefab>& file, InstantiateContext& ctx) -> Box<Node> {
 	ZoneScoped;
 
@@ -564,103 +592,238 @@ auto INodeOwner::instantiate(const assets::Handle<assets::Prefab>& file, Instant
 		return {};
 	}
 
-	ctx.asset_chain.push_back(file.uid().data());
+	// 1. Expand every nested prefab up front; deque keeps jobs in place while the recursion appends
+	std::deque<PrefabInstanceJob> jobs;
+	size_t slot_count = 0;
+
+	auto expand = [&](this auto&& self, const assets::Handle<assets::Prefab>& prefab) -> size_t {
+		const size_t index = jobs.size();
+		const size_t count = prefab->nodes.size();
+		PrefabInstanceJob& job = jobs.emplace_back();
+		job.file = prefab;
+		job.entries.resize(count, PrefabInstanceJob::Entry::leaf);
+		job.nested.resize(count);
+		job.slots.resize(count);
+		job.first_slot = slot_count;
+		slot_count += count;
+
+		if (ctx.use_plans) {
+			job.plan = prefab->plan();
+			if (not job.plan or not job.plan->current()) {
+				job.plan = InstantiationPlan::compile(*prefab);
+				prefab->plan(job.plan);
+			}
+		}
+
+		ctx.asset_chain.push_back(prefab.uid().data());
+		for (size_t i = 0; i < count; ++i) {
+			uint64_t ref_uid = job.referenceUid(i);
+			if (ref_uid == 0) {
+				continue;
+			}
+
+			bool cycle = std::ranges::find(ctx.asset_chain, ref_uid) != ctx.asset_chain.end();
+			assets::Handle<assets::Prefab> sub = cycle ? assets::Handle<assets::Prefab> {} : ctx.resolver(toast::UID(ref_uid));
+			if (cycle or not sub.hasValue()) {
+				TOAST_ERROR(
+				    "World",
+				    "Could not instantiate nested prefab {} ({}); keeping reference unresolved",
+				    toast::UID(ref_uid),
+				    cycle ? "cycle detected" : "asset missing"
+				);
+				job.entries[i] = PrefabInstanceJob::Entry::unresolved;
+				continue;
+			}
+
+			job.entries[i] = PrefabInstanceJob::Entry::nested;
+			job.nested[i] = self(sub);
+		}
+		ctx.asset_chain.pop_back();
+		return index;
+	};
+	expand(file);
+
+	// 2. One slot per entry, taken in job order so the layout never depends on thread timing
+	_detail::NodeSlots::Reservation reservation;
+	{
+		std::scoped_lock lock(nodes_mutex);
+		reservation = nodes.reserve(slot_count);
+	}
+
+	// Publish whatever got constructed even when a lifecycle callback throws, so no slot stays reserved
+	struct CommitOnExit {
+		INodeOwner& owner;
+		_detail::NodeSlots::Reservation& reservation;
+
+		~CommitOnExit() {
+			std::scoped_lock lock(owner.nodes_mutex);
+			owner.nodes.commit(std::move(reservation));
+		}
+	} commit {*this, reservation};
 
 	// deserialize + run the pre-tick lifecycle, then mark as loading
-	auto alloc_leaf = [this](const assets::Prefab::BasicNode& chunk) -> Box<Node> {
-		Box<Node> node = nodeAllocation(chunk);
+	auto alloc_leaf = [this, &reservation](
+	                      const assets::Prefab::BasicNode& chunk, const InstantiationPlan::NodePlan* np, size_t slot
+	                  ) -> Box<Node> {
+		Box<Node> node = nodeAllocation(chunk, np, {&reservation, slot});
 		node->callTick(node->info(), TickFunctionList::load);
 		node->callTick(node->info(), TickFunctionList::pre_init);    // TODO: deprecate pre_init
 		node->m_state = NodeState::loading;
 		return node;
 	};
 
-	auto make_unresolved = [&](const assets::Prefab::BasicNode& chunk, uint64_t ref_uid) -> Box<Node> {
-		Box<Node> node = alloc_leaf(chunk);
+	auto make_unresolved = [&](const PrefabInstanceJob& job, size_t i) -> Box<Node> {
+		const auto& chunk = job.file->nodes[i];
+		Box<Node> node = alloc_leaf(chunk, job.nodePlan(i), job.first_slot + i);
 		node->m_unresolved_chunk = std::make_shared<const assets::Prefab::BasicNode>(chunk);
-		UID uid {ref_uid};
+		UID uid {job.referenceUid(i)};
 		std::string uri = assets::AssetManager::getURI(uid);
 		node->m_source_prefab = assets::Handle<assets::Prefab>(nullptr, uid, uri);
 		return node;
 	};
 
-	std::vector<Box<Node>> slots(file->nodes.size());
-	std::vector<std::pair<size_t, std::future<Box<Node>>>> pending;
-
-	for (size_t i = 0; i < file->nodes.size(); ++i) {
-		const assets::Prefab::BasicNode* chunk = &file->nodes[i];
-		uint64_t ref_uid = referenceUid(*chunk);
-
-		if (ref_uid == 0) {
-			// allocate the leaf on the thread pool
-			pending.emplace_back(i, ThreadPool::push([&alloc_leaf, chunk]() { return alloc_leaf(*chunk); }));
-			continue;
+	// 3. Allocate every leaf. Batches are cut over the flat slot range rather than per job, so a level of
+	// many small nested prefabs still hands the pool full batches; each only writes its own slots, no lock
+	auto run_batch = [&alloc_leaf, &jobs](size_t begin, size_t end) {
+		ZoneScopedN("INodeOwner::instantiate batch");
+		// Jobs sit back to back in slot order; start at the last one whose range begins at or before `begin`
+		auto it = std::ranges::upper_bound(jobs, begin, {}, &PrefabInstanceJob::first_slot) - 1;
+		for (; it != jobs.end() and it->first_slot < end; ++it) {
+			PrefabInstanceJob& job = *it;
+			const size_t first = std::max(begin, job.first_slot) - job.first_slot;
+			const size_t last = std::min(end - job.first_slot, job.entries.size());
+			for (size_t i = first; i < last; ++i) {
+				if (job.entries[i] == PrefabInstanceJob::Entry::leaf) {
+					job.slots[i] = alloc_leaf(job.file->nodes[i], job.nodePlan(i), job.first_slot + i);
+				}
+			}
 		}
+	};
 
-		// expand a nested instance synchronously on this thread
-		bool cycle = std::ranges::find(ctx.asset_chain, ref_uid) != ctx.asset_chain.end();
-		assets::Handle<assets::Prefab> sub = cycle ? assets::Handle<assets::Prefab> {} : ctx.resolver(toast::UID(ref_uid));
-
-		if (cycle or not sub.hasValue()) {
-			TOAST_ERROR(
-			    "World",
-			    "Could not instantiate nested prefab {} ({}); keeping reference unresolved",
-			    toast::UID(ref_uid),
-			    cycle ? "cycle detected" : "asset missing"
-			);
-			slots[i] = make_unresolved(*chunk, ref_uid);
-			continue;
+	// Small trees are cheaper to build inline than to hand over to the pool
+	const bool parallel = ctx.parallel and slot_count > instantiate_batch_size;
+	std::vector<std::future<void>> pending;
+	for (size_t begin = 0; begin < slot_count; begin += instantiate_batch_size) {
+		const size_t end = std::min(begin + instantiate_batch_size, slot_count);
+		if (parallel) {
+			pending.push_back(ThreadPool::push([&run_batch, begin, end] { run_batch(begin, end); }));
+		} else {
+			run_batch(begin, end);
 		}
+	}
 
-		Box<Node> sub_root = instantiate(sub, ctx);
-		if (not sub_root.exists()) {
-			slots[i] = make_unresolved(*chunk, ref_uid);
-			continue;
+	// Every batch has to finish before the reservation is committed, even if one of them threw
+	std::exception_ptr failure;
+	for (auto& fut : pending) {
+		try {
+			fut.get();
+		} catch (...) {
+			if (not failure) {
+				failure = std::current_exception();
+			}
 		}
+	}
+	if (failure) {
+		std::rethrow_exception(failure);
+	}
 
-		applyFields(*sub_root, *chunk);
+	// 4. Assemble bottom-up: nested jobs always come after the job that embeds them
+	for (size_t j = jobs.size(); j-- > 0;) {
+		PrefabInstanceJob& job = jobs[j];
 
-		// Everything below an instance root is interior to that instance
-		auto mark_interior = [](this auto&& self, Node& n) -> void {
-			for (auto& child : n.m_children) {
-				child->m_prefab_interior = true;
-				self(*child);
+		for (size_t i = 0; i < job.entries.size(); ++i) {
+			if (job.entries[i] == PrefabInstanceJob::Entry::unresolved) {
+				job.slots[i] = make_unresolved(job, i);
+				continue;
+			}
+			if (job.entries[i] != PrefabInstanceJob::Entry::nested) {
+				continue;
 			}
-		};
-		mark_interior(*sub_root);
 
-		slots[i] = sub_root;
-	}
+			Box<Node> sub_root = jobs[job.nested[i]].root;
+			if (not sub_root.exists()) {
+				job.slots[i] = make_unresolved(job, i);
+				continue;
+			}
 
-	for (auto& [index, fut] : pending) {
-		slots[index] = fut.get();
-	}
+			const InstantiationPlan::NodePlan* np = job.nodePlan(i);
+			if (not np or not InstantiationPlan::apply(*np, *sub_root)) {
+				applyFields(*sub_root, job.file->nodes[i]);
+			}
 
-	Box<Node> root = buildTree(std::move(slots), file);
+			// Everything below an instance root is interior to that instance
+			auto mark_interior = [](this auto&& self, Node& n) -> void {
+				for (auto& child : n.m_children) {
+					child->m_prefab_interior = true;
+					self(*child);
+				}
+			};
+			mark_interior(*sub_root);
 
-	if (root.exists() && root->m_source_prefab.uid().data() == 0) {
-		root->m_source_prefab = file;
+			job.slots[i] = sub_root;
+		}
+
+		job.root = buildTree(std::move(job.slots), job.file, job.plan.get());
+		if (job.root.exists() && job.root->m_source_prefab.uid().data() == 0) {
+			job.root->m_source_prefab = job.file;
+		}
 	}
 
-	ctx.asset_chain.pop_back();
-	return root;
+	return jobs.front().root;
 }
 
 void INodeOwner::releaseNode(_detail::ControlBox& control) noexcept {
 	control.node = nullptr;
-	tombstones++;
+	tombstones.push_back(&control);
 }
 
 void INodeOwner::reapTombstones() noexcept {
-	if (tombstones == 0) {
+	if (tombstones.empty()) {
 		return;
 	}
 	std::scoped_lock lock(nodes_mutex);
-	tombstones -= std::erase_if(nodes, [](const _detail::ControlBox& control) {
-		return control.node == nullptr && control.ref_count.load(std::memory_order_acquire) == 0;
+	std::erase_if(tombstones, [this](_detail::ControlBox* control) {
+		if (control->ref_count.load(std::memory_order_acquire) != 0) {
+			return false;
+		}
+		nodes.erase(*control);
+		return true;
 	});
 }
 
+void INodeOwner::freeNodes(std::span<Node* const> victims) noexcept {
+	if (victims.empty()) {
+		return;
+	}
+	ZoneScoped;
+	ZoneValue(victims.size());
+
+	// Detach the tree structure first so no victim holds a Box to another while they are freed
+	for (Node* victim : victims) {
+		victim->m_parent = {};
+		victim->m_children.clear();
+		victim->m_listener.reset();
+	}
+
+	{
+		std::scoped_lock lock(nodes_mutex);
+		_detail::NodePool::BulkRelease bulk;
+		tombstones.reserve(tombstones.size() + victims.size());
+		for (Node* victim : victims) {
+			_detail::ControlBox* control = _detail::ControlBox::get(victim);
+			// Always free through the allocation's Deleter; m_info may have been swapped since
+			if (auto deleter = _detail::NodeSlots::deleterOf(*control)) {
+				deleter(victim);
+			} else {
+				delete victim;
+			}
+			releaseNode(*control);
+		}
+	}
+
+	reapTombstones();
+}
+
 void INodeOwner::reloadScriptsUsing(UID script_uid) noexcept {
 	std::scoped_lock lock(nodes_mutex);
 	forEachNode([&](const _detail::ControlBox& control) {
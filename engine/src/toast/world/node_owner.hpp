@@ -10,10 +10,13 @@
 
 #pragma once
 #include "box.hpp"
+#include "instantiation_plan.hpp"
+#include "node_slots.hpp"
 
 #include <cstdint>
 #include <functional>
 #include <mutex>
+#include <span>
 #include <string_view>
 #include <toast/assets/prefab.hpp>
 #include <toast/export.hpp>
@@ -22,6 +25,10 @@
 #include <unordered_set>
 #include <vector>
 
+namespace physics {
+class PhysicsScene;
+}
+
 namespace toast {
 class CameraController;
 class Camera;
@@ -37,8 +44,18 @@ public:
 	virtual ~INodeOwner() = default;
 	virtual auto name() -> std::string = 0;
 
+	/// One fixed simulation step; runs zero or more times per frame, see Time::setFixedRate
 	virtual void tick() = 0;
 
+	/// Once-per-frame work that must not repeat with the step count (queue drains, editor streaming)
+	virtual void frameTick() { }
+
+	/// Physics stage run between the tick and post_physics phases; null for owners that never simulate
+	[[nodiscard]]
+	virtual auto physicsScene() noexcept -> physics::PhysicsScene* {
+		return nullptr;
+	}
+
 	/// Determines if this owner is elegible for runtime systems
 	[[nodiscard]]
 	virtual auto participatesIn(NodeOwnerParticipation use) const noexcept -> bool = 0;
@@ -62,9 +79,17 @@ public:
 	void reloadScriptsUsing(UID script_uid) noexcept;
 	void refreshNodeInfos() noexcept;
 
+	/// Number of ControlBoxes held by this owner, including dead ones still referenced by a Box
+	[[nodiscard]]
+	auto nodeCount() const noexcept -> size_t {
+		return nodes.size();
+	}
+
 	struct InstantiateContext {
 		std::vector<uint64_t> asset_chain;    ///< UIDs of prefabs currently being instantiated; prevents infinite recursion
 		std::function<assets::Handle<assets::Prefab>(toast::UID)> resolver;    ///< injected loader so tests can swap in a fake
+		bool use_plans = true;    ///< instantiate through the prefab's cached InstantiationPlan; off forces the name-matching path
+		bool parallel = true;     ///< allocate large trees in batches on the ThreadPool; off runs every batch on the calling thread
 	};
 
 protected:
@@ -79,34 +104,51 @@ protected:
 	/// Appends " 2", " 3", etc. to base until the name is unique among the parent's existing children
 	static auto uniqueChildName(const Node& parent, std::string_view base) -> std::string;
 
+	/// Reserved ControlBox slot to construct into instead of taking nodes_mutex; see NodeSlots::reserve
+	struct SlotTarget {
+		_detail::NodeSlots::Reservation* reservation = nullptr;
+		size_t index = 0;
+	};
+
 	/**
-	 * @brief Allocates a Node and its ControlBox in one contiguous block
+	 * @brief Allocates a Node from its type's slab pool and a ControlBox slot in the owner
 	 * @param type Fully-qualified C++ class name looked up in NodeRegistry to find the factory;
 	 *             defaults to "toast::Node"
+	 * @param target Reserved slot to use; the node stays invisible to forEachNode until the reservation is committed
 	 * @return Owning Box<Node>; the node is in NodeState::null until explicitly placed in a tree
 	 */
-	auto nodeAllocation(std::string_view type = "toast::Node") noexcept -> Box<Node>;
+	auto nodeAllocation(std::string_view type = "toast::Node", SlotTarget target = {}) noexcept -> Box<Node>;
 
 	/**
 	 * @brief Allocates a Node and initializes its name and type from a prefab data record
 	 * @param node_data The BasicNode entry from the prefab file
+	 * @param plan Compiled stores for this entry; applyFields is used when null or when the type doesn't match
+	 * @param target Reserved slot to use instead of locking the owner
 	 * @return Owning Box<Node>; the node is in NodeState::null until explicitly placed in a tree
 	 */
-	auto nodeAllocation(const assets::Prefab::BasicNode& node_data) noexcept -> Box<Node>;
+	auto nodeAllocation(
+	    const assets::Prefab::BasicNode& node_data, const InstantiationPlan::NodePlan* plan = nullptr, SlotTarget target = {}
+	) noexcept -> Box<Node>;
 
 	/**
 	 * @brief Assembles a flat list of allocated nodes into a parent/child tree
 	 * @param nodes Flat list in prefab file order; index 0 becomes the tree root
 	 * @param file The source prefab, kept alive until all Handle fields are resolved
+	 * @param plan Compiled plan for file; supplies parent indices instead of matching m_parent UIDs
 	 * @return The root Box<Node>
 	 */
-	auto buildTree(std::vector<Box<Node>>&& nodes, const assets::Handle<assets::Prefab>& file) -> Box<Node>;
+	auto buildTree(
+	    std::vector<Box<Node>>&& nodes, const assets::Handle<assets::Prefab>& file, const InstantiationPlan* plan = nullptr
+	) -> Box<Node>;
 
 	/**
 	 * @brief Allocates and initializes a full node tree from a prefab asset
 	 *
-	 * Allocates every node, resolves embedded child prefabs recursively via ctx.resolver,
-	 * and calls pre_init and load on each node before returning
+	 * Resolves embedded child prefabs recursively via ctx.resolver on the calling thread, reserves
+	 * one ControlBox slot per prefab entry, then allocates the nodes (running load and pre_init) in
+	 * batches on the ThreadPool without touching the owner lock. Trees are assembled bottom-up and
+	 * every node is published to the owner in a single locked commit. Slot order only depends on
+	 * file order, so the result is identical with ctx.parallel on or off
 	 *
 	 * @param file The prefab to instantiate
 	 * @param ctx Resolver for child prefabs and the asset chain used for cycle detection;
@@ -123,12 +165,22 @@ protected:
 	 */
 	void applyLuaOverrides(Node& node, const assets::Prefab::BasicNode& data, const scripting::NodeResolver& find_node);
 
-	/// Marks the ControlBox as dead and increments tombstones; does not free memory
+	/// Marks the ControlBox as dead and queues it as a tombstone; does not free memory
 	void releaseNode(_detail::ControlBox& control) noexcept;
 
-	/// Sweeps the nodes set and erases any ControlBox whose ref count is zero; short-circuits if tombstones == 0
+	/// Frees every queued tombstone whose ref count is zero; the rest stay queued for the next reap
 	void reapTombstones() noexcept;
 
+	/**
+	 * @brief Detaches and frees a batch of nodes in one pass, then reaps their ControlBoxes
+	 *
+	 * Each node goes back through the Deleter it was constructed with, and the slab frees are
+	 * grouped per pool. Used for subtree removal, queued destruction and whole-owner teardown
+	 *
+	 * @param victims Every node to free; none of them may be reachable from a live tree
+	 */
+	void freeNodes(std::span<Node* const> victims) noexcept;
+
 	void findCamera();
 	void findCameraController();
 	void tickActiveCameraController();
@@ -142,18 +194,16 @@ protected:
 
 	template<typename Fn>
 	void forEachNode(Fn&& fn) const {
-		for (const auto& cb : nodes) {
-			fn(cb);
-		}
+		nodes.forEach([&fn](const _detail::ControlBox& cb) { fn(cb); });
 	}
 
 	std::mutex nodes_mutex;
-	size_t tombstones = 0;    ///< short-circuits the reap sweep when there's nothing to clean
+	std::vector<_detail::ControlBox*> tombstones;    ///< released ControlBoxes waiting for their last Box to drop
 
 private:
 	friend class CameraController;
 
-	std::unordered_set<_detail::ControlBox> nodes;
+	_detail::NodeSlots nodes;
 	Box<Camera> m_active_camera;
 	Box<CameraController> m_active_camera_controller;
 	bool m_has_camera_controller = false;
@@ -0,0 +1,116 @@
+#include "node_pool.hpp"
+
+#include <algorithm>
+#include <toast/memory_tracker.hpp>
+#include <tracy/Tracy.hpp>
+
+namespace toast::_detail {
+
+namespace {
+constexpr std::size_t pool_slab_bytes = 16 * 1024;
+constexpr std::size_t pool_min_per_slab = 16;
+
+thread_local NodePool::BulkRelease* t_bulk_release = nullptr;
+}
+
+NodePool::NodePool(std::size_t size, std::size_t align) noexcept
+    : m_align(std::max(align, alignof(FreeSlot))) {
+	// Every slot must be able to hold the free list link and keep the next slot aligned
+	m_stride = std::max(size, sizeof(FreeSlot));
+	m_stride = (m_stride + m_align - 1) / m_align * m_align;
+	m_per_slab = std::max(pool_min_per_slab, pool_slab_bytes / m_stride);
+}
+
+NodePool::~NodePool() {
+	if (m_live != 0) {
+		return;
+	}
+	for (void* slab : m_slabs) {
+		::operator delete(slab, std::align_val_t {m_align});
+	}
+}
+
+auto NodePool::allocate() -> void* {
+	std::scoped_lock lock(m_mutex);
+	if (m_free == nullptr) {
+		addSlab();
+	}
+	FreeSlot* slot = m_free;
+	m_free = slot->next;
+	m_live++;
+	MemoryTracker::allocated(MemoryTag::nodes, m_stride);
+	return slot;
+}
+
+void NodePool::deallocate(void* ptr) noexcept {
+	if (ptr == nullptr) {
+		return;
+	}
+	if (t_bulk_release != nullptr) {
+		t_bulk_release->m_pending.push_back({this, ptr});
+		return;
+	}
+	release(&ptr, 1);
+}
+
+auto NodePool::live() const noexcept -> std::size_t {
+	std::scoped_lock lock(m_mutex);
+	return m_live;
+}
+
+auto NodePool::capacity() const noexcept -> std::size_t {
+	std::scoped_lock lock(m_mutex);
+	return m_slabs.size() * m_per_slab;
+}
+
+void NodePool::addSlab() {
+	ZoneScopedN("NodePool::addSlab");
+	auto* slab = static_cast<std::byte*>(::operator new(m_stride * m_per_slab, std::align_val_t {m_align}));
+	m_slabs.push_back(slab);
+
+	// Thread the new slots so the lowest address is handed out first
+	for (std::size_t i = m_per_slab; i-- > 0;) {
+		auto* slot = reinterpret_cast<FreeSlot*>(slab + i * m_stride);
+		slot->next = m_free;
+		m_free = slot;
+	}
+}
+
+void NodePool::release(void* const* ptrs, std::size_t count) noexcept {
+	std::scoped_lock lock(m_mutex);
+	for (std::size_t i = 0; i < count; ++i) {
+		auto* slot = static_cast<FreeSlot*>(ptrs[i]);
+		slot->next = m_free;
+		m_free = slot;
+		MemoryTracker::freed(MemoryTag::nodes, m_stride);
+	}
+	m_live -= count;
+}
+
+NodePool::BulkRelease::BulkRelease() noexcept : m_previous(t_bulk_release) {
+	t_bulk_release = this;
+}
+
+NodePool::BulkRelease::~BulkRelease() {
+	t_bulk_release = m_previous;
+	if (m_pending.empty()) {
+		return;
+	}
+
+	ZoneScopedN("NodePool::BulkRelease");
+	std::ranges::stable_sort(m_pending, {}, &Entry::pool);
+
+	std::vector<void*> run;
+	for (std::size_t begin = 0; begin < m_pending.size();) {
+		NodePool* pool = m_pending[begin].pool;
+		run.clear();
+		std::size_t end = begin;
+		for (; end < m_pending.size() && m_pending[end].pool == pool; ++end) {
+			run.push_back(m_pending[end].ptr);
+		}
+		pool->release(run.data(), run.size());
+		begin = end;
+	}
+}
+
+}
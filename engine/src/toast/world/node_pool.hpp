@@ -0,0 +1,126 @@
+/**
+ * @file node_pool.hpp
+ * @author Xein
+ * @date 18 Oct 2026
+ *
+ * @brief Per-type slab allocator backing the generated NodeInfo Factory/Deleter
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <toast/export.hpp>
+#include <vector>
+
+namespace toast::_detail {
+
+/**
+ * @brief Fixed-size slab allocator for one node type
+ *
+ * Memory is carved from slabs of ~16KB and recycled through an intrusive free list, so spawning and
+ * unloading levels never hit the global heap (or the Tracy operator new hook) once the pool is warm.
+ * Slabs are only returned to the heap when the pool is destroyed with no live objects; a pool that
+ * still owns nodes at static destruction time leaks its slabs on purpose instead of pulling memory
+ * from under them. MemoryTag::nodes counts the slots handed out rather than the slabs, so the capacity
+ * a pool keeps after its nodes are gone doesn't show up as a leak.
+ *
+ * @note Thread-safe; nodes are constructed from loader threads as well as the main thread
+ */
+class TOAST_API NodePool {
+public:
+	NodePool(std::size_t size, std::size_t align) noexcept;
+	~NodePool();
+
+	NodePool(const NodePool&) = delete;
+	auto operator=(const NodePool&) -> NodePool& = delete;
+
+	/// Returns uninitialized storage for one object
+	[[nodiscard]]
+	auto allocate() -> void*;
+
+	/// Returns storage to the free list; deferred to the active BulkRelease on this thread if there is one
+	void deallocate(void* ptr) noexcept;
+
+	/// Number of objects currently handed out
+	[[nodiscard]]
+	auto live() const noexcept -> std::size_t;
+
+	/// Number of objects the pool can hold without allocating another slab
+	[[nodiscard]]
+	auto capacity() const noexcept -> std::size_t;
+
+	/**
+	 * @brief Batches every NodePool::deallocate on the current thread until it goes out of scope
+	 *
+	 * Used when a whole subtree or owner is torn down: the frees are grouped by pool and each pool
+	 * lock is taken once instead of once per node
+	 */
+	class TOAST_API BulkRelease {
+	public:
+		BulkRelease() noexcept;
+		~BulkRelease();
+
+		BulkRelease(const BulkRelease&) = delete;
+		auto operator=(const BulkRelease&) -> BulkRelease& = delete;
+
+	private:
+		struct Entry {
+			NodePool* pool;
+			void* ptr;
+		};
+
+		friend class NodePool;
+		std::vector<Entry> m_pending;
+		BulkRelease* m_previous = nullptr;
+	};
+
+private:
+	struct FreeSlot {
+		FreeSlot* next;
+	};
+
+	void addSlab();
+	void release(void* const* ptrs, std::size_t count) noexcept;
+
+	std::size_t m_stride;
+	std::size_t m_align;
+	std::size_t m_per_slab;
+
+	mutable std::mutex m_mutex;
+	FreeSlot* m_free = nullptr;
+	std::vector<void*> m_slabs;
+	std::size_t m_live = 0;
+};
+
+/// One pool per concrete node type, shared by every owner
+template<typename T>
+auto nodePool() -> NodePool& {
+	static NodePool pool(sizeof(T), alignof(T));
+	return pool;
+}
+
+/// Generated NodeInfo::construct body
+template<typename T>
+auto poolNew() -> T* {
+	void* mem = nodePool<T>().allocate();
+	try {
+		return ::new (mem) T();
+	} catch (...) {
+		nodePool<T>().deallocate(mem);
+		throw;
+	}
+}
+
+/// Generated NodeInfo::destroy body; obj must come from poolNew<T>()
+template<typename T>
+void poolDelete(T* obj) noexcept {
+	if (obj == nullptr) {
+		return;
+	}
+	obj->~T();
+	nodePool<T>().deallocate(obj);
+}
+
+}
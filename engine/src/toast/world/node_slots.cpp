@@ -0,0 +1,113 @@
+#include "node_slots.hpp"
+
+#include <algorithm>
+#include <functional>
+
+namespace toast::_detail {
+
+NodeSlots::~NodeSlots() {
+	clear();
+}
+
+auto NodeSlots::takeIndex() -> uint32_t {
+	if (not m_free.empty()) {
+		std::ranges::pop_heap(m_free, std::greater {});
+		uint32_t index = m_free.back();
+		m_free.pop_back();
+		return index;
+	}
+	if (m_end == m_chunks.size() * chunk_size) {
+		m_chunks.push_back(std::make_unique<Slot[]>(chunk_size));
+	}
+	return m_end++;
+}
+
+void NodeSlots::freeIndex(uint32_t index) {
+	if (m_live == 0 and m_reserved == 0) {
+		// Last node gone, start over from slot zero so iteration stays short
+		m_free.clear();
+		m_end = 0;
+		return;
+	}
+
+	// Min-heap so reuse packs the low slots first
+	m_free.push_back(index);
+	std::ranges::push_heap(m_free, std::greater {});
+}
+
+auto NodeSlots::emplace(Node* node, Deleter deleter) -> ControlBox& {
+	uint32_t index = takeIndex();
+	Slot& slot = m_chunks[index / chunk_size][index % chunk_size];
+	::new (slot.storage) ControlBox(node);
+	slot.deleter = deleter;
+	slot.index = index;
+	slot.live = true;
+	m_live++;
+	return *slot.box();
+}
+
+auto NodeSlots::reserve(std::size_t count) -> Reservation {
+	Reservation reservation;
+	reservation.m_slots.reserve(count);
+	for (std::size_t i = 0; i < count; ++i) {
+		uint32_t index = takeIndex();
+		Slot& slot = m_chunks[index / chunk_size][index % chunk_size];
+		slot.index = index;
+		reservation.m_slots.push_back(&slot);
+	}
+	m_reserved += count;
+	return reservation;
+}
+
+auto NodeSlots::Reservation::emplace(std::size_t i, Node* node, Deleter deleter) -> ControlBox& {
+	Slot& slot = *m_slots[i];
+	::new (slot.storage) ControlBox(node);
+	slot.deleter = deleter;
+	slot.filled = true;
+	return *slot.box();
+}
+
+void NodeSlots::commit(Reservation&& reservation) noexcept {
+	m_reserved -= reservation.m_slots.size();
+	for (Slot* slot : reservation.m_slots) {
+		if (slot->filled) {
+			slot->filled = false;
+			slot->live = true;
+			m_live++;
+		}
+	}
+	for (Slot* slot : reservation.m_slots) {
+		if (not slot->live) {
+			freeIndex(slot->index);
+		}
+	}
+	reservation.m_slots.clear();
+}
+
+void NodeSlots::erase(ControlBox& control) noexcept {
+	Slot* slot = slotOf(control);
+	slot->box()->~ControlBox();
+	slot->deleter = nullptr;
+	slot->live = false;
+	m_live--;
+	freeIndex(slot->index);
+}
+
+auto NodeSlots::deleterOf(const ControlBox& control) noexcept -> Deleter {
+	return slotOf(control)->deleter;
+}
+
+void NodeSlots::clear() noexcept {
+	forEach([](ControlBox& control) { control.~ControlBox(); });
+	m_chunks.clear();
+	m_free.clear();
+	m_end = 0;
+	m_live = 0;
+	m_reserved = 0;
+}
+
+auto NodeSlots::slotOf(const ControlBox& control) noexcept -> Slot* {
+	return reinterpret_cast<Slot*>(const_cast<ControlBox*>(&control));
+}
+
+}
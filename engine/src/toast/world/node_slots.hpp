@@ -0,0 +1,141 @@
+/**
+ * @file node_slots.hpp
+ * @author Xein
+ * @date 18 Oct 2026
+ *
+ * @brief Dense ControlBox registry owned by every INodeOwner
+ */
+
+#pragma once
+
+#include "control_box.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <toast/export.hpp>
+#include <vector>
+
+namespace toast {
+class Node;
+
+namespace _detail {
+
+/**
+ * @brief Chunked slot array of ControlBoxes with an index free list
+ *
+ * ControlBoxes can never move because Box handles hold raw pointers to them, so slots live in
+ * fixed-size chunks that are never reallocated. Freed slots are recycled lowest-index-first,
+ * iteration walks the chunks linearly, and each slot remembers the Deleter the node was
+ * constructed with so the node always goes back to the pool it came from, even after
+ * Node::refreshInfo swapped its NodeInfo.
+ *
+ * Bulk producers (prefab instantiation) reserve() a run of slots under the owner lock, fill them
+ * from any thread through the Reservation, and publish them with a single commit(). Reserved slots
+ * are skipped by forEach() until then.
+ *
+ * @note Not thread-safe; INodeOwner guards it with nodes_mutex. Reservation::emplace is the only
+ *       call that may run without it
+ */
+class TOAST_API NodeSlots {
+	struct Slot;
+
+public:
+	using Deleter = void (*)(Node*);
+
+	static constexpr uint32_t chunk_size = 256;
+
+	/**
+	 * @brief Slots handed out by reserve(), in index order
+	 *
+	 * Different positions may be filled concurrently from different threads; each position at most
+	 * once. Positions left empty go back to the free list on commit()
+	 */
+	class TOAST_API Reservation {
+	public:
+		Reservation() = default;
+
+		/// Constructs the ControlBox in reserved position i; invisible to forEach() until commit()
+		auto emplace(std::size_t i, Node* node, Deleter deleter) -> ControlBox&;
+
+		[[nodiscard]]
+		auto size() const noexcept -> std::size_t {
+			return m_slots.size();
+		}
+
+	private:
+		friend class NodeSlots;
+		std::vector<Slot*> m_slots;
+	};
+
+	NodeSlots() = default;
+	~NodeSlots();
+
+	NodeSlots(const NodeSlots&) = delete;
+	auto operator=(const NodeSlots&) -> NodeSlots& = delete;
+
+	/// Constructs a ControlBox for the node in the lowest free slot
+	auto emplace(Node* node, Deleter deleter) -> ControlBox&;
+
+	/// Takes count free slots, lowest index first, so the same owner state always yields the same slots
+	auto reserve(std::size_t count) -> Reservation;
+
+	/// Publishes every filled position of the reservation and frees the rest
+	void commit(Reservation&& reservation) noexcept;
+
+	/// Destroys the ControlBox and returns its slot to the free list
+	void erase(ControlBox& control) noexcept;
+
+	/// The Deleter recorded by emplace(); nullptr means the node was allocated with plain new
+	[[nodiscard]]
+	static auto deleterOf(const ControlBox& control) noexcept -> Deleter;
+
+	/// Drops every slot at once; only valid when no Box references any of them
+	void clear() noexcept;
+
+	/// Number of occupied slots, dead-but-referenced ControlBoxes included
+	[[nodiscard]]
+	auto size() const noexcept -> std::size_t {
+		return m_live;
+	}
+
+	template<typename Fn>
+	void forEach(Fn&& fn) const {
+		for (uint32_t i = 0; i < m_end; ++i) {
+			const Slot& slot = m_chunks[i / chunk_size][i % chunk_size];
+			if (slot.live) {
+				fn(*slot.box());
+			}
+		}
+	}
+
+private:
+	// storage must stay the first member: erase() recovers the Slot from the ControlBox address
+	struct Slot {
+		alignas(ControlBox) std::byte storage[sizeof(ControlBox)];
+		Deleter deleter = nullptr;
+		uint32_t index = 0;
+		bool live = false;
+		bool filled = false;    ///< reserved and constructed, waiting for commit()
+
+		[[nodiscard]]
+		auto box() const noexcept -> ControlBox* {
+			return std::launder(reinterpret_cast<ControlBox*>(const_cast<std::byte*>(storage)));
+		}
+	};
+
+	static auto slotOf(const ControlBox& control) noexcept -> Slot*;
+
+	auto takeIndex() -> uint32_t;
+	void freeIndex(uint32_t index);
+
+	std::vector<std::unique_ptr<Slot[]>> m_chunks;
+	std::vector<uint32_t> m_free;    ///< min-heap of free indices
+	uint32_t m_end = 0;              ///< one past the highest slot ever used
+	std::size_t m_live = 0;
+	std::size_t m_reserved = 0;      ///< slots handed out by reserve() and not committed yet
+};
+
+}
+}
@@ -0,0 +1,146 @@
+#include "owner_scheduler.hpp"
+
+#include "node_owner.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <future>
+#include <toast/log.hpp>
+#include <toast/thread_pool.hpp>
+#include <tracy/Tracy.hpp>
+
+namespace toast {
+
+void OwnerScheduler::addDependency(UID before, UID after) {
+	const std::pair edge {before, after};
+	if (std::ranges::find(m_edges, edge) == m_edges.end()) {
+		m_edges.push_back(edge);
+		m_dirty = true;
+	}
+}
+
+void OwnerScheduler::removeDependency(UID before, UID after) {
+	m_dirty |= std::erase(m_edges, std::pair {before, after}) > 0;
+}
+
+void OwnerScheduler::removeOwner(UID uid) {
+	m_dirty |= std::erase_if(m_edges, [uid](const auto& edge) { return edge.first == uid or edge.second == uid; }) > 0;
+}
+
+void OwnerScheduler::setParallel(bool value) noexcept {
+	m_parallel = value;
+}
+
+auto OwnerScheduler::waves() const noexcept -> const std::vector<std::vector<uint32_t>>& {
+	return m_waves;
+}
+
+void OwnerScheduler::computeWaves(std::span<const Entry> owners) {
+	ZoneScoped;
+
+	const auto count = static_cast<uint32_t>(owners.size());
+	auto index_of = [&owners](UID uid) -> uint32_t {
+		const auto it = std::ranges::find(owners, uid, &Entry::uid);
+		return static_cast<uint32_t>(it - owners.begin());
+	};
+
+	std::vector<std::vector<uint32_t>> successors(count);
+	std::vector<uint32_t> pending(count, 0);
+	for (const auto& [before, after] : m_edges) {
+		const uint32_t from = index_of(before);
+		const uint32_t to = index_of(after);
+		if (from == count or to == count or from == to) {
+			continue;
+		}
+		successors[from].push_back(to);
+		++pending[to];
+	}
+
+	m_waves.clear();
+	std::vector<uint32_t> ready;
+	for (uint32_t i = 0; i < count; ++i) {
+		if (pending[i] == 0) {
+			ready.push_back(i);
+		}
+	}
+
+	uint32_t scheduled = 0;
+	while (not ready.empty()) {
+		scheduled += static_cast<uint32_t>(ready.size());
+		std::vector<uint32_t> next;
+		for (const uint32_t i : ready) {
+			for (const uint32_t to : successors[i]) {
+				if (--pending[to] == 0) {
+					next.push_back(to);
+				}
+			}
+		}
+		std::ranges::sort(next);
+		m_waves.push_back(std::move(ready));
+		ready = std::move(next);
+	}
+
+	if (scheduled != count) {
+		TOAST_WARN("World", "Node owner dependencies contain a cycle; {} owners will tick one after another", count - scheduled);
+		for (uint32_t i = 0; i < count; ++i) {
+			if (pending[i] != 0) {
+				m_waves.push_back({i});
+			}
+		}
+	}
+
+	m_owners.resize(count);
+	std::ranges::transform(owners, m_owners.begin(), &Entry::uid);
+	m_dirty = false;
+}
+
+void OwnerScheduler::run(std::span<const Entry> owners, const std::function<void(INodeOwner&)>& fn) {
+	ZoneScoped;
+
+	if (m_dirty or not std::ranges::equal(owners, m_owners, {}, &Entry::uid)) {
+		computeWaves(owners);
+	}
+
+	std::vector<std::future<void>> futures;
+	for (const auto& wave : m_waves) {
+		if (not m_parallel or wave.size() == 1) {
+			for (const uint32_t i : wave) {
+				fn(*owners[i].owner);
+			}
+			continue;
+		}
+
+		// The calling thread takes the first owner of the wave instead of idling at the barrier
+		futures.clear();
+		for (size_t i = 1; i < wave.size(); ++i) {
+			futures.emplace_back(ThreadPool::push([&fn, owner = owners[wave[i]].owner] { fn(*owner); }));
+		}
+
+		std::exception_ptr error;
+		try {
+			fn(*owners[wave[0]].owner);
+		} catch (...) {
+			error = std::current_exception();
+		}
+
+		{
+			ZoneScopedN("Owner barrier");
+			for (auto& f : futures) {
+				ThreadPool::wait(f);
+				try {
+					f.get();
+				} catch (...) {
+					if (not error) {
+						error = std::current_exception();
+					}
+				}
+			}
+		}
+
+		if (error) {
+			std::rethrow_exception(error);
+		}
+	}
+}
+
+}
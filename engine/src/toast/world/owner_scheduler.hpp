@@ -0,0 +1,70 @@
+/**
+ * @file owner_scheduler.hpp
+ * @author Xein
+ * @date 18 Oct 2026
+ *
+ * @brief Runs independent node owners concurrently on the ThreadPool
+ */
+
+#pragma once
+#include <functional>
+#include <span>
+#include <toast/export.hpp>
+#include <toast/uid.hpp>
+#include <utility>
+#include <vector>
+
+namespace toast {
+class INodeOwner;
+
+/**
+ * @brief Schedules node owner ticks in waves, the same way TickScheduler does for nodes
+ *
+ * Owners never share nodes, so by default every World, Workspace and PlayWorkspace ticks
+ * in parallel. An explicit dependency makes one owner wait until another finished the same
+ * step, e.g. an additive world that reads the main world's transforms. run() only returns once
+ * every owner is done, which is the barrier before the application layer
+ *
+ * Dependency cycles are reported once and the owners in them fall back to running one after
+ * another in owner order
+ */
+class TOAST_API OwnerScheduler {
+public:
+	struct Entry {
+		UID uid;
+		INodeOwner* owner = nullptr;
+	};
+
+	/// after ticks only once before finished; edges naming owners that don't exist are kept but ignored
+	void addDependency(UID before, UID after);
+	void removeDependency(UID before, UID after);
+
+	/// Drops every edge touching uid; call when the owner is destroyed
+	void removeOwner(UID uid);
+
+	/// Off runs every owner on the calling thread in wave order
+	void setParallel(bool value) noexcept;
+
+	/**
+	 * @brief Calls fn once per owner and returns when every call finished
+	 * @param owners Owners to run in a stable order; the waves are cached while it doesn't change
+	 * @param fn Work for one owner; the first exception thrown is rethrown after the barrier
+	 */
+	void run(std::span<const Entry> owners, const std::function<void(INodeOwner&)>& fn);
+
+	/// Waves of the last run(), as indices into its owners; owners in one wave ran concurrently
+	[[nodiscard]]
+	auto waves() const noexcept -> const std::vector<std::vector<uint32_t>>&;
+
+private:
+	/// Kahn's algorithm over the owners present; anything left in a cycle gets a wave of its own
+	void computeWaves(std::span<const Entry> owners);
+
+	std::vector<std::pair<UID, UID>> m_edges;    ///< (before, after)
+	std::vector<UID> m_owners;                   ///< owners the cached waves were computed for
+	std::vector<std::vector<uint32_t>> m_waves;
+	bool m_dirty = true;
+	bool m_parallel = true;
+};
+
+}
@@ -5,6 +5,7 @@
 
 #include <toast/assets/assets.hpp>
 #include <toast/log.hpp>
+#include <toast/time.hpp>
 
 namespace toast {
 
@@ -84,13 +85,15 @@ void PlayWorkspace::tick() {
 		m_scheduler.runPhase(m_scheduler.schedule.early_tick, TickFunctionList::early_tick, "early_tick");
 		INodeOwner::updateTransforms(*m_root_node);
 		m_scheduler.runPhase(m_scheduler.schedule.tick, TickFunctionList::tick, "tick");
-		// TODO: physics step goes between tick and post_physics
+		m_physics.step(static_cast<float>(Time::delta()));
 		m_scheduler.runPhase(m_scheduler.schedule.post_physics, TickFunctionList::post_physics, "post_physics");
 		m_scheduler.runPhase(m_scheduler.schedule.late_tick, TickFunctionList::late_tick, "late_tick");
 	}
+}
 
+void PlayWorkspace::frameTick() {
 	if (isActiveWorkspace()) {
-		Workspace::tick();
+		Workspace::frameTick();
 	}
 }
 
@@ -11,6 +11,8 @@
 #include "tick_scheduler.hpp"
 #include "workspace.hpp"
 
+#include <toast/physics/physics_scene.hpp>
+
 namespace toast {
 /**
  * @brief A Workspace that actually runs game logic
@@ -32,12 +34,19 @@ public:
 	void unregisterDependency(Node& from, Node& to) override;
 
 	void tick() override;
+	void frameTick() override;
+
+	[[nodiscard]]
+	auto physicsScene() noexcept -> physics::PhysicsScene* override {
+		return &m_physics;
+	}
 
 	[[nodiscard]]
 	auto participatesIn(NodeOwnerParticipation use) const noexcept -> bool override;
 
 private:
 	TickScheduler m_scheduler;
+	physics::PhysicsScene m_physics;    ///< destroyed before ~Workspace disables the colliders, which then find no scene
 	bool m_paused = false;
 	bool m_schedule_dirty = true;
 	void computeSchedule();
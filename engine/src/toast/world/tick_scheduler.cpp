@@ -5,7 +5,10 @@
 #include <queue>
 #include <stack>
 #include <toast/log.hpp>
+#include <toast/physics/physics_scene.hpp>
+#include <toast/profiler.hpp>
 #include <toast/thread_pool.hpp>
+#include <toast/time.hpp>
 #include <unordered_set>
 
 namespace toast {
@@ -145,7 +148,7 @@ void TickScheduler::compute(const std::vector<Box<Node>>& all_nodes) {
 }
 
 void TickScheduler::runPhase(const std::vector<TickSchedule::Wave>& phase, TickFunctionList func, std::string_view name) const {
-	ZoneScopedN("TickScheduler::runPhase");    // NOLINT
+	TOAST_ZONE("TickScheduler::runPhase");    // NOLINT
 	ZoneNameF("TickScheduler::runPhase(%s)", name.data());
 
 	for (const auto& wave : phase) {
@@ -175,18 +178,21 @@ void TickScheduler::runPhase(const std::vector<TickSchedule::Wave>& phase, TickF
 		{
 			ZoneScopedN("Thread Pool semaphore");    // NOLINT
 			for (auto& f : futures) {
+				ThreadPool::wait(f);
 				f.get();
 			}
 		}
 	}
 }
 
-void TickScheduler::run() const {
+void TickScheduler::run(physics::PhysicsScene* physics) const {
 	ZoneScoped;
 
 	runPhase(schedule.early_tick, TickFunctionList::early_tick, "early_tick");
 	runPhase(schedule.tick, TickFunctionList::tick, "tick");
-	// TODO: physics step goes between tick and post_physics
+	if (physics) {
+		physics->step(static_cast<float>(Time::delta()));
+	}
 	runPhase(schedule.post_physics, TickFunctionList::post_physics, "post_physics");
 	runPhase(schedule.late_tick, TickFunctionList::late_tick, "late_tick");
 }
@@ -74,8 +74,8 @@ public:
 	 */
 	void compute(const std::vector<Box<Node>>& all_nodes);
 
-	/// Runs all four phases (early_tick → tick → post_physics → late_tick) of the schedule
-	void run() const;
+	/// Runs all four phases (early_tick → tick → physics → post_physics → late_tick) of the schedule
+	void run(physics::PhysicsScene* physics = nullptr) const;
 
 	/// Dispatches a single phase of the tick schedule
 	void runPhase(const std::vector<_detail::TickSchedule::Wave>& phase, TickFunctionList func, std::string_view name) const;
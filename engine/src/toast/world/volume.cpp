@@ -52,9 +52,20 @@ auto Volume::calculateWeight(const VolumeTarget& target) -> float {
 }
 
 auto Volume::closestPointOnBounds(vec3 point) -> vec3 {
-	vec3 position_local = inverse(getWorldTransform()) * vec4(point, 1.0f);
+	vec3 position_local = inverseWorldTransform() * vec4(point, 1.0f);
 	vec3 clamped_point = clamp(position_local, vec3(-.5f), vec3(.5f));
+	if (clamped_point == position_local) {
+		return point;    // Inside, no need to go back to world space
+	}
 	return getWorldTransform() * vec4(clamped_point, 1.0f);
 }
 
+auto Volume::inverseWorldTransform() -> const mat4& {
+	if (m_inverse_version != worldVersion()) {
+		m_inverse_world = inverse(getWorldTransform());
+		m_inverse_version = worldVersion();
+	}
+	return m_inverse_world;
+}
+
 }
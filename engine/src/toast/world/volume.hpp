@@ -56,6 +56,10 @@ protected:
 	[[nodiscard]]
 	auto closestPointOnBounds(glm::vec3 point) -> glm::vec3;
 
+	/// Maps world space into the volume's unit cube; recomputed only after the world transform changed
+	[[nodiscard]]
+	auto inverseWorldTransform() -> const glm::mat4&;
+
 private:
 	[[Reflect]]
 	bool m_is_global = false;
@@ -68,6 +72,9 @@ private:
 
 	[[Reflect, Unit("m")]]
 	float m_blend_distance = 0.0f;
+
+	glm::mat4 m_inverse_world = glm::mat4(1.0f);
+	uint64_t m_inverse_version = ~0ull;    ///< worldVersion() m_inverse_world was computed at
 };
 
 }
@@ -0,0 +1,187 @@
+#include "volume_index.hpp"
+
+#include <algorithm>
+#include <array>
+#include <numeric>
+#include <tracy/Tracy.hpp>
+
+namespace toast {
+
+namespace {
+
+auto boundsContain(const physics::Aabb& box, glm::vec3 point) noexcept -> bool {
+	return point.x >= box.min.x and point.x <= box.max.x and point.y >= box.min.y and point.y <= box.max.y and
+	       point.z >= box.min.z and point.z <= box.max.z;
+}
+
+// Median splits keep the tree balanced, so this covers far more boxes than fit in memory
+constexpr size_t bounds_tree_max_depth = 64;
+
+}
+
+void BoundsTree::build(std::span<const physics::Aabb> bounds) {
+	ZoneScoped;
+
+	const auto count = static_cast<uint32_t>(bounds.size());
+	m_nodes.clear();
+	m_indices.resize(count);
+	std::iota(m_indices.begin(), m_indices.end(), 0u);
+	if (count == 0) {
+		m_bounds.clear();
+		return;
+	}
+
+	m_nodes.reserve(2 * (count / leaf_size) + 1);
+	m_nodes.emplace_back();
+	buildNode(bounds, 0, 0, count);
+
+	m_bounds.resize(count);
+	for (uint32_t i = 0; i < count; ++i) {
+		m_bounds[i] = bounds[m_indices[i]];
+	}
+}
+
+void BoundsTree::buildNode(std::span<const physics::Aabb> bounds, uint32_t node, uint32_t begin, uint32_t end) {
+	physics::Aabb box = bounds[m_indices[begin]];
+	glm::vec3 centers_min = (box.min + box.max) * 0.5f;
+	glm::vec3 centers_max = centers_min;
+	for (uint32_t i = begin + 1; i < end; ++i) {
+		const physics::Aabb& other = bounds[m_indices[i]];
+		box.min = glm::min(box.min, other.min);
+		box.max = glm::max(box.max, other.max);
+		const glm::vec3 center = (other.min + other.max) * 0.5f;
+		centers_min = glm::min(centers_min, center);
+		centers_max = glm::max(centers_max, center);
+	}
+	m_nodes[node].bounds = box;
+
+	if (end - begin <= leaf_size) {
+		m_nodes[node].first = begin;
+		m_nodes[node].count = end - begin;
+		return;
+	}
+
+	const glm::vec3 spread = centers_max - centers_min;
+	const int axis = spread.x >= spread.y and spread.x >= spread.z ? 0 : (spread.y >= spread.z ? 1 : 2);
+	const uint32_t middle = begin + (end - begin) / 2;
+	std::nth_element(m_indices.begin() + begin, m_indices.begin() + middle, m_indices.begin() + end, [&](uint32_t a, uint32_t b) {
+		return bounds[a].min[axis] + bounds[a].max[axis] < bounds[b].min[axis] + bounds[b].max[axis];
+	});
+
+	const auto children = static_cast<uint32_t>(m_nodes.size());
+	m_nodes.emplace_back();
+	m_nodes.emplace_back();
+	m_nodes[node].first = children;
+	m_nodes[node].count = 0;
+	buildNode(bounds, children, begin, middle);
+	buildNode(bounds, children + 1, middle, end);
+}
+
+void BoundsTree::query(glm::vec3 point, std::vector<uint32_t>& hits) const {
+	if (m_nodes.empty()) {
+		return;
+	}
+
+	std::array<uint32_t, bounds_tree_max_depth + 1> stack;
+	size_t top = 0;
+	stack[top++] = 0;
+	while (top > 0) {
+		const TreeNode& node = m_nodes[stack[--top]];
+		if (not boundsContain(node.bounds, point)) {
+			continue;
+		}
+
+		if (node.count == 0) {
+			stack[top++] = node.first;
+			stack[top++] = node.first + 1;
+			continue;
+		}
+		for (uint32_t i = node.first; i < node.first + node.count; ++i) {
+			if (boundsContain(m_bounds[i], point)) {
+				hits.push_back(m_indices[i]);
+			}
+		}
+	}
+}
+
+void VolumeIndex::insert(Volume& volume) {
+	if (std::ranges::any_of(m_entries, [&volume](const Entry& entry) { return entry.pointer == &volume; })) {
+		return;
+	}
+
+	// Stays out of the tree until the next refresh() reads its bounds
+	m_entries.push_back({.volume = volume.box().as<Volume>(), .pointer = &volume});
+}
+
+void VolumeIndex::erase(const Volume& volume) {
+	if (std::erase_if(m_entries, [&volume](const Entry& entry) { return entry.pointer == &volume; }) > 0) {
+		rebuild();
+	}
+}
+
+void VolumeIndex::refresh() {
+	ZoneScoped;
+
+	bool changed = false;
+	for (Entry& entry : m_entries) {
+		const Volume& volume = *entry.pointer;
+		if (entry.version == volume.worldVersion() and entry.blend_distance == volume.blendDistance() and
+		    entry.global == volume.isGlobal()) {
+			continue;
+		}
+
+		entry.version = volume.worldVersion();
+		entry.blend_distance = volume.blendDistance();
+		entry.global = volume.isGlobal();
+		entry.bounds = worldBounds(volume.getWorldTransform(), entry.blend_distance);
+		changed = true;
+	}
+
+	if (changed) {
+		rebuild();
+	}
+}
+
+void VolumeIndex::rebuild() {
+	m_local.clear();
+	m_global.clear();
+	std::vector<physics::Aabb> bounds;
+	bounds.reserve(m_entries.size());
+	for (uint32_t i = 0; i < m_entries.size(); ++i) {
+		const Entry& entry = m_entries[i];
+		if (entry.version == ~0ull) {
+			continue;    // inserted since the last refresh()
+		}
+		if (entry.global) {
+			m_global.push_back(i);
+		} else {
+			m_local.push_back(i);
+			bounds.push_back(entry.bounds);
+		}
+	}
+	m_tree.build(bounds);
+}
+
+void VolumeIndex::query(glm::vec3 point, std::vector<Volume*>& out) const {
+	for (const uint32_t entry : m_global) {
+		out.push_back(m_entries[entry].pointer);
+	}
+
+	thread_local std::vector<uint32_t> hits;
+	hits.clear();
+	m_tree.query(point, hits);
+	for (const uint32_t hit : hits) {
+		out.push_back(m_entries[m_local[hit]].pointer);
+	}
+}
+
+auto VolumeIndex::worldBounds(const glm::mat4& world, float blend_distance) noexcept -> physics::Aabb {
+	// Half the unit cube's extent along each world axis is half the sum of the absolute basis components
+	const glm::vec3 center(world[3]);
+	const glm::vec3 extent =
+	    0.5f * (glm::abs(glm::vec3(world[0])) + glm::abs(glm::vec3(world[1])) + glm::abs(glm::vec3(world[2]))) +
+	    glm::vec3(std::max(blend_distance, 0.0f));
+	return {center - extent, center + extent};
+}
+
+}
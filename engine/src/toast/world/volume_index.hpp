@@ -0,0 +1,104 @@
+/**
+ * @file volume_index.hpp
+ * @author Xein
+ * @date 18 Oct 2026
+ *
+ * @brief Bounding volume hierarchy that finds the volumes weighing on a point
+ */
+
+#pragma once
+#include "volume.hpp"
+
+#include <cstdint>
+#include <glm/glm.hpp>
+#include <span>
+#include <toast/export.hpp>
+#include <toast/physics/broadphase.hpp>
+#include <vector>
+
+namespace toast {
+
+/**
+ * @brief Static tree over bounding boxes, answering which boxes contain a point
+ *
+ * Built top-down by splitting every node at the median center along its widest axis, so a query
+ * visits O(log n) nodes plus the boxes that actually contain the point. Building is O(n log n);
+ * rebuild whenever a box changes rather than refitting, since volumes rarely move
+ */
+class TOAST_API BoundsTree {
+public:
+	static constexpr uint32_t leaf_size = 4;
+
+	/// @param bounds Indices into this span are what query() reports
+	void build(std::span<const physics::Aabb> bounds);
+
+	/// @brief Appends the index of every box containing @p point, in no particular order
+	void query(glm::vec3 point, std::vector<uint32_t>& hits) const;
+
+	[[nodiscard]]
+	auto size() const noexcept -> size_t {
+		return m_indices.size();
+	}
+
+private:
+	/// Leaves own m_indices[first, first + count); inner nodes have count 0 and children at first, first + 1
+	struct TreeNode {
+		physics::Aabb bounds;
+		uint32_t first = 0;
+		uint32_t count = 0;
+	};
+
+	void buildNode(std::span<const physics::Aabb> bounds, uint32_t node, uint32_t begin, uint32_t end);
+
+	std::vector<TreeNode> m_nodes;
+	std::vector<uint32_t> m_indices;
+	std::vector<physics::Aabb> m_bounds;    ///< copy of the boxes, in m_indices order, so leaves test contiguous memory
+};
+
+/**
+ * @brief Every Volume of a system, indexed by its world bounds grown by its blend distance
+ *
+ * Global volumes skip the tree and come back from every query. refresh() only re-reads the
+ * volumes whose world transform, blend distance or global flag changed since the last call, and
+ * only rebuilds the tree when one did
+ */
+class TOAST_API VolumeIndex {
+public:
+	void insert(Volume& volume);
+	void erase(const Volume& volume);
+
+	/// @note Reads every volume's transform; call where none of them is being moved
+	void refresh();
+
+	/// @brief Appends the volumes that may give @p point a non-zero weight, as of the last refresh()
+	void query(glm::vec3 point, std::vector<Volume*>& out) const;
+
+	[[nodiscard]]
+	auto size() const noexcept -> size_t {
+		return m_entries.size();
+	}
+
+	/// World-space box around the unit cube under @p world, grown by @p blend_distance on every side
+	[[nodiscard]]
+	static auto worldBounds(const glm::mat4& world, float blend_distance) noexcept -> physics::Aabb;
+
+private:
+	struct Entry {
+		Box<Volume> volume;
+		Volume* pointer = nullptr;    ///< what queries return, without going through the Box
+		physics::Aabb bounds;
+		uint64_t version = ~0ull;    ///< Node3D::worldVersion() the bounds were read at
+		float blend_distance = 0.0f;
+		bool global = false;
+	};
+
+	/// Regroups the entries and rebuilds the tree from the bounds they already have
+	void rebuild();
+
+	std::vector<Entry> m_entries;
+	std::vector<uint32_t> m_local;    ///< entries in the tree, by tree index
+	std::vector<uint32_t> m_global;
+	BoundsTree m_tree;
+};
+
+}
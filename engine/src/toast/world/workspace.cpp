@@ -14,6 +14,7 @@
 #include <limits>
 #include <memory>
 #include <sstream>
+#include <string>
 #include <toast/assets/asset_manager.hpp>
 #include <toast/assets/assets.hpp>
 #include <toast/assets/prefab.hpp>
@@ -25,6 +26,8 @@
 #include <toast/scripting/lua_value_codec.hpp>
 #include <toast/scripting/script_runtime.hpp>
 #include <toast/time.hpp>
+#include <type_traits>
+#include <vector>
 
 namespace toast {
 
@@ -42,6 +45,122 @@ using scripting::stringifyLuaValue;
 
 static std::unique_ptr<assets::Prefab> s_clipboard;
 
+/// FNV-1a, chained through seed so several buffers fold into one fingerprint
+static auto inspectorHash(const void* data, size_t size, uint64_t seed = 0xcbf29ce484222325ull) -> uint64_t {
+	const auto* bytes = static_cast<const uint8_t*>(data);
+	for (size_t i = 0; i < size; ++i) {
+		seed ^= bytes[i];
+		seed *= 0x100000001b3ull;
+	}
+	return seed;
+}
+
+/// Hashes the member's bytes in place when it is a T or a std::vector<T>
+template<typename T>
+static auto inspectorRawHash(const FieldInfo& field, const Node* node, uint64_t& out) -> bool {
+	if (const T* value = field.typed<T>(node)) {
+		out = inspectorHash(value, sizeof(T));
+		return true;
+	}
+	if constexpr (not std::is_same_v<T, bool>) {
+		if (const auto* values = field.typed<std::vector<T>>(node)) {
+			out = inspectorHash(values->data(), values->size() * sizeof(T));
+			return true;
+		}
+	}
+	return false;
+}
+
+/// The text the inspector shows for a field, as InspectorContent and NodeChangeParam carry it
+static auto inspectorText(const FieldInfo& field, Node* node) -> std::string {
+	if (const auto* rotation = field.typed<glm::quat>(node)) {
+		// rotation is exchanged with the inspector as euler degrees, not as a raw quaternion
+		glm::vec3 deg = glm::degrees(glm::eulerAngles(*rotation));
+		return std::format("{} {} {}", deg.x, deg.y, deg.z);
+	}
+	if (field.value_type == FieldType::uid_t && not field.is_array) {
+		std::any value = field.get(node);
+		if (auto* box = std::any_cast<Box<Node>>(&value); box != nullptr) {
+			return box->exists() ? (*box)->uid().get() : "";
+		}
+		if (auto* id = std::any_cast<UID>(&value); id != nullptr) {
+			return id->data() != 0 ? id->get() : "";
+		}
+		return "";
+	}
+	try {
+		return assets::Prefab::stringifyValue(field.value_type, field.is_array, field.get(node));
+	} catch (const std::bad_any_cast&) { return ""; }
+}
+
+/**
+ * @brief Cheap stand-in for a field's value, used to tell whether the inspector needs it again
+ *
+ * Plain members are hashed straight from their bytes; anything the generator can't hand out typed
+ * (Box<Derived>, enums, containers of those) falls back to hashing its inspector text
+ */
+static auto inspectorFingerprint(const FieldInfo& field, Node* node) -> uint64_t {
+	uint64_t hash = 0;
+	if (inspectorRawHash<bool>(field, node, hash) || inspectorRawHash<int>(field, node, hash) ||
+	    inspectorRawHash<unsigned int>(field, node, hash) || inspectorRawHash<int64_t>(field, node, hash) ||
+	    inspectorRawHash<uint64_t>(field, node, hash) || inspectorRawHash<float>(field, node, hash) ||
+	    inspectorRawHash<double>(field, node, hash) || inspectorRawHash<glm::vec2>(field, node, hash) ||
+	    inspectorRawHash<glm::vec3>(field, node, hash) || inspectorRawHash<glm::vec4>(field, node, hash) ||
+	    inspectorRawHash<glm::quat>(field, node, hash)) {
+		return hash;
+	}
+	if (const auto* text = field.typed<std::string>(node)) {
+		return inspectorHash(text->data(), text->size());
+	}
+	if (const auto* id = field.typed<UID>(node)) {
+		const uint64_t data = id->data();
+		return inspectorHash(&data, sizeof(data));
+	}
+	const std::string text = inspectorText(field, node);
+	return inspectorHash(text.data(), text.size());
+}
+
+/// A changed field as InspectorDelta sends it; typed where the member allows, text otherwise
+static auto inspectorValue(const FieldInfo& field, Node* node) -> event::InspectorDelta::Value {
+	if (not field.is_array) {
+		if (const auto* v = field.typed<bool>(node)) {
+			return *v;
+		}
+		if (const auto* v = field.typed<int>(node)) {
+			return int64_t {*v};
+		}
+		if (const auto* v = field.typed<unsigned int>(node)) {
+			return int64_t {*v};
+		}
+		if (const auto* v = field.typed<int64_t>(node)) {
+			return *v;
+		}
+		if (const auto* v = field.typed<float>(node)) {
+			return double {*v};
+		}
+		if (const auto* v = field.typed<double>(node)) {
+			return *v;
+		}
+		if (const auto* v = field.typed<std::string>(node)) {
+			return *v;
+		}
+		if (const auto* v = field.typed<glm::vec2>(node)) {
+			return std::vector<float> {v->x, v->y};
+		}
+		if (const auto* v = field.typed<glm::vec3>(node)) {
+			return std::vector<float> {v->x, v->y, v->z};
+		}
+		if (const auto* v = field.typed<glm::vec4>(node)) {
+			return std::vector<float> {v->x, v->y, v->z, v->w};
+		}
+		if (const auto* v = field.typed<glm::quat>(node)) {
+			const glm::vec3 deg = glm::degrees(glm::eulerAngles(*v));
+			return std::vector<float> {deg.x, deg.y, deg.z};
+		}
+	}
+	return inspectorText(field, node);
+}
+
 Workspace::Workspace(UID handle, EmptyTag) : m_handle(handle) {
 	m_editor_camera = std::make_unique<Camera>();
 	m_editor_camera->position = {0.0f, -10.0f, 10.0f};
@@ -176,20 +295,7 @@ Workspace::~Workspace() {
 	m_root_node = {};
 	m_focused_node = {};
 
-	for (Node* victim : victims) {
-		_detail::ControlBox* control = _detail::ControlBox::get(victim);
-		const NodeInfo* info = victim->info();
-		victim->m_parent = {};
-		victim->m_children.clear();
-		victim->m_listener.reset();
-		if (info && info->destroy) {
-			info->destroy(victim);
-		} else {
-			delete victim;
-		}
-		releaseNode(*control);
-	}
-	reapTombstones();
+	freeNodes(victims);
 }
 
 auto Workspace::name() -> std::string {
@@ -256,19 +362,30 @@ auto Workspace::searchFrom(const Node& origin, std::string_view query) -> std::v
 }
 
 void Workspace::eventSubscriptions() {
-	// Whenever we get notified that the hierarchy needs an update, send the update back to the editor
+	// Whenever we get notified that the hierarchy needs an update, send the editor what changed since the last one
 	m_listener.subscribe<event::RequestHierarchyUpdate>(
 	    [this] {
 		    if (m_handle.data() != Engine::get()->activeWorkspace().data()) {
 			    return false;
 		    }
 
-		    event::send<event::UpdateHierarchyData>(m_root_node);
+		    sendHierarchyUpdate();
 		    return true;
 	    },
 	    100
 	);
 
+	// The editor missed a diff or its checksum disagrees; start it over from a full tree
+	m_listener.subscribe<event::RequestHierarchySnapshot>([this] {
+		if (m_handle.data() != Engine::get()->activeWorkspace().data()) {
+			return false;
+		}
+
+		m_hierarchy.reset();
+		sendHierarchyUpdate();
+		return true;
+	});
+
 	m_listener.subscribe<event::WorkspaceCreateNode>([this](const auto& e) {
 		if (m_handle.data() != Engine::get()->activeWorkspace().data()) {
 			return false;
@@ -317,22 +434,7 @@ void Workspace::eventSubscriptions() {
 		node = {};    // drop our own reference; nothing external holds the subtree now
 
 		// Free every node in place
-		for (Node* victim : victims) {
-			_detail::ControlBox* control = _detail::ControlBox::get(victim);
-			const NodeInfo* info = victim->info();
-
-			victim->m_parent = {};
-			victim->m_children.clear();
-			victim->m_listener.reset();
-
-			if (info && info->destroy) {
-				info->destroy(victim);
-			} else {
-				delete victim;
-			}
-			releaseNode(*control);
-		}
-		reapTombstones();
+		freeNodes(victims);
 
 		event::send<event::RequestHierarchyUpdate>();
 		TOAST_INFO("World", "Removed node {} in Workspace {}", name, m_root_node->name());
@@ -438,7 +540,16 @@ void Workspace::eventSubscriptions() {
 		if (!m_root_node.exists()) {
 			return false;
 		}
-		m_focused_node = findFrom(m_root_node, e.node);
+		focusNode(e.node);
+		return false;
+	});
+
+	// The editor rebuilt its inspector and lost track of the values; start over with a full InspectorContent
+	m_listener.subscribe<event::RequestInspectorContent>([this] {
+		if (m_handle.data() != Engine::get()->activeWorkspace().data()) {
+			return false;
+		}
+		restartInspector();
 		return false;
 	});
 
@@ -703,19 +814,8 @@ void Workspace::eventSubscriptions() {
 
 		// Destroy the old node using the same pattern as WorkspaceRemoveNode
 		Node* old_raw = &*target;
-		_detail::ControlBox* old_ctrl = _detail::ControlBox::get(old_raw);
-		const NodeInfo* old_info = old_raw->info();
-		old_raw->m_parent = {};
-		old_raw->m_listener.reset();
 		target = {};
-
-		if (old_info && old_info->destroy) {
-			old_info->destroy(old_raw);
-		} else {
-			delete old_raw;
-		}
-		releaseNode(*old_ctrl);
-		reapTombstones();
+		freeNodes({&old_raw, 1});
 
 		// Initialize the fresh node
 		fresh->callTick(fresh->info(), TickFunctionList::init);
@@ -764,20 +864,7 @@ void Workspace::eventSubscriptions() {
 		collect(*target);
 		target = {};
 
-		for (Node* victim : victims) {
-			_detail::ControlBox* ctrl = _detail::ControlBox::get(victim);
-			const NodeInfo* info = victim->info();
-			victim->m_parent = {};
-			victim->m_children.clear();
-			victim->m_listener.reset();
-			if (info && info->destroy) {
-				info->destroy(victim);
-			} else {
-				delete victim;
-			}
-			releaseNode(*ctrl);
-		}
-		reapTombstones();
+		freeNodes(victims);
 
 		// Spawn the saved file as a prefab child of the same parent
 		auto uid = assets::resolveURI(e.path);
@@ -835,6 +922,7 @@ void Workspace::eventSubscriptions() {
 	m_listener.subscribe<event::SetActiveWorkspace>([this](const auto& e) {
 		if (e.handle == m_handle.data()) {
 			applyActiveCamera();
+			m_hierarchy.reset();    // the editor was showing another workspace's tree
 		}
 		return false;
 	});
@@ -899,7 +987,38 @@ void Workspace::eventSubscriptions() {
 	});
 }
 
-void Workspace::tick() {
+void Workspace::sendHierarchyUpdate() {
+	ZoneScoped;
+
+	const bool snapshot = m_hierarchy.needsSnapshot();
+	m_hierarchy.begin();
+	if (m_root_node.exists()) {
+		auto visit = [this](this auto&& self, const Node& node, const UID& parent, uint32_t index) -> void {
+			m_hierarchy.visit(
+			    node.uid(), parent, index, node.name(), node.info()->type, node.enabled(), node.type() == NodeType::root
+			);
+			const auto& children = node.children();
+			for (uint32_t i = 0; i < children.size(); ++i) {
+				self(*children[i], node.uid(), i);
+			}
+		};
+		visit(*m_root_node, UID(), 0);
+	}
+	std::vector<HierarchyChange> changes = m_hierarchy.end();
+
+	// Hashing the whole mirror costs about as much as the walk, so only every few batches carry a checksum
+	const uint64_t sequence = m_hierarchy.sequence();
+	const bool checkpoint = snapshot or sequence % hierarchy_checksum_interval == 0;
+	const uint64_t checksum = checkpoint ? m_hierarchy.mirror().checksum() : 0;
+
+	if (snapshot) {
+		event::send<event::UpdateHierarchyData>(m_root_node, sequence, checksum);
+	} else if (not changes.empty()) {
+		event::send<event::HierarchyDiff>(sequence, checksum, std::move(changes));
+	}
+}
+
+void Workspace::frameTick() {
 	if (!participatesIn(NodeOwnerParticipation::gameplay_tick)) {
 		tickActiveCameraController();
 	}
@@ -911,47 +1030,69 @@ void Workspace::tick() {
 	// Only the active workspace streams inspector data, and only while a node is focused
 	if (m_handle.data() != Engine::get()->activeWorkspace().data() || not m_focused_node.exists()) {
 		m_inspector_accum = 0.0;
+		m_inspector_stream = {};
 		return;
 	}
 
-	// Throttle to 12 fps instead of pushing the whole field set every frame
+	// Throttle to 12 fps instead of fingerprinting the whole field set every frame
 	m_inspector_accum += Time::delta();
 	if (m_inspector_accum < 1.0 / 12.0) {
 		return;
 	}
 	m_inspector_accum = 0.0;
 
-	std::vector<event::InspectorContent::InspectorField> fields;
+	streamInspector();
+}
+
+void Workspace::focusNode(const UID& node) {
+	m_focused_node = findFrom(m_root_node, node);
+	m_inspector_stream = {};
+}
+
+void Workspace::restartInspector() {
+	m_inspector_stream = {};
+}
+
+void Workspace::streamInspector() {
 	Node* node = &*m_focused_node;
+	InspectorStream& stream = m_inspector_stream;
+	const bool full = stream.node != node->uid().data() or stream.info != node->info();
+	if (full) {
+		stream = {.node = node->uid().data(), .info = node->info()};
+	}
 
+	// Fingerprinting a field is far cheaper than formatting it, so only the ones that moved get read
+	std::vector<const FieldInfo*> all_fields;
+	std::vector<event::InspectorDelta::FieldDelta> changed;
+	uint32_t index = 0;
 	for (const NodeInfo* type = node->info(); type != nullptr; type = type->base_type) {
 		for (const auto& field : type->all_fields) {
-			std::any value = field.get(node);
-
-			std::string text;
-			if (field.value_type == FieldType::quaternion_t && not field.is_array) {
-				// rotation is exchanged with the inspector as euler degrees, not as a raw quaternion
-				glm::vec3 deg = glm::degrees(glm::eulerAngles(std::any_cast<glm::quat>(value)));
-				text = std::format("{} {} {}", deg.x, deg.y, deg.z);
-			} else if (field.value_type == FieldType::uid_t && not field.is_array) {
-				if (auto* box = std::any_cast<Box<Node>>(&value); box != nullptr) {
-					text = box->exists() ? (*box)->uid().get() : "";
-				} else if (auto* id = std::any_cast<UID>(&value); id != nullptr) {
-					text = id->data() != 0 ? id->get() : "";
-				}
-			} else {
-				try {
-					text = assets::Prefab::stringifyValue(field.value_type, field.is_array, value);
-				} catch (const std::bad_any_cast&) { text = ""; }
+			const uint64_t fingerprint = inspectorFingerprint(field, node);
+			if (full) {
+				stream.fields.push_back(fingerprint);
+				all_fields.push_back(&field);
+			} else if (stream.fields[index] != fingerprint) {
+				stream.fields[index] = fingerprint;
+				changed.emplace_back(index, inspectorValue(field, node));
 			}
-
-			fields.emplace_back(field.name, text);
+			++index;
 		}
 	}
 
-	event::send<event::InspectorContent>(
-	    m_focused_node->uid().get(), m_focused_node->name(), m_focused_node->enabled(), std::move(fields)
-	);
+	const bool renamed = stream.name != node->name() or stream.enabled != node->enabled();
+	stream.name = node->name();
+	stream.enabled = node->enabled();
+
+	if (full) {
+		std::vector<event::InspectorContent::InspectorField> fields;
+		fields.reserve(all_fields.size());
+		for (const FieldInfo* field : all_fields) {
+			fields.emplace_back(field->name, inspectorText(*field, node));
+		}
+		event::send<event::InspectorContent>(node->uid().get(), node->name(), node->enabled(), std::move(fields));
+	} else if (renamed or not changed.empty()) {
+		event::send<event::InspectorDelta>(node->uid().get(), node->name(), node->enabled(), std::move(changed));
+	}
 
 	// The exported script variables travel in their own message so the editor can rebuild
 	// its Lua cards independently of the reflected C++ structure
@@ -1005,7 +1146,29 @@ void Workspace::tick() {
 		}
 	}
 
-	event::send<event::InspectorLuaContent>(m_focused_node->uid().get(), lua_schema_version, std::move(cards));
+	// Script variables only go out again when one of them or the schema changed
+	uint64_t lua = inspectorHash(&lua_schema_version, sizeof(lua_schema_version));
+	auto hash_lua_fields = [&lua](const std::vector<event::InspectorLuaContent::LuaField>& fields) {
+		for (const auto& f : fields) {
+			lua = inspectorHash(f.path.data(), f.path.size(), lua);
+			lua = inspectorHash(f.value.data(), f.value.size(), lua);
+		}
+	};
+	for (const auto& card : cards) {
+		lua = inspectorHash(card.script.data(), card.script.size(), lua);
+		hash_lua_fields(card.fields);
+		for (const auto& group : card.groups) {
+			hash_lua_fields(group.fields);
+			for (const auto& sub : group.subgroups) {
+				hash_lua_fields(sub.fields);
+			}
+		}
+	}
+
+	if (full or lua != stream.lua) {
+		stream.lua = lua;
+		event::send<event::InspectorLuaContent>(node->uid().get(), lua_schema_version, std::move(cards));
+	}
 }
 
 }
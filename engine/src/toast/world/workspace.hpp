@@ -10,10 +10,14 @@
 
 #pragma once
 
+#include "hierarchy_journal.hpp"
 #include "node_owner.hpp"
 
+#include <cstdint>
 #include <memory>
+#include <string>
 #include <toast/events/listener.hpp>
+#include <vector>
 
 namespace toast {
 /**
@@ -114,17 +118,50 @@ protected:
 	void applyActiveCamera() override;
 
 private:
+	/// What the editor last got for the focused node, so frameTick only streams what changed
+	struct InspectorStream {
+		uint64_t node = 0;
+		const NodeInfo* info = nullptr;
+		std::vector<uint64_t> fields;    ///< fingerprint of each reflected field, in the order InspectorContent lists them
+		std::string name;
+		bool enabled = false;
+		uint64_t lua = 0;                ///< fingerprint of the script variables and their schema
+	};
+
+	/// Every this many diffs the editor gets a checksum to verify its copy of the tree against
+	static constexpr uint64_t hierarchy_checksum_interval = 16;
+
+	/// Answers RequestHierarchyUpdate: a full UpdateHierarchyData after a reset, a HierarchyDiff otherwise
+	void sendHierarchyUpdate();
+
+	/// Answers SetFocusedNode; the next stream starts over with a full InspectorContent
+	void focusNode(const UID& node);
+
+	/// Answers RequestInspectorContent by forgetting what the editor was sent
+	void restartInspector();
+
+	/// The part of frameTick() past the active-workspace check and the throttle
+	void streamInspector();
+
 	double m_inspector_accum = 0.0;
+	InspectorStream m_inspector_stream;
+	HierarchyJournal m_hierarchy;    ///< what the editor's hierarchy panel holds for this workspace
+
+	friend struct toast::_detail::WorldTestAccess;
 
 public:
+	/// Workspace nodes are never ticked for game logic, so an editor workspace has no simulation step
+	void tick() override { }
+
 	/**
 	 * @brief Streams the focused node's reflected values to the editor at a fixed rate
 	 *
-	 * Workspace nodes are never ticked for game logic; this override only throttles and emits
-	 * InspectorContent for the active workspace's focused node. It is a no-op when this workspace
-	 * is not the active one or when no node is focused.
+	 * Emits InspectorContent for the active workspace's focused node when it gets focused or the editor
+	 * asks for it, and afterwards an InspectorDelta with only the fields whose bytes changed; nothing
+	 * goes out while the node is idle. It is a no-op when this workspace is not the active one or when
+	 * no node is focused.
 	 */
-	void tick() override;
+	void frameTick() override;
 
 	[[nodiscard]]
 	auto rootNode() const -> const Node& {
@@ -5,6 +5,8 @@
 #include <toast/assets/assets.hpp>
 #include <toast/events/proto_event.hpp>
 #include <toast/world/node.hpp>
+#include <type_traits>
+#include <variant>
 
 namespace event {
 
@@ -30,7 +32,9 @@ UpdateHierarchyData::HierarchyElement::HierarchyElement(const HierarchyElement&
 	is_prefab = other.is_prefab;
 }
 
-UpdateHierarchyData::UpdateHierarchyData(const toast::Box<toast::Node>& node) {
+UpdateHierarchyData::UpdateHierarchyData(const toast::Box<toast::Node>& node, uint64_t sequence, uint64_t checksum)
+    : sequence(sequence),
+      checksum(checksum) {
 	if (node.exists()) {
 		root = HierarchyElement(node);
 	} else {
@@ -80,17 +84,81 @@ struct ProtoTraits<UpdateHierarchyData> {
 	static auto toProto(const Event& e) -> Proto {
 		Proto p;
 		p.set_is_empty(e.is_empty);
+		p.set_sequence(e.sequence);
+		p.set_checksum(e.checksum);
 		*p.mutable_root() = ProtoTraits<UpdateHierarchyData::HierarchyElement>::toProto(e.root);
 		return p;
 	}
 
 	static auto fromProto(const Proto& p) -> Event {
-		return {ProtoTraits<UpdateHierarchyData::HierarchyElement>::fromProto(p.root()), p.is_empty()};
+		return {ProtoTraits<UpdateHierarchyData::HierarchyElement>::fromProto(p.root()), p.is_empty(), p.sequence(), p.checksum()};
 	}
 };
 
 TOAST_PROTO_EVENT(UpdateHierarchyData);
 
+template<>
+struct ProtoTraits<toast::HierarchyChange> {
+	using Proto = proto::events::HierarchyChange;
+	using Event = toast::HierarchyChange;
+
+	static auto toProto(const Event& e) -> Proto {
+		Proto p;
+		p.set_kind(static_cast<proto::events::HierarchyChange::Kind>(e.kind));
+		p.set_uid(e.uid);
+		if (e.parent.data() != 0) {
+			p.set_parent(e.parent);
+		}
+		p.set_index(e.index);
+		p.set_name(e.name);
+		p.set_type(e.type);
+		p.set_enabled(e.enabled);
+		p.set_is_prefab(e.is_prefab);
+		return p;
+	}
+
+	static auto fromProto(const Proto& p) -> Event {
+		Event e;
+		e.kind = static_cast<toast::HierarchyChange::Kind>(p.kind());
+		e.uid = toast::UID::fromString(p.uid());
+		e.parent = p.parent().empty() ? 0 : toast::UID::fromString(p.parent());
+		e.index = p.index();
+		e.name = p.name();
+		e.type = p.type();
+		e.enabled = p.enabled();
+		e.is_prefab = p.is_prefab();
+		return e;
+	}
+};
+
+template<>
+struct ProtoTraits<HierarchyDiff> {
+	using Proto = proto::events::HierarchyDiff;
+	using Event = HierarchyDiff;
+
+	static auto toProto(const Event& e) -> Proto {
+		Proto p;
+		p.set_sequence(e.sequence);
+		p.set_checksum(e.checksum);
+		p.mutable_changes()->Reserve(static_cast<int>(e.changes.size()));
+		for (const auto& c : e.changes) {
+			*p.add_changes() = ProtoTraits<toast::HierarchyChange>::toProto(c);
+		}
+		return p;
+	}
+
+	static auto fromProto(const Proto& p) -> Event {
+		std::vector<toast::HierarchyChange> changes;
+		changes.reserve(p.changes_size());
+		for (const auto& c : p.changes()) {
+			changes.emplace_back(ProtoTraits<toast::HierarchyChange>::fromProto(c));
+		}
+		return {p.sequence(), p.checksum(), std::move(changes)};
+	}
+};
+
+TOAST_PROTO_EVENT(HierarchyDiff);
+
 template<>
 struct ProtoTraits<RequestHierarchyUpdate> {
 	using Proto = proto::events::RequestHierarchyUpdate;
@@ -103,6 +171,18 @@ struct ProtoTraits<RequestHierarchyUpdate> {
 
 TOAST_PROTO_EVENT(RequestHierarchyUpdate);
 
+template<>
+struct ProtoTraits<RequestHierarchySnapshot> {
+	using Proto = proto::events::RequestHierarchySnapshot;
+	using Event = RequestHierarchySnapshot;
+
+	static auto toProto(const Event& e) -> Proto { return {}; }
+
+	static auto fromProto(const Proto& p) -> Event { return {}; }
+};
+
+TOAST_PROTO_EVENT(RequestHierarchySnapshot);
+
 template<>
 struct ProtoTraits<ReloadAssetsManifest> {
 	using Proto = proto::events::ReloadAssetsManifest;
@@ -512,6 +592,87 @@ struct ProtoTraits<InspectorContent> {
 
 TOAST_PROTO_EVENT(InspectorContent);
 
+template<>
+struct ProtoTraits<InspectorDelta::FieldDelta> {
+	using Proto = proto::events::InspectorFieldDelta;
+	using Event = InspectorDelta::FieldDelta;
+
+	static auto toProto(const Event& e) -> Proto {
+		Proto p;
+		p.set_index(e.index);
+		auto* value = p.mutable_value();
+		std::visit(
+		    [value]<typename T>(const T& v) {
+			    if constexpr (std::is_same_v<T, bool>) {
+				    value->set_flag(v);
+			    } else if constexpr (std::is_same_v<T, int64_t>) {
+				    value->set_integer(v);
+			    } else if constexpr (std::is_same_v<T, double>) {
+				    value->set_number(v);
+			    } else if constexpr (std::is_same_v<T, std::string>) {
+				    value->set_text(v);
+			    } else {
+				    value->mutable_vector()->mutable_components()->Add(v.begin(), v.end());
+			    }
+		    },
+		    e.value
+		);
+		return p;
+	}
+
+	static auto fromProto(const Proto& p) -> Event {
+		const auto& value = p.value();
+		switch (value.kind_case()) {
+			case proto::events::InspectorValue::kFlag: return {p.index(), value.flag()};
+			case proto::events::InspectorValue::kInteger: return {p.index(), value.integer()};
+			case proto::events::InspectorValue::kNumber: return {p.index(), value.number()};
+			case proto::events::InspectorValue::kVector:
+				return {p.index(), std::vector<float>(value.vector().components().begin(), value.vector().components().end())};
+			default: return {p.index(), value.text()};
+		}
+	}
+};
+
+template<>
+struct ProtoTraits<InspectorDelta> {
+	using Proto = proto::events::InspectorDelta;
+	using Event = InspectorDelta;
+
+	static auto toProto(const Event& e) -> Proto {
+		Proto p;
+		p.set_uid(e.uid);
+		p.set_name(e.name);
+		p.set_enabled(e.enabled);
+		for (const auto& f : e.fields) {
+			*p.add_fields() = ProtoTraits<InspectorDelta::FieldDelta>::toProto(f);
+		}
+		return p;
+	}
+
+	static auto fromProto(const Proto& p) -> Event {
+		std::vector<InspectorDelta::FieldDelta> fields;
+		fields.reserve(p.fields_size());
+		for (const auto& f : p.fields()) {
+			fields.emplace_back(ProtoTraits<InspectorDelta::FieldDelta>::fromProto(f));
+		}
+		return {p.uid(), p.name(), p.enabled(), std::move(fields)};
+	}
+};
+
+TOAST_PROTO_EVENT(InspectorDelta);
+
+template<>
+struct ProtoTraits<RequestInspectorContent> {
+	using Proto = proto::events::RequestInspectorContent;
+	using Event = RequestInspectorContent;
+
+	static auto toProto(const Event& e) -> Proto { return {}; }
+
+	static auto fromProto(const Proto& p) -> Event { return {}; }
+};
+
+TOAST_PROTO_EVENT(RequestInspectorContent);
+
 template<>
 struct ProtoTraits<InspectorLuaContent::LuaField> {
 	using Proto = proto::events::LuaField;
@@ -7,8 +7,12 @@
 #pragma once
 #include <toast/events/event.hpp>
 #include <toast/uid.hpp>
+#include <string_view>
 #include <toast/world/box.hpp>
+#include <toast/world/hierarchy_journal.hpp>
 #include <utility>
+#include <variant>
+#include <vector>
 
 namespace event {
 
@@ -28,15 +32,40 @@ struct UpdateHierarchyData : Event<UpdateHierarchyData> {
 		HierarchyElement(const HierarchyElement& other);
 	};
 
+	static constexpr auto coalesce = Coalesce::latest;
+
 	HierarchyElement root;
 	bool is_empty = false;
+	uint64_t sequence = 0;    ///< HierarchyJournal::sequence() this snapshot stands for
+	uint64_t checksum = 0;    ///< HierarchyMirror::checksum() of the tree
+
+	UpdateHierarchyData(const toast::Box<toast::Node>& node, uint64_t sequence = 0, uint64_t checksum = 0);
+
+	UpdateHierarchyData(const HierarchyElement& h, bool is_empty, uint64_t sequence = 0, uint64_t checksum = 0)
+	    : root(h),
+	      is_empty(is_empty),
+	      sequence(sequence),
+	      checksum(checksum) { }
+};
 
-	UpdateHierarchyData(const toast::Box<toast::Node>& node);
+struct HierarchyDiff : Event<HierarchyDiff> {
+	uint64_t sequence;
+	uint64_t checksum;    ///< 0 when this batch isn't a checkpoint
+	std::vector<toast::HierarchyChange> changes;
 
-	UpdateHierarchyData(const HierarchyElement& h, bool is_empty) : root(h), is_empty(is_empty) { }
+	HierarchyDiff(uint64_t sequence, uint64_t checksum, std::vector<toast::HierarchyChange> changes)
+	    : sequence(sequence),
+	      checksum(checksum),
+	      changes(std::move(changes)) { }
 };
 
-struct RequestHierarchyUpdate : Event<RequestHierarchyUpdate> { };
+struct RequestHierarchyUpdate : Event<RequestHierarchyUpdate> {
+	static constexpr auto coalesce = Coalesce::latest;
+};
+
+struct RequestHierarchySnapshot : Event<RequestHierarchySnapshot> {
+	static constexpr auto coalesce = Coalesce::latest;
+};
 
 struct WorkspaceCreate : Event<WorkspaceCreate> {
 	toast::UID parent;
@@ -138,6 +167,8 @@ struct WorkspacePromoteNode : Event<WorkspacePromoteNode> {
 };
 
 struct SetFocusedNode : Event<SetFocusedNode> {
+	static constexpr auto coalesce = Coalesce::latest;
+
 	toast::UID node;
 
 	SetFocusedNode(toast::UID n) : node(n) { }
@@ -211,6 +242,8 @@ struct InspectorContent : Event<InspectorContent> {
 		InspectorField(std::string_view name, std::string_view value) : name(name), value(value) { }
 	};
 
+	static constexpr auto coalesce = Coalesce::by_key;
+
 	std::string uid;
 	std::string name;
 	bool enabled;
@@ -221,8 +254,39 @@ struct InspectorContent : Event<InspectorContent> {
 	      name(name),
 	      enabled(enabled),
 	      parameters(std::move(fields)) { }
+
+	/// The node's 64-bit UID, so two nodes never share a key
+	[[nodiscard]]
+	auto coalesceKey() const -> uint64_t {
+		return toast::UID::fromString(uid);
+	}
+};
+
+// Fields of the focused node that changed since the last InspectorContent, indexed by their position in it
+struct InspectorDelta : Event<InspectorDelta> {
+	using Value = std::variant<bool, int64_t, double, std::string, std::vector<float>>;
+
+	struct FieldDelta {
+		uint32_t index;
+		Value value;
+
+		FieldDelta(uint32_t index, Value value) : index(index), value(std::move(value)) { }
+	};
+
+	std::string uid;
+	std::string name;
+	bool enabled;
+	std::vector<FieldDelta> fields;
+
+	InspectorDelta(std::string_view uid, std::string_view name, bool enabled, std::vector<FieldDelta> fields)
+	    : uid(uid),
+	      name(name),
+	      enabled(enabled),
+	      fields(std::move(fields)) { }
 };
 
+struct RequestInspectorContent : Event<RequestInspectorContent> { };
+
 struct InspectorLuaContent : Event<InspectorLuaContent> {
 	struct LuaField {
 		std::string path;
@@ -251,6 +315,8 @@ struct InspectorLuaContent : Event<InspectorLuaContent> {
 		std::vector<LuaGroup> groups;
 	};
 
+	static constexpr auto coalesce = Coalesce::by_key;
+
 	std::string uid;
 	uint32_t schema_version = 0;
 	std::vector<LuaScriptCard> scripts;
@@ -261,6 +327,12 @@ struct InspectorLuaContent : Event<InspectorLuaContent> {
 	    : uid(uid),
 	      schema_version(schema_version),
 	      scripts(std::move(scripts)) { }
+
+	/// The node's 64-bit UID, so two nodes never share a key
+	[[nodiscard]]
+	auto coalesceKey() const -> uint64_t {
+		return toast::UID::fromString(uid);
+	}
 };
 
 struct NodeChangeLuaParam : Event<NodeChangeLuaParam> {
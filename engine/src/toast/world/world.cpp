@@ -1,16 +1,21 @@
 #include "world.hpp"
 
 #include "camera.hpp"
+#include "workspace.hpp"
 #include "workspace_events.hpp"
 #include "world_test_access.hpp"
 
 #include <chrono>
 #include <sstream>
+#include <thread>
 #include <toast/assets/asset_manager.hpp>
 #include <toast/assets/assets.hpp>
 #include <toast/assets/types.hpp>
+#include <toast/input/input_system.hpp>
 #include <toast/renderer/vulkan_renderer.hpp>
+#include <toast/replay.hpp>
 #include <toast/thread_pool.hpp>
+#include <toast/time.hpp>
 #include <toast/uri_handler.hpp>
 #include <utility>
 
@@ -18,6 +23,40 @@ namespace toast {
 
 using namespace _detail;
 
+namespace {
+
+/**
+ * Takes the @p count entries a replay expects out of an async queue, in the recorded order, waiting for
+ * workers that haven't finished yet. Entries the recording drained on a later frame stay queued.
+ * Returns fewer entries if one never shows up
+ */
+template<typename Entry, typename Match>
+auto takeReplayedEntries(std::mutex& mutex, std::vector<Entry>& queue, size_t count, Match&& match) -> std::vector<Entry> {
+	std::vector<Entry> taken;
+	taken.reserve(count);
+	const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+	for (size_t i = 0; i < count; ++i) {
+		while (true) {
+			{
+				std::scoped_lock lock(mutex);
+				auto it = std::ranges::find_if(queue, [&](const Entry& entry) { return match(entry, i); });
+				if (it != queue.end()) {
+					taken.push_back(std::move(*it));
+					queue.erase(it);
+					break;
+				}
+			}
+			if (std::chrono::steady_clock::now() > deadline) {
+				return taken;
+			}
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+	}
+	return taken;
+}
+
+}
+
 World::World() {
 	instance = this;
 
@@ -70,13 +109,21 @@ World::~World() {
 	TOAST_INFO("World", "Destroyed world");
 }
 
-void World::tick() {
+void World::frameTick() {
 	ZoneScoped;
 
 	drainDestroyQueue();
 	drainLoadQueue();
 	drainSpawnQueue();
 
+	if (auto* replay = Replay::get(); replay and replay->checkpointDue()) {
+		replay->checkpoint(stateHash());
+	}
+}
+
+void World::tick() {
+	ZoneScoped;
+
 	m_scheduler.runPhase(m_scheduler.schedule.early_tick, TickFunctionList::early_tick, "early_tick");
 	if (trees.root.exists()) {
 		INodeOwner::updateTransforms(*trees.root);
@@ -85,7 +132,7 @@ void World::tick() {
 		INodeOwner::updateTransforms(*g);
 	}
 	m_scheduler.runPhase(m_scheduler.schedule.tick, TickFunctionList::tick, "tick");
-	// TODO: physics step goes between tick and post_physics
+	m_physics.step(static_cast<float>(Time::delta()));
 	m_scheduler.runPhase(m_scheduler.schedule.post_physics, TickFunctionList::post_physics, "post_physics");
 	m_scheduler.runPhase(m_scheduler.schedule.late_tick, TickFunctionList::late_tick, "late_tick");
 }
@@ -172,7 +219,22 @@ void World::loadNode(std::string_view uri, bool activate_as_root) {
 void World::drainLoadQueue() {
 	std::vector<Box<Node>> loaded;
 	UID pending_uid {0};
-	{
+	Replay* replay = Replay::get();
+	if (replay and replay->playing()) {
+		const auto& expected = replay->expectedLoads();
+		if (expected.empty()) {
+			return;
+		}
+		loaded = takeReplayedEntries(m.load_mutex, trees.load_queue, expected.size(), [&](const Box<Node>& root, size_t i) {
+			return root->uid().data() == expected[i].data();
+		});
+		if (loaded.size() != expected.size()) {
+			replay->diverge("a recorded load never finished");
+		}
+
+		std::scoped_lock lock(m.load_mutex);
+		pending_uid = m.pending_root_uid;
+	} else {
 		std::scoped_lock lock(m.load_mutex);
 		if (trees.load_queue.empty()) {
 			return;
@@ -183,6 +245,14 @@ void World::drainLoadQueue() {
 
 	ZoneScoped;
 
+	if (replay and replay->recording()) {
+		std::vector<UID> order;
+		for (const auto& root : loaded) {
+			order.push_back(root->uid());
+		}
+		replay->loaded(order);
+	}
+
 	// Freshly loaded trees go to the cached list and are ready to be activated
 	for (auto& root : loaded) {
 		const UID node_uid = root->uid();
@@ -246,7 +316,21 @@ void World::spawn(UID prefab, Node& parent) {
 
 void World::drainSpawnQueue() {
 	std::vector<std::pair<Box<Node>, Box<Node>>> ready;
-	{
+	Replay* replay = Replay::get();
+	const bool replaying = replay and replay->playing();
+	if (replaying) {
+		const auto& expected = replay->expectedSpawns();
+		if (expected.empty()) {
+			return;
+		}
+		ready = takeReplayedEntries(m.load_mutex, m.spawn_queue, expected.size(), [&](const auto& entry, size_t i) {
+			const uint64_t parent_uid = entry.second.exists() ? entry.second->uid().data() : 0;
+			return parent_uid == expected[i].parent.data() and Replay::nameHash(entry.first->name()) == expected[i].name_hash;
+		});
+		if (ready.size() != expected.size()) {
+			replay->diverge("a recorded spawn never finished");
+		}
+	} else {
 		std::scoped_lock lock(m.load_mutex);
 		if (m.spawn_queue.empty()) {
 			return;
@@ -256,19 +340,35 @@ void World::drainSpawnQueue() {
 
 	ZoneScoped;
 
-	for (auto& [root, parent] : ready) {
+	std::vector<Replay::SpawnRecord> order;
+	for (size_t i = 0; i < ready.size(); ++i) {
+		auto& [root, parent] = ready[i];
+		const uint64_t parent_uid = parent.exists() ? parent->uid().data() : 0;
+		const uint64_t name_hash = Replay::nameHash(root->name());
+
 		if (not parent.exists() || parent->m_state == NodeState::destroy) {
 			TOAST_WARN("World", "Spawn target for {} no longer exists; dropping the spawn", root->name());
+			order.push_back({UID(parent_uid), name_hash, root->uid()});
 			continue;
 		}
 
-		// Keep the placement UID unique within the parents namespace
-		while (findNode(root->uid(), &*parent).exists()) {
-			generateUid(*root);
+		if (replaying) {
+			// Spawned UIDs are random, a replay reuses the recorded ones
+			root->m_uid = replay->expectedSpawns()[i].uid;
+		} else {
+			// Keep the placement UID unique within the parents namespace
+			while (findNode(root->uid(), &*parent).exists()) {
+				generateUid(*root);
+			}
 		}
 
+		order.push_back({UID(parent_uid), name_hash, root->uid()});
 		moveToChild(*root, *parent);
 	}
+
+	if (replay and replay->recording()) {
+		replay->spawned(order);
+	}
 }
 
 auto World::findNode(const UID& uid, Node* scope) -> Box<Node> {
@@ -632,6 +732,45 @@ void World::hotReloadScripts(toast::UID script_uid) {
 	instance->computeDependencyGraph();
 }
 
+auto World::stateHash() const -> uint64_t {
+	// FNV-1a over the trees in child order; only fields a run can change, nothing pointer-based
+	uint64_t hash = 14695981039346656037ull;
+	auto mix = [&hash](const void* data, size_t size) {
+		const auto* bytes = static_cast<const uint8_t*>(data);
+		for (size_t i = 0; i < size; ++i) {
+			hash ^= bytes[i];
+			hash *= 1099511628211ull;
+		}
+	};
+
+	auto visit = [&](this auto&& self, const Node& node) -> void {
+		const uint64_t uid = node.uid().data();
+		const bool enabled = node.enabled();
+		mix(&uid, sizeof(uid));
+		mix(node.name().data(), node.name().size());
+		mix(&enabled, sizeof(enabled));
+		if (const auto* node_3d = dynamic_cast<const Node3D*>(&node)) {
+			mix(&node_3d->position, sizeof(node_3d->position));
+			mix(&node_3d->rotation, sizeof(node_3d->rotation));
+			mix(&node_3d->scale, sizeof(node_3d->scale));
+		}
+
+		const auto child_count = static_cast<uint32_t>(node.m_children.size());
+		mix(&child_count, sizeof(child_count));
+		for (const auto& child : node.m_children) {
+			self(*child);
+		}
+	};
+
+	if (trees.root.exists()) {
+		visit(*trees.root);
+	}
+	for (const auto& global : trees.global) {
+		visit(*global);
+	}
+	return hash;
+}
+
 auto World::graphviz() -> std::string {
 	return instance->dependencyGraphGraphviz();
 }
@@ -657,6 +796,15 @@ void World::drainDestroyQueue() {
 	std::vector<Box<Node>> doomed;
 	std::swap(doomed, trees.destroy_queue);
 
+	// Every frame, so a playback that destroys nothing where the recording did still diverges
+	if (auto* replay = Replay::get()) {
+		std::vector<UID> uids;
+		for (const auto& root : doomed) {
+			uids.push_back(root->uid());
+		}
+		replay->destroyed(uids);
+	}
+
 	if (!doomed.empty()) {
 		ZoneScopedN("World::drainDestroyQueue()");
 
@@ -687,29 +835,10 @@ void World::drainDestroyQueue() {
 		scrub(m_scheduler.graph.connections);
 		scrub(m_scheduler.graph.inverse_connections);
 
-		// Detach the tree structure so no victim holds a Box to another
 		for (Node* victim : victims) {
-			victim->m_parent = {};
-			victim->m_children.clear();
-			victim->m_listener.reset();
-		}
-
-		// Free the nodes
-		{
-			std::scoped_lock lock(nodes_mutex);
-			for (Node* victim : victims) {
-				ControlBox* control = ControlBox::get(victim);
-				const NodeInfo* info = victim->info();
-				TOAST_TRACE("World", "Destroying node {} ({})", victim->name(), victim->uid());
-
-				if (info && info->destroy) {
-					info->destroy(victim);
-				} else {
-					delete victim;
-				}
-				releaseNode(*control);
-			}
+			TOAST_TRACE("World", "Destroying node {} ({})", victim->name(), victim->uid());
 		}
+		freeNodes(victims);
 
 		computeDependencyGraph();
 	}
@@ -787,7 +916,7 @@ auto World::swapRoot(Node& node) -> Box<Node> {
 
 	node.propagateCallTick(node.info(), TickFunctionList::begin);
 	node.enabled(true);
-	event::send<event::RequestHierarchyUpdate>();    // TODO: should the world send this?
+	event::send<event::RequestHierarchyUpdate>();    // the active workspace answers with a diff, so this is cheap
 	TOAST_INFO("World", "Swapped root to {} ({})", node.name(), node.uid());
 
 	return root_node;
@@ -1101,17 +1230,47 @@ auto WorldTestAccess::createNode(World& world, std::string_view name, NodeState
 	return node;
 }
 
+auto WorldTestAccess::allocateNode(World& world, std::string_view type) -> Box<Node> {
+	return world.nodeAllocation(type);
+}
+
+void WorldTestAccess::freeNodes(World& world, std::span<Node* const> victims) {
+	world.freeNodes(victims);
+}
+
+void WorldTestAccess::reapTombstones(World& world) {
+	world.reapTombstones();
+}
+
+auto WorldTestAccess::nodeUids(World& world) -> std::vector<uint64_t> {
+	std::vector<uint64_t> uids;
+	std::scoped_lock lock(world.nodes_mutex);
+	world.forEachNode([&uids](const ControlBox& control) {
+		if (control.node) {
+			uids.push_back(control.node->uid().data());
+		}
+	});
+	return uids;
+}
+
 void WorldTestAccess::registerDependency(Node& from, Node& to) {
 	World::instance->registerDependency(from, to);
 }
 
-void WorldTestAccess::addTickStage(Node& node, TickFunctionList stage) {
+void WorldTestAccess::addTickStage(Node& node, TickFunctionList stage, TickFunctions::Invoker invoker) {
 	// Test-only: fabricate a per-instance NodeInfo carrying the requested tick flags so the
 	// scheduler (which reads m_info) treats this node as participating in `stage`. Real nodes
 	// get their NodeInfo from the type registry instead.
 	NodeInfo& info = testNodeInfos()[&node];
 	info.type = "test::Node";
 	info.functions.list = info.functions.list | stage;
+	switch (stage) {
+		case TickFunctionList::early_tick: info.functions.early_tick = invoker; break;
+		case TickFunctionList::tick: info.functions.tick = invoker; break;
+		case TickFunctionList::post_physics: info.functions.post_physics = invoker; break;
+		case TickFunctionList::late_tick: info.functions.late_tick = invoker; break;
+		default: break;
+	}
 	node.m_info = &info;
 }
 
@@ -1156,10 +1315,29 @@ void WorldTestAccess::initThreadPool() {
 	(void)pool;
 }
 
+auto WorldTestAccess::createTime() -> std::unique_ptr<Time> {
+	return std::unique_ptr<Time>(new Time());
+}
+
+void WorldTestAccess::runFrame(World& world, double raw_delta, input::InputSystem* input) {
+	Time& time = Time::get();
+	time.advance(raw_delta);
+	event::pollEvents();
+	if (input) {
+		input->tick();
+	}
+	world.frameTick();
+	time.runSteps([&world] { world.tick(); });
+}
+
 void WorldTestAccess::setWorldRoot(World& world, Node& node) {
 	world.trees.root = node.box();
 }
 
+void WorldTestAccess::updateTransforms(Node& root) {
+	World::updateTransforms(root);
+}
+
 void WorldTestAccess::initAssetManager(std::string_view assets_dir, std::string_view cache_dir) {
 	static std::unique_ptr<assets::AssetManager> manager;
 
@@ -1211,6 +1389,10 @@ auto WorldTestAccess::spawnSync(
 	return root;
 }
 
+void WorldTestAccess::spawn(UID prefab, Node& parent) {
+	World::spawn(prefab, parent);
+}
+
 auto WorldTestAccess::dependencyGraphGraphviz(const World& world) -> std::string {
 	return world.dependencyGraphGraphviz();
 }
@@ -1235,6 +1417,18 @@ auto WorldTestAccess::uidPath(const Node& node) -> std::string {
 	return World::uidPath(node);
 }
 
+void WorldTestAccess::focusInspector(Workspace& workspace, const UID& node) {
+	workspace.focusNode(node);
+}
+
+void WorldTestAccess::requestInspectorContent(Workspace& workspace) {
+	workspace.restartInspector();
+}
+
+void WorldTestAccess::streamInspector(Workspace& workspace) {
+	workspace.streamInspector();
+}
+
 }
 
 #pragma endregion TESTS
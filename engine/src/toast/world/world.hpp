@@ -24,6 +24,7 @@
 #include <toast/assets/prefab.hpp>
 #include <toast/events/listener.hpp>
 #include <toast/log.hpp>
+#include <toast/physics/physics_scene.hpp>
 #include <toast/reflect/reflect.hpp>
 #include <type_traits>
 #include <unordered_map>
@@ -43,6 +44,12 @@ public:
 	auto name() -> std::string override { return "World"; }
 
 	void tick() override;
+	void frameTick() override;
+
+	[[nodiscard]]
+	auto physicsScene() noexcept -> physics::PhysicsScene* override {
+		return &m_physics;
+	}
 
 	[[nodiscard]]
 	auto participatesIn(NodeOwnerParticipation /*use*/) const noexcept -> bool override {
@@ -62,7 +69,7 @@ public:
 	 * @brief Begins asynchronous loading of a prefab into the cache
 	 * @param uid UID of the prefab asset to load
 	 * @param activate_as_root If true, automatically calls setRoot() once the node finishes loading
-	 * @note The node appears in trees.cached at the start of the next tick() after loading finishes;
+	 * @note The node appears in trees.cached at the next frameTick() after loading finishes;
 	 *       if activate_as_root is false, call setRoot() afterwards to make it the active scene
 	 */
 	static void loadNode(UID uid, bool activate_as_root = false);
@@ -100,7 +107,7 @@ public:
 	static auto cacheNode(Node& node) -> Box<Node>;
 
 	/**
-	 * @brief Schedules a cached node for destruction at the start of the next tick
+	 * @brief Schedules a cached node for destruction at the next frameTick()
 	 * @param node Must be in the cached state; active nodes must be cached first
 	 * @note Code holding a Box<Node> to the node remains safe until the queue is drained next frame
 	 * @warning Only cached nodes can be destroyed; attempting to destroy an active node logs a warning and does nothing
@@ -137,6 +144,13 @@ public:
 	[[nodiscard]]
 	auto dependencyGraphGraphviz() const -> std::string;
 
+	/**
+	 * @brief Hash of the active tree and the global nodes: UIDs, names, enabled flags and local transforms
+	 * @note Replays compare it at checkpoints to find the first frame two runs disagree on
+	 */
+	[[nodiscard]]
+	auto stateHash() const -> uint64_t;
+
 private:
 	inline static World* instance = nullptr;
 
@@ -200,11 +214,12 @@ private:
 		std::vector<Box<Node>> global;           ///< always-active nodes that sit outside the main tree
 		std::vector<Box<Node>> cached;           ///< loaded but inactive; waiting to become root or be destroyed
 		std::vector<Box<Node>> load_queue;       ///< assets being loaded asynchronously
-		std::vector<Box<Node>> destroy_queue;    ///< nodes queued for destruction; drained at the start of tick
+		std::vector<Box<Node>> destroy_queue;    ///< nodes queued for destruction; drained by frameTick
 	} trees;
 
 	using DependencyGraph = TickScheduler::DependencyGraph;
 	TickScheduler m_scheduler;
+	physics::PhysicsScene m_physics;
 
 	// for testing only
 	friend struct toast::_detail::WorldTestAccess;
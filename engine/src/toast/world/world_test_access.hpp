@@ -2,11 +2,23 @@
 
 #include "world.hpp"
 
+#include <cstdint>
 #include <memory>
+#include <span>
 #include <string_view>
 #include <toast/assets/script.hpp>
 #include <toast/export.hpp>
 #include <toast/scripting/lua_value_codec.hpp>
+#include <toast/time.hpp>
+#include <vector>
+
+namespace input {
+class InputSystem;
+}
+
+namespace toast {
+class Workspace;
+}
 
 namespace toast::_detail {
 
@@ -21,11 +33,22 @@ struct TOAST_API WorldTestAccess {
 
 	static auto createNode(World& world, std::string_view name, NodeState state = NodeState::root) -> Box<Node>;
 
+	// Test-only: raw INodeOwner::nodeAllocation without the fabricated NodeInfo createNode attaches
+	static auto allocateNode(World& world, std::string_view type) -> Box<Node>;
+
+	static void freeNodes(World& world, std::span<Node* const> victims);
+
+	static void reapTombstones(World& world);
+
+	// Test-only: UIDs of every live node in slot order
+	static auto nodeUids(World& world) -> std::vector<uint64_t>;
+
 	static void registerDependency(Node& from, Node& to);
 
 	// Test-only: make `node` participate in the given tick stage by attaching a fabricated
-	// NodeInfo (the per-instance NodeFunctionTable no longer exists).
-	static void addTickStage(Node& node, TickFunctionList stage);
+	// NodeInfo (the per-instance NodeFunctionTable no longer exists). `invoker` is what the
+	// stage calls; tests that only look at the schedule leave it null
+	static void addTickStage(Node& node, TickFunctionList stage, TickFunctions::Invoker invoker = nullptr);
 
 	// Test-only: appends a script asset to the node and (re)builds its ScriptRuntime;
 	// requires a LuaState to exist
@@ -49,12 +72,24 @@ struct TOAST_API WorldTestAccess {
 
 	static void initThreadPool();
 
+	// Test-only: the Time runFrame() advances; only one may exist at a time
+	static auto createTime() -> std::unique_ptr<Time>;
+
+	// Test-only: one frame in Engine::tick's order with `raw_delta` as the wall-clock delta: Time,
+	// queued events, `input` when given, frameTick(), then tick() once per fixed step
+	static void runFrame(World& world, double raw_delta, input::InputSystem* input = nullptr);
+
 	static void setWorldRoot(World& world, Node& node);
 
+	static void updateTransforms(Node& root);
+
 	static auto
 	    spawnSync(World& world, const assets::Handle<assets::Prefab>& file, Node& parent, INodeOwner::InstantiateContext& ctx)
 	        -> Box<Node>;
 
+	// Test-only: World::spawn, the async path that lands through the spawn queue at a later frameTick()
+	static void spawn(UID prefab, Node& parent);
+
 	static void initAssetManager(std::string_view assets_dir, std::string_view cache_dir);
 
 	static void waitForLoads(World& world);
@@ -68,6 +103,12 @@ struct TOAST_API WorldTestAccess {
 	static auto findNode(const UID& uid, Node* scope = nullptr) -> Box<Node>;
 	static auto findNode(std::string_view path) -> Box<Node>;
 	static auto uidPath(const Node& node) -> std::string;
+
+	// Test-only: Workspace's inspector stream, minus the Engine that picks the active workspace and the
+	// 12 fps throttle; what SetFocusedNode, RequestInspectorContent and frameTick() run past those
+	static void focusInspector(Workspace& workspace, const UID& node);
+	static void requestInspectorContent(Workspace& workspace);
+	static void streamInspector(Workspace& workspace);
 };
 
 }
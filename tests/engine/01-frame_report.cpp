@@ -0,0 +1,52 @@
+#include "test_registry.hpp"
+
+#include <cassert>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <toast/frame_report.hpp>
+
+TOAST_TEST_NAMED("Engine", "engine/01-frame_report", test_engine_01_frame_report) {
+	toast::FrameReport report({"Audio", "Render build"});
+
+	// Frame time ramps up 1..100 ms, the stages stay flat; one frame leaves its stage times out
+	for (int i = 0; i < 100; ++i) {
+		toast::FrameReport::Frame frame {.frame_ms = static_cast<double>(i + 1), .owners_ms = 4.0, .visible = 10, .culled = 5};
+		if (i != 42) {
+			frame.stage_ms = {0.5, 2.0};
+		}
+		report.add(std::move(frame));
+	}
+	assert(report.frames().size() == 100);
+	assert(report.frames()[42].stage_ms.size() == 2 && "missing stage times are padded with zeros");
+
+	const auto summary = report.summary();
+	assert(summary.size() == 6);    // frame, owners, two stages, visible, resident memory
+	assert(summary[0].name == "frame_ms");
+	assert(summary[0].p50 == 51.0);
+	assert(summary[0].p99 == 99.0);
+	assert(summary[0].max == 100.0);
+
+	// First tenth averages 5.5 ms, the last 95.5 ms
+	assert(std::abs(summary[0].drift_pct - (95.5 - 5.5) / 5.5 * 100.0) < 1e-9);
+	assert(summary[1].drift_pct == 0.0);
+	assert(summary[3].name == "Render build");
+	assert(summary[3].p50 == 2.0 && summary[3].max == 2.0);
+
+	const auto path = std::filesystem::temp_directory_path() / "toast_frame_report_test.csv";
+	assert(report.writeCsv(path));
+	{
+		std::ifstream in(path);
+		std::string line;
+		std::getline(in, line);
+		assert(line == "frame,frame_ms,owners_ms,Audio,Render build,visible,culled,resident_kb");
+
+		size_t rows = 0;
+		while (std::getline(in, line)) {
+			++rows;
+		}
+		assert(rows == 100);
+	}
+	std::filesystem::remove(path);
+}
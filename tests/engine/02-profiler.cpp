@@ -0,0 +1,86 @@
+#include "test_registry.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <toast/profiler.hpp>
+
+namespace {
+
+auto findZone(const std::vector<toast::Profiler::Stats>& stats, std::string_view name) -> const toast::Profiler::Stats* {
+	const auto it = std::ranges::find(stats, name, &toast::Profiler::Stats::name);
+	return it == stats.end() ? nullptr : &*it;
+}
+
+}
+
+TOAST_TEST_NAMED("Engine", "engine/02-profiler", test_engine_02_profiler) {
+	const auto spike_dir = std::filesystem::temp_directory_path() / "toast_profiler_test";
+	std::filesystem::remove_all(spike_dir);
+
+	toast::Profiler profiler;
+	profiler.setBudget("slow", 2.0);
+	profiler.setSpikeDirectory(spike_dir, 1);
+
+	// Frames 10 and 16 go over the "slow" budget; only the first one is dumped
+	for (int frame = 1; frame <= 20; ++frame) {
+		{
+			TOAST_ZONE("fast");
+		}
+		if (frame == 10 or frame == 16) {
+			TOAST_ZONE("outer");
+			TOAST_ZONE("slow");
+			std::this_thread::sleep_for(std::chrono::milliseconds(4));
+		}
+		if (frame == 10) {
+			std::thread worker([] { TOAST_ZONE("worker"); });
+			worker.join();
+		}
+		profiler.endFrame();
+	}
+
+	assert(profiler.frames() == 20);
+	assert(profiler.overBudgetFrames() == 2);
+
+	const auto stats = profiler.stats();
+	assert(stats.front().name == toast::Profiler::frame_zone);
+
+	const auto* slow = findZone(stats, "slow");
+	assert(slow and slow->budget_ms == 2.0);
+	assert(slow->max_ms >= 4.0);
+	assert(slow->p50_ms == 0.0);    // didn't run on most frames
+	assert(slow->over_budget == 2);
+	assert(findZone(stats, "outer")->max_ms >= slow->max_ms);
+	assert(findZone(stats, "fast")->budget_ms == 0.0);
+	assert(findZone(stats, "worker") != nullptr);
+
+	// The dump holds the offender and the zone tree of every thread
+	const auto dump_path = spike_dir / "frame_10.txt";
+	assert(std::filesystem::exists(dump_path));
+	assert(!std::filesystem::exists(spike_dir / "frame_16.txt"));
+	std::ifstream dump_file(dump_path);
+	std::stringstream dump;
+	dump << dump_file.rdbuf();
+	const std::string text = dump.str();
+	assert(text.find("over budget: slow") != std::string::npos);
+	assert(text.find("  outer") != std::string::npos);
+	assert(text.find("    slow") != std::string::npos);
+	assert(text.find("thread 1") != std::string::npos);
+	assert(text.find("worker") != std::string::npos);
+
+	// A disabled profiler doesn't see new zones
+	profiler.setEnabled(false);
+	{
+		TOAST_ZONE("hidden");
+	}
+	profiler.endFrame();
+	assert(findZone(profiler.stats(), "hidden") == nullptr);
+
+	dump_file.close();
+	std::filesystem::remove_all(spike_dir);
+}
@@ -0,0 +1,75 @@
+#include "test_registry.hpp"
+
+#include <cassert>
+#include <thread>
+#include <toast/memory_tracker.hpp>
+#include <vector>
+
+using toast::MemoryTag;
+using toast::MemoryTracker;
+
+TOAST_TEST_NAMED("Engine", "engine/03-memory_tracker", test_engine_03_memory_tracker) {
+	// pmr allocations count against their tag until they're returned
+	const auto before = MemoryTracker::counters(MemoryTag::events);
+	auto* resource = MemoryTracker::resource(MemoryTag::events);
+	void* block = resource->allocate(4096, 64);
+	{
+		const auto during = MemoryTracker::counters(MemoryTag::events);
+		assert(during.current == before.current + 4096);
+		assert(during.peak >= during.current);
+		assert(during.allocations == before.allocations + 1);
+		assert(during.live_blocks == before.live_blocks + 1);
+		assert(MemoryTracker::reportLeaks() >= 1);
+	}
+	resource->deallocate(block, 4096, 64);
+	{
+		const auto after = MemoryTracker::counters(MemoryTag::events);
+		assert(after.current == before.current);
+		assert(after.live_blocks == before.live_blocks);
+		assert(after.peak >= before.current + 4096);
+	}
+
+	// Containers take the resource directly
+	{
+		std::pmr::vector<int> values(MemoryTracker::resource(MemoryTag::assets));
+		values.resize(1000);
+		assert(MemoryTracker::counters(MemoryTag::assets).current >= 1000 * sizeof(int));
+	}
+
+	// The rate covers what was allocated since the last full second
+	MemoryTracker::update(1.0);
+	MemoryTracker::allocated(MemoryTag::nodes, 1024 * 1024);
+	MemoryTracker::update(0.5);
+	MemoryTracker::update(0.5);
+	assert(MemoryTracker::counters(MemoryTag::nodes).bytes_per_second == 1024.0 * 1024.0);
+	MemoryTracker::update(1.0);
+	assert(MemoryTracker::counters(MemoryTag::nodes).bytes_per_second == 0.0);
+
+	// Budgets are reported back; going over one only logs
+	const uint64_t nodes_now = MemoryTracker::counters(MemoryTag::nodes).current;
+	MemoryTracker::setBudget(MemoryTag::nodes, nodes_now + 512);
+	assert(MemoryTracker::counters(MemoryTag::nodes).budget == nodes_now + 512);
+	MemoryTracker::allocated(MemoryTag::nodes, 1024);
+	MemoryTracker::update(0.016);
+	MemoryTracker::freed(MemoryTag::nodes, 1024);
+	MemoryTracker::freed(MemoryTag::nodes, 1024 * 1024);
+	MemoryTracker::setBudget(MemoryTag::nodes, 0);
+
+	// Counters stay exact under contention
+	const auto contended_before = MemoryTracker::counters(MemoryTag::lua);
+	std::vector<std::thread> threads;
+	for (int t = 0; t < 4; ++t) {
+		threads.emplace_back([] {
+			for (int i = 0; i < 10000; ++i) {
+				MemoryTracker::allocated(MemoryTag::lua, 48);
+				MemoryTracker::freed(MemoryTag::lua, 48);
+			}
+		});
+	}
+	for (auto& thread : threads) {
+		thread.join();
+	}
+	const auto contended_after = MemoryTracker::counters(MemoryTag::lua);
+	assert(contended_after.current == contended_before.current);
+	assert(contended_after.allocations == contended_before.allocations + 40000);
+}
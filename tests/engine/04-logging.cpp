@@ -0,0 +1,104 @@
+#include "test_registry.hpp"
+
+#include <cassert>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <toast/log.hpp>
+#include <toast/log_capture.hpp>
+
+using logging::LogCapture;
+
+namespace {
+
+int log_side_effects = 0;
+
+auto sideEffect() -> int {
+	return ++log_side_effects;
+}
+
+#pragma push_macro("TOAST_LOG_MIN_SEVERITY")
+#undef TOAST_LOG_MIN_SEVERITY
+#define TOAST_LOG_MIN_SEVERITY 1
+void compiledOutTrace() {
+	TOAST_TRACE("LogTest", "never formatted {}", sideEffect());
+}
+#pragma pop_macro("TOAST_LOG_MIN_SEVERITY")
+
+}
+
+TOAST_TEST_NAMED("Engine", "engine/04-logging", test_engine_04_logging) {
+	// Plain values are captured as bytes and only turn into text when read
+	{
+		LogCapture capture;
+		const uint8_t small = 7;
+		const int64_t big = -12345678901;
+		TOAST_TRACE("LogTest", "{} {} {:.2f} {} {}", small, big, 2.5, true, 'x');
+		assert(capture.count() == 1);
+		assert(capture.deferredCount() == 1);
+
+		const auto entries = capture.entries();
+		assert(entries.size() == 1);
+		assert(entries[0].severity == 0);
+		assert(entries[0].sink == "LogTest");
+		assert(entries[0].message == "7 -12345678901 2.50 true x");
+
+		// Anything that points elsewhere is formatted on the spot
+		const std::string name = "player";
+		TOAST_TRACE("LogTest", "hello {} {}", name, 3);
+		assert(capture.count() == 2);
+		assert(capture.deferredCount() == 1);
+		assert(capture.entries()[1].message == "hello player 3");
+	}
+
+	// Filtered calls don't evaluate their arguments, whether at compile time or at run time
+	{
+		LogCapture capture;
+		compiledOutTrace();
+		assert(log_side_effects == 0);
+		assert(capture.count() == 0);
+
+		logging::setLevel("LogTest", 2);
+		assert(logging::level("LogTest") == 2);
+		assert(logging::level("Other") == 0);
+		TOAST_TRACE("LogTest", "dropped {}", sideEffect());
+		TOAST_INFO("LogTest", "dropped {}", sideEffect());
+		assert(log_side_effects == 0);
+		TOAST_WARN("LogTest", "kept {}", sideEffect());
+		TOAST_TRACE("Other", "kept {}", sideEffect());
+		assert(log_side_effects == 2);
+		assert(capture.count() == 2);
+
+		// The global level covers every sink without one of its own
+		logging::setLevel(1);
+		TOAST_TRACE("Other", "dropped");
+		TOAST_INFO("Other", "kept");
+		logging::resetLevel("LogTest");
+		assert(logging::level("LogTest") == 1);
+		TOAST_INFO("LogTest", "kept");
+		logging::setLevel(0);
+		assert(capture.count() == 4);
+
+		// A sink can also sit below the global level
+		logging::setLevel(3);
+		logging::setLevel("LogTest", 0);
+		TOAST_TRACE("LogTest", "kept");
+		TOAST_WARN("Other", "dropped");
+		logging::resetLevel("LogTest");
+		logging::setLevel(0);
+		assert(capture.count() == 5);
+	}
+
+	// The capture keeps the newest messages and counts the rest
+	{
+		LogCapture capture(4);
+		for (int i = 0; i < 10; ++i) {
+			TOAST_TRACE("LogTest", "message {}", i);
+		}
+		assert(capture.count() == 10);
+		const auto entries = capture.entries();
+		assert(entries.size() == 4);
+		assert(entries.front().message == "message 6");
+		assert(entries.back().message == "message 9");
+	}
+}
@@ -0,0 +1,160 @@
+#include "test_registry.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <span>
+#include <string>
+#include <thread>
+#include <toast/log_file.hpp>
+#include <toast/log_ring.hpp>
+#include <vector>
+
+using logging::LogRing;
+
+namespace {
+
+auto readLogFile(const std::filesystem::path& path) -> std::vector<std::byte> {
+	std::ifstream file(path, std::ios::binary);
+	std::vector<char> chars {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+	std::vector<std::byte> bytes(chars.size());
+	std::memcpy(bytes.data(), chars.data(), chars.size());
+	return bytes;
+}
+
+}
+
+TOAST_TEST_NAMED("Engine", "engine/05-log_ring", test_engine_05_log_ring) {
+	// One thread pushing as fast as it can against one popping: entries come out in order, and
+	// every entry is either received or counted as dropped
+	{
+		LogRing ring(1024);
+		assert(ring.capacity() == 1024);
+		constexpr uint64_t count = 200000;
+
+		std::thread producer([&ring] {
+			for (uint64_t i = 0; i < count; ++i) {
+				// Vary the size so entries keep wrapping around the end of the buffer
+				std::byte payload[sizeof(uint64_t) + 7] {};
+				std::memcpy(payload, &i, sizeof(i));
+				ring.push(LogRing::Kind::record, std::span(payload, sizeof(uint64_t) + i % 8));
+			}
+			ring.retire();
+		});
+
+		uint64_t received = 0;
+		uint64_t dropped = 0;
+		uint64_t last = 0;
+		std::vector<std::byte> payload;
+		LogRing::Kind kind {};
+		while (true) {
+			const bool retired = ring.retired();
+			while (ring.pop(kind, payload)) {
+				assert(kind == LogRing::Kind::record);
+				uint64_t value = 0;
+				std::memcpy(&value, payload.data(), sizeof(value));
+				assert(payload.size() == sizeof(uint64_t) + value % 8);
+				assert(received == 0 or value > last);
+				last = value;
+				++received;
+			}
+			dropped += ring.takeDropped();
+			if (retired and ring.empty()) {
+				break;
+			}
+		}
+		producer.join();
+		dropped += ring.takeDropped();
+		assert(received + dropped == count);
+		assert(ring.empty());
+	}
+
+	// A full ring refuses the entry without touching what it holds
+	{
+		LogRing ring(64);
+		const std::byte payload[16] {};
+		int pushed = 0;
+		while (ring.push(LogRing::Kind::deferred, payload)) {
+			++pushed;
+		}
+		assert(pushed == 64 / static_cast<int>(LogRing::entry_header_size + sizeof(payload)));
+		assert(ring.takeDropped() == 1);
+		assert(ring.takeDropped() == 0);
+
+		std::vector<std::byte> out;
+		LogRing::Kind kind {};
+		assert(ring.pop(kind, out));
+		assert(kind == LogRing::Kind::deferred and out.size() == sizeof(payload));
+		assert(ring.push(LogRing::Kind::record, payload));
+	}
+
+	// Records survive encoding, long sinks are cut, and a truncated buffer decodes nothing
+	{
+		const std::string long_sink(300, 's');
+		std::vector<std::byte> bytes;
+		logging::encodeLogRecord({.timestamp = -5, .line = 42, .severity = 3, .sink = "Audio", .file = "a.cpp", .message = "hi"}, bytes);
+		logging::encodeLogRecord({.timestamp = 7, .line = 1, .severity = 0, .sink = long_sink, .file = "", .message = ""}, bytes);
+
+		size_t offset = 0;
+		const auto first = logging::decodeLogRecord(bytes, offset);
+		assert(first and first->timestamp == -5 and first->line == 42 and first->severity == 3);
+		assert(first->sink == "Audio" and first->file == "a.cpp" and first->message == "hi");
+		assert(offset == logging::log_record_header_size + 5 + 5 + 2);
+
+		const auto second = logging::decodeLogRecord(bytes, offset);
+		assert(second and second->sink.size() == 255 and second->message.empty());
+		assert(offset == bytes.size());
+		assert(not logging::decodeLogRecord(bytes, offset));
+
+		size_t partial = 0;
+		assert(not logging::decodeLogRecord(std::span(bytes).first(30), partial));
+		assert(partial == 0);
+	}
+
+	// The file sink rotates by size and keeps a fixed number of files
+	{
+		const auto directory = std::filesystem::temp_directory_path() / "toast_log_file_test";
+		std::filesystem::remove_all(directory);
+
+		std::vector<std::byte> record;
+		logging::encodeLogRecord({.timestamp = 1, .line = 2, .severity = 1, .sink = "Test", .file = "t.cpp", .message = "0123456789"}, record);
+		const size_t per_file = 4;
+		{
+			logging::LogFileSink sink(directory, "engine", logging::log_file_header_size + per_file * record.size(), 3);
+			assert(sink.isOpen());
+			assert(sink.path() == directory / "engine.tlog");
+			for (size_t i = 0; i < per_file * 4 + 1; ++i) {
+				sink.write(record);
+			}
+			sink.flush();
+		}
+		assert(std::filesystem::exists(directory / "engine.tlog"));
+		assert(std::filesystem::exists(directory / "engine.1.tlog"));
+		assert(std::filesystem::exists(directory / "engine.2.tlog"));
+		assert(not std::filesystem::exists(directory / "engine.3.tlog"));
+
+		const auto full = readLogFile(directory / "engine.1.tlog");
+		assert(std::memcmp(full.data(), logging::logFileHeader().data(), logging::log_file_header_size) == 0);
+		size_t offset = logging::log_file_header_size;
+		size_t records = 0;
+		while (const auto decoded = logging::decodeLogRecord(full, offset)) {
+			assert(decoded->message == "0123456789" and decoded->sink == "Test");
+			++records;
+		}
+		assert(records == per_file and offset == full.size());
+		assert(readLogFile(directory / "engine.tlog").size() == logging::log_file_header_size + record.size());
+
+		// Opening again keeps the last run's file as the newest rotated one
+		{
+			logging::LogFileSink sink(directory, "engine", 1024, 3);
+		}
+		assert(readLogFile(directory / "engine.1.tlog").size() == logging::log_file_header_size + record.size());
+		assert(readLogFile(directory / "engine.tlog").size() == logging::log_file_header_size);
+
+		std::filesystem::remove_all(directory);
+	}
+}
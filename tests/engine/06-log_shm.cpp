@@ -0,0 +1,158 @@
+#include "test_registry.hpp"
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <thread>
+#include <toast/log_file.hpp>
+#include <toast/log_shm.hpp>
+#include <vector>
+
+using logging::LogShmReader;
+using logging::LogShmWriter;
+
+namespace {
+
+// Record i has timestamp i and says so in its message, which varies in length so entries keep
+// landing on different offsets and wrapping with padding
+void writeShmRecord(LogShmWriter& writer, int64_t i, std::vector<std::byte>& scratch) {
+	const std::string message = "record " + std::to_string(i) + std::string(static_cast<size_t>(i % 13), '.');
+	scratch.clear();
+	logging::encodeLogRecord({.timestamp = i, .line = 7, .severity = 1, .sink = "Shm", .file = "shm.cpp", .message = message}, scratch);
+	writer.write(scratch);
+}
+
+// Checks what one read() appended: every record intact and later than the one before it
+auto checkShmRecords(const std::vector<std::byte>& records, int64_t& last) -> uint64_t {
+	uint64_t count = 0;
+	size_t offset = 0;
+	while (const auto record = logging::decodeLogRecord(records, offset)) {
+		assert(record->timestamp > last);
+		assert(record->message.starts_with("record " + std::to_string(record->timestamp)));
+		assert(record->message.size() == 7 + std::to_string(record->timestamp).size() + record->timestamp % 13);
+		assert(record->sink == "Shm" and record->line == 7);
+		last = record->timestamp;
+		++count;
+	}
+	assert(offset == records.size());
+	return count;
+}
+
+}
+
+TOAST_TEST_NAMED("Engine", "engine/06-log_shm", test_engine_06_log_shm) {
+	const auto directory = std::filesystem::temp_directory_path() / "toast_log_shm_test";
+	std::filesystem::remove_all(directory);
+	const auto path = directory / "engine.tshm";
+	std::vector<std::byte> scratch;
+	std::vector<std::byte> records;
+
+	// Nothing there yet: the reader doesn't open and reads nothing
+	{
+		LogShmReader reader(path);
+		assert(not reader.isOpen());
+		assert(reader.read(records).records == 0 and records.empty());
+	}
+
+	// Everything fits: read back in order, nothing lost; a record larger than the ring is refused
+	// and shows up as lost
+	{
+		LogShmWriter writer(path, 64 * 1024);
+		assert(writer.isOpen());
+		LogShmReader reader(path);
+		assert(reader.isOpen());
+
+		for (int64_t i = 1; i <= 100; ++i) {
+			writeShmRecord(writer, i, scratch);
+		}
+		auto result = reader.read(records);
+		int64_t last = 0;
+		assert(result.records == 100 and result.lost == 0);
+		assert(checkShmRecords(records, last) == 100 and last == 100);
+
+		records.clear();
+		assert(reader.read(records).records == 0);
+
+		const std::string huge(128 * 1024, 'x');
+		scratch.clear();
+		logging::encodeLogRecord({.timestamp = 101, .sink = "Shm", .message = huge}, scratch);
+		assert(not writer.write(scratch));
+		writeShmRecord(writer, 102, scratch);
+		result = reader.read(records);
+		assert(result.records == 1 and result.lost == 1);
+		assert(checkShmRecords(records, last) == 1 and last == 102);
+	}
+
+	// A reader that shows up late gets what the ring still holds, the newest records, and counts
+	// everything overwritten before it as lost
+	{
+		LogShmWriter writer(path, 4096);
+		for (int64_t i = 1; i <= 1000; ++i) {
+			writeShmRecord(writer, i, scratch);
+		}
+		LogShmReader reader(path);
+		records.clear();
+		const auto result = reader.read(records);
+		assert(result.records > 0 and result.records < 1000);
+		assert(result.records + result.lost == 1000);
+		int64_t last = 1000 - static_cast<int64_t>(result.records);
+		assert(checkShmRecords(records, last) == result.records and last == 1000);
+
+		// A new writer on the same file is a new session; the reader starts over instead of
+		// counting the old sequence numbers against it
+		LogShmWriter restarted(path, 4096);
+		for (int64_t i = 1; i <= 5; ++i) {
+			writeShmRecord(restarted, i, scratch);
+		}
+		records.clear();
+		const auto again = reader.read(records);
+		assert(again.records == 5 and again.lost == 0);
+		last = 0;
+		assert(checkShmRecords(records, last) == 5);
+	}
+
+	// The writer never waits: against a reader that polls with pauses, whatever it can't keep up
+	// with is overwritten, and every record is either received in order or counted as lost
+	{
+		constexpr int64_t count = 200000;
+		LogShmWriter writer(path, 16 * 1024);
+		LogShmReader reader(path);
+		std::atomic<bool> done = false;
+
+		std::thread producer([&writer, &done] {
+			std::vector<std::byte> encoded;
+			for (int64_t i = 1; i <= count; ++i) {
+				writeShmRecord(writer, i, encoded);
+			}
+			done.store(true, std::memory_order_release);
+		});
+
+		uint64_t received = 0;
+		uint64_t lost = 0;
+		int64_t last = 0;
+		for (int poll = 0;; ++poll) {
+			const bool finished = done.load(std::memory_order_acquire);
+			records.clear();
+			const auto result = reader.read(records);
+			assert(checkShmRecords(records, last) == result.records);
+			received += result.records;
+			lost += result.lost;
+			if (finished) {
+				break;
+			}
+			if (poll % 16 == 0) {
+				std::this_thread::sleep_for(std::chrono::microseconds(200));
+			}
+		}
+		producer.join();
+
+		assert(received + lost == count);
+		assert(last == count);    // the newest record is never the one overwritten
+		assert(received > 0);
+	}
+
+	std::filesystem::remove_all(directory);
+}
@@ -10,7 +10,7 @@ struct BasicEvent : event::Event<BasicEvent> { };
 TOAST_TEST_NAMED("events", "events/11-thread-listener", test_events_11_thread_listener) {
 	event::ThreadListener listener;
 	bool called = false;
-	listener.subscribe<BasicEvent>([&called](BasicEvent& e) { called = true; });
+	listener.subscribe<BasicEvent>([&called](const BasicEvent& e) { called = true; });
 
 	event::send<BasicEvent>();
 	event::pollEvents();
@@ -0,0 +1,114 @@
+#include "toast/events/event.hpp"
+#include "toast/events/ffi-channel.hpp"
+#include "toast/window/window_events.hpp"
+
+#include "test_registry.hpp"
+
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <ffi/events.h>
+#include <vector>
+
+namespace {
+
+struct BatchLog {
+	std::vector<uint64_t> fences;
+	std::vector<std::vector<event_record>> records;
+	std::vector<const uint8_t*> data;
+	bool release = true;
+};
+
+void logBatch(const event_batch* batch, void* user_data) noexcept {
+	auto& log = *static_cast<BatchLog*>(user_data);
+	log.fences.push_back(batch->fence);
+	log.records.emplace_back(batch->records, batch->records + batch->count);
+	log.data.push_back(batch->data);
+	if (log.release) {
+		events_batch_release(batch->fence);
+	}
+}
+
+void appendBytes(event::FfiChannel& channel, uint32_t type, std::vector<uint8_t> bytes) {
+	std::memcpy(channel.append(type, bytes.size()), bytes.data(), bytes.size());
+}
+
+}
+
+TOAST_TEST_NAMED("events", "events/12-ffi_channel", test_events_12_ffi_channel) {
+	// Nothing goes out without a callback, and what was collected is dropped
+	{
+		event::FfiChannel channel;
+		appendBytes(channel, 0, {1, 2});
+		assert(not channel.publish());
+		assert(channel.published() == 0);
+	}
+
+	// A whole frame is one call, and a reader holding its fences stalls the channel without losing events
+	{
+		event::FfiChannel channel;
+		BatchLog log {.release = false};
+		channel.setCallback(&logBatch, &log);
+		assert(not channel.publish());    // empty frames aren't sent
+
+		appendBytes(channel, 3, {1, 2, 3});
+		appendBytes(channel, 5, {4});
+		assert(channel.publish());
+		assert(log.fences == std::vector<uint64_t> {1});
+		assert(log.records[0].size() == 2);
+		assert(log.records[0][0].type == 3 and log.records[0][0].offset == 0 and log.records[0][0].size == 3);
+		assert(log.records[0][1].type == 5 and log.records[0][1].offset == 3 and log.records[0][1].size == 1);
+		assert(log.data[0][3] == 4);
+
+		appendBytes(channel, 3, {9});
+		assert(channel.publish());
+		appendBytes(channel, 3, {10});
+		assert(not channel.publish());    // the next arena still belongs to fence 1
+		appendBytes(channel, 3, {11});
+		assert(not channel.publish());
+		assert(channel.deferred() == 2);
+		assert(log.data[0][0] == 1 and log.data[0][3] == 4);    // untouched while fenced
+
+		channel.release(1);
+		assert(channel.publish());
+		assert(log.fences.back() == 3);
+		assert(log.records.back().size() == 2);
+		assert(log.data.back()[0] == 10 and log.data.back()[1] == 11);
+	}
+
+	// Through the C API: one serialization per event, however many C# handlers subscribed
+	{
+		event::registerProtoEvents();
+		BatchLog log;
+		events_batch_set_callback(&logBatch, &log);
+		const int type = events_batch_subscribe("proto.events.WindowClose");
+		assert(type >= 0);
+		assert(events_batch_subscribe("proto.events.WindowClose") == type);
+		assert(events_batch_subscribe("proto.events.NotAnEvent") == -1);
+
+		event::send<event::WindowClose>(7u);
+		event::send<event::WindowClose>(300u);
+		event::pollEvents();
+		assert(log.records.size() == 1);
+		assert(log.records[0].size() == 2);
+		assert(log.records[0][0].type == static_cast<uint32_t>(type));
+
+		// protobuf wire format: field 1 varint
+		const uint8_t* first = log.data[0] + log.records[0][0].offset;
+		assert(log.records[0][0].size == 2 and first[0] == 0x08 and first[1] == 7);
+		assert(log.records[0][1].size == 3);
+
+		// Still wanted by the second handler
+		events_batch_unsubscribe("proto.events.WindowClose");
+		event::send<event::WindowClose>(1u);
+		event::pollEvents();
+		assert(log.records.size() == 2);
+
+		events_batch_unsubscribe("proto.events.WindowClose");
+		event::send<event::WindowClose>(1u);
+		event::pollEvents();
+		assert(log.records.size() == 2);
+
+		events_batch_set_callback(nullptr, nullptr);
+	}
+}
@@ -0,0 +1,85 @@
+#include "toast/events/event.hpp"
+#include "toast/events/listener.hpp"
+
+#include "test_registry.hpp"
+
+#include <cassert>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+struct LatestSnapshot : event::Event<LatestSnapshot> {
+	static constexpr auto coalesce = event::Coalesce::latest;
+
+	int value;
+
+	explicit LatestSnapshot(int v) : value(v) { }
+};
+
+struct KeyedSnapshot : event::Event<KeyedSnapshot> {
+	static constexpr auto coalesce = event::Coalesce::by_key;
+
+	uint64_t uid;
+	int value;
+
+	KeyedSnapshot(uint64_t uid, int v) : uid(uid), value(v) { }
+
+	[[nodiscard]]
+	auto coalesceKey() const -> uint64_t {
+		return uid;
+	}
+};
+
+struct PlainMarker : event::Event<PlainMarker> { };
+
+TOAST_TEST_NAMED("events", "events/13-coalesce", test_events_13_coalesce) {
+	event::Listener listener;
+	std::vector<int> latest;
+	std::vector<std::pair<uint64_t, int>> keyed;
+	std::vector<char> order;
+
+	listener.subscribe<LatestSnapshot>([&](LatestSnapshot& e) {
+		latest.push_back(e.value);
+		order.push_back('L');
+	});
+	listener.subscribe<KeyedSnapshot>([&](KeyedSnapshot& e) { keyed.emplace_back(e.uid, e.value); });
+	listener.subscribe<PlainMarker>([&] { order.push_back('P'); });
+
+	// Only the newest one goes out, where the newest send put it
+	const uint64_t latest_before = event::coalesced<LatestSnapshot>();
+	const uint64_t total_before = event::coalescedTotal();
+	event::send<LatestSnapshot>(1);
+	event::send<PlainMarker>();
+	event::send<LatestSnapshot>(2);
+	event::send<LatestSnapshot>(3);
+	event::pollEvents();
+	assert(latest == std::vector<int> {3});
+	assert((order == std::vector<char> {'P', 'L'}));
+	assert(event::coalesced<LatestSnapshot>() == latest_before + 2);
+
+	// One per key
+	const uint64_t keyed_before = event::coalesced<KeyedSnapshot>();
+	event::send<KeyedSnapshot>(1u, 10);
+	event::send<KeyedSnapshot>(2u, 20);
+	event::send<KeyedSnapshot>(1u, 11);
+	event::send<KeyedSnapshot>(3u, 30);
+	event::send<KeyedSnapshot>(2u, 21);
+	event::pollEvents();
+	assert((keyed == std::vector<std::pair<uint64_t, int>> {{1, 11}, {3, 30}, {2, 21}}));
+	assert(event::coalesced<KeyedSnapshot>() == keyed_before + 2);
+	assert(event::coalescedTotal() == total_before + 4);
+
+	// Cycles don't merge: one sent while dispatching belongs to the next poll
+	latest.clear();
+	listener.subscribe<LatestSnapshot>("resend", [&](LatestSnapshot& e) {
+		if (e.value == 4) {
+			event::send<LatestSnapshot>(5);
+		}
+	});
+	event::send<LatestSnapshot>(4);
+	event::pollEvents();
+	assert(latest == std::vector<int> {4});
+	event::pollEvents();
+	assert((latest == std::vector<int> {4, 5}));
+	assert(event::coalesced<LatestSnapshot>() == latest_before + 2);
+}
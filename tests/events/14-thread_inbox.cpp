@@ -0,0 +1,135 @@
+#include "toast/events/event.hpp"
+#include "toast/events/listener.hpp"
+#include "toast/events/thread-listener.hpp"
+
+#include "test_registry.hpp"
+
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+std::atomic<int> inbox_payloads_alive = 0;
+std::atomic<int> inbox_payload_copies = 0;
+}
+
+struct InboxPayload : event::Event<InboxPayload> {
+	uint32_t sender;
+	uint32_t sequence;
+	std::string text;    // long enough to live on the heap, so a read after free shows up under ASan
+
+	InboxPayload(uint32_t sender, uint32_t sequence)
+	    : sender(sender),
+	      sequence(sequence),
+	      text("payload of sender " + std::to_string(sender) + " number " + std::to_string(sequence)) {
+		++inbox_payloads_alive;
+	}
+
+	InboxPayload(const InboxPayload& other) : sender(other.sender), sequence(other.sequence), text(other.text) {
+		++inbox_payloads_alive;
+		++inbox_payload_copies;
+	}
+
+	~InboxPayload() override {
+		--inbox_payloads_alive;
+	}
+};
+
+// Several senders, a main-thread listener and four ThreadListeners polled from their own threads,
+// one of them slow enough to keep several pools alive at once
+TOAST_TEST_NAMED("events", "events/14-thread_inbox", test_events_14_thread_inbox) {
+	constexpr uint32_t senders = 3;
+	constexpr uint32_t sends_per_sender = 3000;
+	constexpr std::size_t workers = 4;
+
+	{
+		event::Listener main_listener;
+		std::atomic<uint32_t> main_received = 0;
+		main_listener.subscribe<InboxPayload>([&](const InboxPayload&) { ++main_received; }, 1);
+
+		struct Worker {
+			event::ThreadListener listener;
+			std::array<int64_t, senders> last {-1, -1, -1};
+			uint32_t received = 0;
+			bool in_order = true;
+			bool intact = true;
+		};
+
+		std::vector<std::unique_ptr<Worker>> state;
+		for (std::size_t w = 0; w < workers; ++w) {
+			auto& worker = *state.emplace_back(std::make_unique<Worker>());
+			worker.listener.subscribe<InboxPayload>([&worker, w](const InboxPayload& e) {
+				worker.in_order = worker.in_order and static_cast<int64_t>(e.sequence) > worker.last[e.sender];
+				worker.last[e.sender] = e.sequence;
+				worker.intact = worker.intact and e.text.ends_with(" number " + std::to_string(e.sequence));
+				++worker.received;
+				if (w == 0 and e.sequence % 500 == 0) {
+					std::this_thread::sleep_for(std::chrono::milliseconds(1));
+				}
+			});
+		}
+
+		std::atomic<bool> stop = false;
+		std::vector<std::thread> worker_threads;
+		for (auto& worker : state) {
+			worker_threads.emplace_back([&stop, &worker] {
+				while (not stop.load(std::memory_order_acquire)) {
+					worker->listener.pollEvents();
+				}
+				worker->listener.pollEvents();
+			});
+		}
+
+		std::atomic<uint32_t> senders_running = senders;
+		std::vector<std::thread> sender_threads;
+		for (uint32_t s = 0; s < senders; ++s) {
+			sender_threads.emplace_back([s, &senders_running] {
+				for (uint32_t i = 0; i < sends_per_sender; ++i) {
+					event::send<InboxPayload>(s, i);
+				}
+				--senders_running;
+			});
+		}
+
+		while (senders_running.load() > 0) {
+			event::pollEvents();
+		}
+		for (auto& sender : sender_threads) {
+			sender.join();
+		}
+		event::pollEvents();
+
+		stop.store(true, std::memory_order_release);
+		for (auto& thread : worker_threads) {
+			thread.join();
+		}
+
+		constexpr uint32_t total = senders * sends_per_sender;
+		assert(main_received == total);
+		for (const auto& worker : state) {
+			assert(worker->received == total);
+			assert(worker->in_order);
+			assert(worker->intact);
+		}
+		assert(inbox_payload_copies == 0);
+		assert(inbox_payloads_alive == 0);    // every pool went back once the last worker polled
+	}
+	event::pollEvents();    // deletes the workers' recievers
+
+	// A listener that never polls again doesn't leak what was handed to it
+	{
+		event::ThreadListener idle;
+		idle.subscribe<InboxPayload>([] { });
+		event::send<InboxPayload>(0u, 0u);
+		event::pollEvents();
+		assert(inbox_payloads_alive == 1);
+	}
+	event::pollEvents();
+	assert(inbox_payloads_alive == 0);
+}
@@ -0,0 +1,94 @@
+#include "toast/events/event.hpp"
+#include "toast/events/listener.hpp"
+#include "toast/events/thread-listener.hpp"
+
+#include "test_registry.hpp"
+
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+struct FirstIdEvent : event::Event<FirstIdEvent> { };
+
+struct SecondIdEvent : event::Event<SecondIdEvent> {
+	int value;
+
+	explicit SecondIdEvent(int v) : value(v) { }
+};
+
+struct RacedIdEvent : event::Event<RacedIdEvent> { };
+
+TOAST_TEST_NAMED("events", "events/15-type_ids", test_events_15_type_ids) {
+	// Ids are handed out in the order types are first used, with no gaps
+	const uint32_t before = event::EventSystem::typeCount();
+	const uint32_t first = FirstIdEvent::id();
+	const uint32_t second = SecondIdEvent::id();
+	assert(first == before);
+	assert(second == before + 1);
+	assert(event::EventSystem::typeCount() == before + 2);
+	assert(FirstIdEvent::id() == first);    // asking again doesn't register again
+	assert(event::EventSystem::typeCount() == before + 2);
+
+	// The dynamic type's id comes through the base without a typeid()
+	const SecondIdEvent instance(1);
+	const event::_detail::IEvent& base = instance;
+	assert(base.eventId() == second);
+
+	// Callbacks land in the channel at the type's index, and dispatch reaches them through it
+	{
+		event::Listener listener;
+		int sum = 0;
+		listener.subscribe<SecondIdEvent>([&sum](SecondIdEvent& e) { sum += e.value; });
+		listener.subscribe<SecondIdEvent>("named", [&sum](SecondIdEvent& e) { sum += e.value * 10; });
+		assert(event::EventSystem::channels[second].callbacks.size() == 2);
+		assert(event::EventSystem::channels[first].callbacks.empty());
+
+		event::send<SecondIdEvent>(2);
+		event::pollEvents();
+		assert(sum == 22);
+
+		listener.unsubscribe<SecondIdEvent>("named");
+		assert(event::EventSystem::channels[second].callbacks.size() == 1);
+		event::send<SecondIdEvent>(3);
+		event::pollEvents();
+		assert(sum == 25);
+	}
+	assert(event::EventSystem::channels[second].callbacks.empty());
+
+	// ThreadListeners match events to callbacks by id as well
+	{
+		event::ThreadListener listener;
+		int firsts = 0;
+		int seconds = 0;
+		listener.subscribe<FirstIdEvent>([&firsts] { ++firsts; });
+		listener.subscribe<SecondIdEvent>([&seconds] { ++seconds; });
+		event::send<FirstIdEvent>();
+		event::send<SecondIdEvent>(0);
+		event::send<SecondIdEvent>(0);
+		event::pollEvents();
+		listener.pollEvents();
+		assert(firsts == 1 and seconds == 2);
+	}
+	event::pollEvents();
+
+	// A type first used from several threads at once still gets exactly one id
+	std::atomic<bool> go = false;
+	std::vector<uint32_t> seen(8);
+	std::vector<std::thread> threads;
+	for (std::size_t i = 0; i < seen.size(); ++i) {
+		threads.emplace_back([&go, &seen, i] {
+			while (not go.load()) { }
+			seen[i] = RacedIdEvent::id();
+		});
+	}
+	go.store(true);
+	for (auto& thread : threads) {
+		thread.join();
+	}
+	for (const uint32_t id : seen) {
+		assert(id == before + 2);
+	}
+	assert(event::EventSystem::typeCount() == before + 3);
+}
@@ -0,0 +1,76 @@
+#include "toast/events/event.hpp"
+#include "toast/events/listener.hpp"
+
+#include "test_registry.hpp"
+
+#include <cassert>
+#include <string>
+
+struct RunEvent : event::Event<RunEvent> {
+	int value;
+
+	explicit RunEvent(int v) : value(v) { }
+};
+
+struct OtherRunEvent : event::Event<OtherRunEvent> { };
+
+struct LatestRunEvent : event::Event<LatestRunEvent> {
+	static constexpr auto coalesce = event::Coalesce::latest;
+
+	int value;
+
+	explicit LatestRunEvent(int v) : value(v) { }
+};
+
+TOAST_TEST_NAMED("events", "events/16-batched_dispatch", test_events_16_batched_dispatch) {
+	event::Listener listener;
+	std::string order;
+
+	// Runs of one type go out together, but never ahead of an event of another type sent before them
+	listener.subscribe<RunEvent>([&](RunEvent& e) { order += std::to_string(e.value); });
+	listener.subscribe<OtherRunEvent>([&] { order += 'o'; });
+	listener.subscribe<LatestRunEvent>([&](LatestRunEvent& e) { order += "l" + std::to_string(e.value); });
+
+	event::send<RunEvent>(1);
+	event::send<RunEvent>(2);
+	event::send<OtherRunEvent>();
+	event::send<RunEvent>(3);
+	event::send<OtherRunEvent>();
+	event::send<OtherRunEvent>();
+	event::pollEvents();
+	assert(order == "12o3oo");
+
+	// A coalesced event dropped in the middle of a run doesn't split or reorder it
+	order.clear();
+	event::send<RunEvent>(1);
+	event::send<LatestRunEvent>(1);
+	event::send<RunEvent>(2);
+	event::send<LatestRunEvent>(2);
+	event::send<RunEvent>(3);
+	event::pollEvents();
+	assert(order == "12l23");
+
+	// Consuming stops the callbacks for that one event, not for the rest of its run
+	order.clear();
+	listener.subscribe<RunEvent>("consume", [](RunEvent& e) { return e.value == 2; }, 1);
+	event::send<RunEvent>(1);
+	event::send<RunEvent>(2);
+	event::send<RunEvent>(3);
+	event::pollEvents();
+	assert(order == "13");
+	listener.unsubscribe<RunEvent>("consume");
+
+	// A callback subscribed while handling one event of a run sees the next one in the same run
+	order.clear();
+	bool subscribed = false;
+	listener.subscribe<RunEvent>("late", [&] {
+		if (not subscribed) {
+			subscribed = true;
+			listener.subscribe<RunEvent>("added", [&](RunEvent& e) { order += "+" + std::to_string(e.value); }, -1);
+		}
+	});
+	event::send<RunEvent>(1);
+	event::send<RunEvent>(2);
+	event::pollEvents();
+	assert(order == "12+2");
+}
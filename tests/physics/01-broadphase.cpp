@@ -0,0 +1,113 @@
+#include "test_registry.hpp"
+
+#include <cassert>
+#include <random>
+#include <toast/physics/broadphase.hpp>
+#include <toast/physics/cpu_backend.hpp>
+#include <vector>
+
+using namespace physics;
+
+namespace {
+
+auto bruteForcePairs(const std::vector<Aabb>& bounds) -> std::vector<BroadphasePair> {
+	std::vector<BroadphasePair> pairs;
+	for (uint32_t i = 0; i < bounds.size(); ++i) {
+		for (uint32_t j = i + 1; j < bounds.size(); ++j) {
+			if (bounds[i].overlaps(bounds[j])) {
+				pairs.push_back({i, j});
+			}
+		}
+	}
+	return pairs;
+}
+
+auto randomBoxes(std::mt19937& rng, size_t count, glm::vec3 area) -> std::vector<Aabb> {
+	std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+	std::vector<Aabb> bounds(count);
+	for (Aabb& box : bounds) {
+		const glm::vec3 center = glm::vec3 {unit(rng), unit(rng), unit(rng)} * area;
+		const glm::vec3 half = glm::vec3 {unit(rng), unit(rng), unit(rng)} * 1.5f + 0.25f;
+		box = {center - half, center + half};
+	}
+	return bounds;
+}
+
+}
+
+TOAST_TEST_NAMED("Physics", "physics/01-broadphase", test_physics_01_broadphase) {
+	std::mt19937 rng(1234);
+	SweepAndPrune sap;
+	std::vector<BroadphasePair> pairs;
+
+	// Fresh sort, then coherent frames that go through the insertion sort
+	std::vector<Aabb> bounds = randomBoxes(rng, 1500, {60.0f, 60.0f, 60.0f});
+	std::uniform_real_distribution<float> jitter(-0.3f, 0.3f);
+	for (int frame = 0; frame < 20; ++frame) {
+		sap.findPairs(bounds, pairs);
+		assert(not pairs.empty());
+		assert(pairs == bruteForcePairs(bounds));
+
+		for (Aabb& box : bounds) {
+			const glm::vec3 offset {jitter(rng), jitter(rng), jitter(rng)};
+			box.min += offset;
+			box.max += offset;
+		}
+	}
+
+	// A level spread along y switches the sweep axis and still finds the same pairs
+	bounds = randomBoxes(rng, 1500, {4.0f, 400.0f, 4.0f});
+	sap.findPairs(bounds, pairs);
+	assert(sap.axis() == 1);
+	assert(pairs == bruteForcePairs(bounds));
+
+	// Touching faces count as overlapping; degenerate inputs give nothing
+	assert((Aabb {{0, 0, 0}, {1, 1, 1}}.overlaps(Aabb {{1, 0, 0}, {2, 1, 1}})));
+	sap.findPairs(std::vector<Aabb> {{}}, pairs);
+	assert(pairs.empty());
+
+	// Sphere dropped on a static box floor comes to rest on top of it
+	{
+		PhysicsState state;
+		state.bodies.push_back({.position = {0, 0, -0.5f}, .extents = {10, 10, 0.5f}, .shape = ShapeType::box});
+		state.bodies.push_back({.position = {0, 0, 3}, .extents = {0.5f, 0, 0}, .inv_mass = 1.0f, .shape = ShapeType::sphere});
+
+		CpuPhysicsBackend backend;
+		size_t contacts = 0;
+		for (int i = 0; i < 480; ++i) {
+			state.contacts.clear();
+			backend.step(state, 1.0f / 120.0f);
+			contacts += state.contacts.size();
+		}
+
+		const PhysicsBody& ball = state.bodies[1];
+		assert(contacts > 0);
+		assert(ball.position.z > 0.45f and ball.position.z < 0.5f);
+		assert(glm::abs(ball.velocity.z) < 0.1f);
+		assert(state.bodies[0].position == glm::vec3(0, 0, -0.5f));
+	}
+
+	// Triggers report the overlap and never push
+	{
+		const PhysicsBody trigger {.extents = {1, 1, 1}, .shape = ShapeType::box, .trigger = true};
+		const PhysicsBody inside {.position = {0.2f, 0, 0}, .extents = {0.5f, 0, 0}, .inv_mass = 1.0f};
+		PhysicsState state;
+		state.gravity = {};
+		state.bodies = {trigger, inside};
+
+		CpuPhysicsBackend backend;
+		backend.step(state, 1.0f / 60.0f);
+		assert(state.contacts.size() == 1);
+		assert(state.bodies[1].position == inside.position);
+	}
+
+	// A sphere whose center is inside a box leaves through the nearest face
+	{
+		const PhysicsBody sphere {.position = {0.8f, 0, 0}, .extents = {0.25f, 0, 0}};
+		const PhysicsBody box {.extents = {1, 1, 1}, .shape = ShapeType::box};
+		Contact contact;
+		assert(collide(sphere, box, contact));
+		assert(contact.normal == glm::vec3(-1, 0, 0));
+		assert(contact.depth > 0.44f and contact.depth < 0.46f);
+	}
+}
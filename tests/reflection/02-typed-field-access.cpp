@@ -0,0 +1,75 @@
+#include "../test_registry.hpp"
+
+#include <any>
+#include <cassert>
+#include <cstdint>
+#include <toast/world/node_3d.hpp>
+
+using namespace toast;
+
+namespace {
+struct TestObject {
+	uint16_t count = 0;
+	float speed = 0.0f;
+};
+
+struct CountTag {
+	using type = uint16_t TestObject::*;
+};
+
+struct SpeedTag {
+	using type = float TestObject::*;
+};
+}
+
+TOAST_TEST_NAMED("reflection", "reflection/02-typed-field-access", test_reflection_02_typed_field_access) {
+	_detail::Accessor<CountTag>::member = &TestObject::count;
+	_detail::Accessor<SpeedTag>::member = &TestObject::speed;
+
+	// Integers of any width narrow into the member
+	TestObject object;
+	FieldAccess<TestObject, uint16_t, CountTag>::set(&object, std::any {7});
+	assert(object.count == 7);
+	FieldAccess<TestObject, uint16_t, CountTag>::set(&object, std::any {static_cast<unsigned char>(9)});
+	assert(object.count == 9);
+	FieldAccess<TestObject, uint16_t, CountTag>::set(&object, std::any {1.5f});
+	assert(object.count == 9);
+
+	const FieldInfo speed {
+	  .name = "speed",
+	  .type = "float",
+	  .value_type = FieldType::float_t,
+	  .attributes = {},
+	  .get = &FieldAccess<TestObject, float, SpeedTag>::get,
+	  .set = &FieldAccess<TestObject, float, SpeedTag>::set,
+	  .flags = FieldFlags::read_only,
+	  .type_id = &typeid(float),
+	  .address = &_detail::memberAddress<TestObject, SpeedTag>,
+	};
+
+	float* direct = speed.typed<float>(&object);
+	assert(direct == &object.speed);
+	*direct = 4.0f;
+	assert(std::any_cast<float>(speed.get(&object)) == 4.0f);
+	assert(speed.typed<double>(&object) == nullptr);
+	assert(speed.hasFlag(FieldFlags::transient));
+	assert(!speed.hasFlag(FieldFlags::hidden));
+
+	// Generated fields carry the same data
+	const NodeInfo* info = NodeRegistry::reflect("toast::Node3D");
+	assert(info != nullptr);
+	const FieldInfo* world_position = info->getField("world_position");
+	assert(world_position != nullptr);
+	assert(world_position->hasFlag(FieldFlags::no_serialize));
+	assert(world_position->hasAttribute("NoSerialize"));
+
+	const FieldInfo* position = info->getField("position");
+	assert(position != nullptr);
+	assert(!position->hasFlag(FieldFlags::transient));
+
+	Node* node = info->construct();
+	auto* typed_position = position->typed<glm::vec3>(node);
+	assert(typed_position == &static_cast<Node3D*>(node)->position);
+	assert(position->typed<glm::vec4>(node) == nullptr);
+	info->destroy(node);
+}
@@ -0,0 +1,120 @@
+#include "test_registry.hpp"
+#include "toast/world/world_test_access.hpp"
+
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <span>
+#include <toast/time.hpp>
+#include <toast/world/node_3d.hpp>
+#include <vector>
+
+using namespace toast;
+using WorldTestAccess = toast::_detail::WorldTestAccess;
+
+namespace {
+
+constexpr double rate = 60.0;
+constexpr double step = 1.0 / rate;
+constexpr uint32_t total_steps = 600;
+
+// Spring pulling a Node3D towards the origin, integrated only inside fixed steps
+struct Simulation {
+	Box<Node3D> body;
+	glm::vec3 velocity {0.0f, 4.0f, 0.0f};
+	std::vector<glm::mat4> states;    ///< body transform after every step
+
+	void tick(float dt) {
+		const glm::vec3 force = -12.0f * body->position - 0.5f * velocity;
+		velocity += force * dt;
+		body->position += velocity * dt;
+		body->rotation = glm::normalize(glm::angleAxis(dt, glm::vec3 {0.0f, 0.0f, 1.0f}) * body->rotation);
+		body->syncTransform();
+		states.push_back(body->getWorldTransform());
+	}
+};
+
+Simulation* fixed_step_simulation = nullptr;
+
+// Feeds frame times (cycled) through Time and the World until total_steps steps ran; a node in
+// the tick stage advances the simulation, so it only moves when Time hands out a step
+auto simulate(std::span<const double> frames) -> std::vector<glm::mat4> {
+	auto world = WorldTestAccess::createWorld();
+	auto time = WorldTestAccess::createTime();
+	Time::setFixedRate(rate);
+	Time::setMaxSteps(8);
+
+	Simulation sim {WorldTestAccess::allocateNode(*world, "toast::Node3D").as<Node3D>()};
+	sim.body->position = {3.0f, 0.0f, 1.0f};
+	fixed_step_simulation = &sim;
+
+	Box<Node> ticker = WorldTestAccess::createNode(*world, "fixed_step_ticker");
+	WorldTestAccess::addTickStage(*ticker, TickFunctionList::tick, [](void*) {
+		assert(Time::delta() == step);
+		fixed_step_simulation->tick(static_cast<float>(Time::delta()));
+	});
+	WorldTestAccess::computeDependencyGraph(*world);
+
+	double fed = 0.0;
+	for (size_t frame = 0; sim.states.size() < total_steps; ++frame) {
+		const double delta = frames[frame % frames.size()];
+		const uint64_t steps_before = Time::step();
+		WorldTestAccess::runFrame(*world, delta);
+		fed += delta;
+
+		assert(Time::step() - steps_before <= 8);
+		assert(sim.states.size() == Time::step());
+		assert(Time::delta() == delta);    // per-frame systems see the frame again once the steps ran
+
+		// The alpha is whatever didn't make a whole step yet
+		const double alpha = (fed - static_cast<double>(Time::step()) * step) / step;
+		assert(Time::alpha() >= 0.0 and Time::alpha() < 1.0);
+		assert(std::abs(Time::alpha() - alpha) < 1e-6);
+	}
+
+	fixed_step_simulation = nullptr;
+	sim.states.resize(total_steps);
+	return sim.states;
+}
+
+}
+
+TOAST_TEST_NAMED("Time", "time/01-fixed-step", test_time_01_fixed_step) {
+	WorldTestAccess::initThreadPool();
+
+	// Every step leaves bit-identical state no matter how frames were sliced
+	const std::vector<double> steady {step};
+	const std::vector<double> fast {1.0 / 240.0};
+	const std::vector<double> slow {1.0 / 24.0};
+	const std::vector<double> jittery {0.004, 0.031, 0.0167, 0.05, 0.0009, 0.022, 0.012};
+
+	const std::vector<glm::mat4> reference = simulate(steady);
+	assert(simulate(fast) == reference);
+	assert(simulate(slow) == reference);
+	assert(simulate(jittery) == reference);
+
+	// A long stall runs at most max_steps and drops the rest instead of spiraling
+	{
+		FixedStepAccumulator clock {.step = 0.125, .max_steps = 4};
+		assert(clock.advance(1.0) == 4);
+		assert(clock.dropped_steps == 4);
+		assert(clock.accumulator == 0.0);
+		assert(clock.advance(0.125) == 1);
+	}
+
+	// The leftover fraction is the render alpha
+	{
+		FixedStepAccumulator clock {.step = 0.1};
+		assert(clock.advance(0.25) == 2);
+		assert(clock.alpha() > 0.49 and clock.alpha() < 0.51);
+		assert(clock.advance(0.0) == 0);
+	}
+
+	// A step of 0 keeps the old variable rate: one step per frame, nothing to interpolate
+	{
+		FixedStepAccumulator clock {.step = 0.0};
+		assert(clock.advance(0.5) == 1);
+		assert(clock.advance(0.0) == 1);
+		assert(clock.alpha() == 1.0);
+	}
+}
@@ -0,0 +1,78 @@
+#include "test_registry.hpp"
+#include "toast/world/world_test_access.hpp"
+
+#include <cassert>
+#include <cstdint>
+#include <toast/world/node_3d.hpp>
+#include <toast/world/node_pool.hpp>
+#include <vector>
+
+using namespace toast;
+using WorldTestAccess = toast::_detail::WorldTestAccess;
+
+TOAST_TEST_NAMED("World", "world/03-node-pool", test_world_03_node_pool) {
+	// Slab pool recycles storage and batches frees
+	{
+		_detail::NodePool pool(48, 16);
+		std::vector<void*> ptrs;
+		for (int i = 0; i < 100; ++i) {
+			void* p = pool.allocate();
+			assert(reinterpret_cast<std::uintptr_t>(p) % 16 == 0);
+			ptrs.push_back(p);
+		}
+		assert(pool.live() == 100);
+		assert(pool.capacity() >= 100);
+
+		void* last = ptrs.back();
+		pool.deallocate(last);
+		assert(pool.allocate() == last);
+
+		{
+			_detail::NodePool::BulkRelease bulk;
+			for (void* p : ptrs) {
+				pool.deallocate(p);
+			}
+			assert(pool.live() == 100);    // deferred until the scope closes
+		}
+		assert(pool.live() == 0);
+	}
+
+	auto world = WorldTestAccess::createWorld();
+	const size_t base = world->nodeCount();
+
+	std::vector<Box<Node>> boxes;
+	for (int i = 0; i < 300; ++i) {
+		boxes.push_back(WorldTestAccess::allocateNode(*world, i % 2 ? "toast::Node3D" : "toast::Node"));
+	}
+	assert(world->nodeCount() == base + 300);
+	assert(boxes[1].as<Node3D>().exists());
+
+	// A Box held outside the tree keeps its ControlBox alive after the node is freed
+	Box<Node> survivor = boxes[7];
+	const auto first_rid = boxes[0].rid();
+
+	std::vector<Node*> victims;
+	for (auto& b : boxes) {
+		victims.push_back(&*b);
+	}
+	boxes.clear();
+	WorldTestAccess::freeNodes(*world, victims);
+
+	assert(not survivor.exists());
+	assert(world->nodeCount() == base + 1);
+
+	survivor = {};
+	WorldTestAccess::reapTombstones(*world);
+	assert(world->nodeCount() == base);
+
+	// Freed slots are reused lowest-first
+	Box<Node> fresh = WorldTestAccess::allocateNode(*world, "toast::Node");
+	assert(fresh.exists());
+	assert(fresh.rid() == first_rid);
+	assert(world->nodeCount() == base + 1);
+
+	Node* raw = &*fresh;
+	fresh = {};
+	WorldTestAccess::freeNodes(*world, {&raw, 1});
+	assert(world->nodeCount() == base);
+}
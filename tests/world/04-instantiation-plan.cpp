@@ -0,0 +1,91 @@
+#include "test_registry.hpp"
+#include "toast/world/world_test_access.hpp"
+
+#include <cassert>
+#include <string>
+#include <toast/assets/prefab.hpp>
+#include <toast/world/instantiation_plan.hpp>
+#include <toast/world/node_3d.hpp>
+
+using namespace toast;
+using WorldTestAccess = toast::_detail::WorldTestAccess;
+
+namespace {
+
+auto makeSource() -> assets::Prefab {
+	assets::Prefab source;
+
+	assets::Prefab::BasicNode root {.name = "plan_root", .type = "toast::Node3D"};
+	root.fields.push_back({"m_uid", FieldType::uid_t, false, UID(UID::fromString("PlanRoot000"))});
+	root.fields.push_back({"m_local_enabled", FieldType::bool_t, false, true});
+	root.fields.push_back({"position", FieldType::vec3_t, false, glm::vec3 {1.0f, 2.0f, 3.0f}});
+	root.fields.push_back({"rotation", FieldType::quaternion_t, false, glm::quat {0.0f, 0.0f, 1.0f, 0.0f}});
+	source.nodes.push_back(std::move(root));
+
+	assets::Prefab::BasicNode child {.name = "plain_child", .type = "toast::Node"};
+	child.fields.push_back({"m_uid", FieldType::uid_t, false, UID(UID::fromString("PlanChild00"))});
+	child.fields.push_back({"m_parent", FieldType::uid_t, false, UID(UID::fromString("PlanRoot000"))});
+	child.fields.push_back({"m_local_enabled", FieldType::bool_t, false, false});
+	source.nodes.push_back(std::move(child));
+
+	assets::Prefab::BasicNode leaf {.name = "scaled_leaf", .type = "toast::Node3D"};
+	leaf.fields.push_back({"m_uid", FieldType::uid_t, false, UID(UID::fromString("PlanLeaf000"))});
+	leaf.fields.push_back({"m_parent", FieldType::uid_t, false, UID(UID::fromString("PlanChild00"))});
+	leaf.fields.push_back({"scale", FieldType::vec3_t, false, glm::vec3 {2.0f, 2.0f, 2.0f}});
+	// NoSerialize fields must be ignored by both paths
+	leaf.fields.push_back({"world_position", FieldType::vec3_t, false, glm::vec3 {9.0f, 9.0f, 9.0f}});
+	source.nodes.push_back(std::move(leaf));
+
+	return source;
+}
+
+auto instantiateAs(World& world, const assets::Handle<assets::Prefab>& handle, bool use_plans) -> std::string {
+	INodeOwner::InstantiateContext context;
+	context.resolver = [](UID) { return assets::Handle<assets::Prefab> {}; };
+	context.use_plans = use_plans;
+
+	Box<Node> root = WorldTestAccess::instantiate(world, handle, context);
+	assert(root.exists());
+	assert(root->name() == "plan root");
+	assert(WorldTestAccess::childrenOf(*root).size() == 1);
+
+	Box<Node3D> leaf = WorldTestAccess::childrenOf(*WorldTestAccess::childrenOf(*root)[0])[0].as<Node3D>();
+	assert(leaf.exists());
+	assert(leaf->world_position == glm::vec3(0.0f));
+
+	return assets::Prefab(*root).toFile();
+}
+
+}
+
+TOAST_TEST_NAMED("World", "world/04-instantiation-plan", test_world_04_instantiation_plan) {
+	assets::Prefab source = makeSource();
+	assets::Handle<assets::Prefab> handle(&source, UID::fromString("PlanSource0"), "");
+	auto world = WorldTestAccess::createWorld();
+
+	const std::string unplanned = instantiateAs(*world, handle, false);
+	assert(source.plan() == nullptr);
+
+	const std::string planned = instantiateAs(*world, handle, true);
+	assert(planned == unplanned);
+
+	// The plan is compiled once and reused by every later instance
+	auto plan = source.plan();
+	assert(plan != nullptr);
+	assert(plan->current());
+	assert(plan->nodes.size() == 3);
+	assert(plan->nodes[0].parent == -1);
+	assert(plan->nodes[1].parent == 0);
+	assert(plan->nodes[2].parent == 1);
+	for (const auto& store : plan->nodes[2].stores) {
+		assert(store.field->name != "world_position");
+	}
+
+	assert(instantiateAs(*world, handle, true) == unplanned);
+	assert(source.plan() == plan);
+
+	source.invalidatePlan();
+	assert(source.plan() == nullptr);
+	assert(instantiateAs(*world, handle, true) == unplanned);
+	assert(source.plan() != nullptr && source.plan() != plan);
+}
@@ -0,0 +1,117 @@
+#include "test_registry.hpp"
+#include "toast/world/world_test_access.hpp"
+
+#include <cassert>
+#include <cstdint>
+#include <string>
+#include <toast/assets/prefab.hpp>
+#include <toast/world/node_3d.hpp>
+#include <vector>
+
+using namespace toast;
+using WorldTestAccess = toast::_detail::WorldTestAccess;
+
+namespace {
+
+constexpr uint64_t inner_asset = 0xA11CE;
+constexpr size_t inner_nodes = 300;
+constexpr size_t outer_children = 400;
+constexpr size_t nested_instances = 4;
+
+// Root followed by a chain of Node3Ds every few entries, so parents aren't all the root
+auto makeInner() -> assets::Prefab {
+	assets::Prefab inner;
+	for (size_t i = 0; i < inner_nodes; ++i) {
+		assets::Prefab::BasicNode node {.name = "inner_" + std::to_string(i), .type = "toast::Node3D"};
+		node.fields.push_back({"m_uid", FieldType::uid_t, false, UID(0x10000 + i)});
+		if (i > 0) {
+			node.fields.push_back({"m_parent", FieldType::uid_t, false, UID(0x10000 + (i - 1) / 8)});
+		}
+		node.fields.push_back({"m_local_enabled", FieldType::bool_t, false, i % 7 != 0});
+		node.fields.push_back({"position", FieldType::vec3_t, false, glm::vec3 {static_cast<float>(i), 1.0f, 2.0f}});
+		inner.nodes.push_back(std::move(node));
+	}
+	return inner;
+}
+
+// Flat level with nested instances spread between the plain children
+auto makeOuter() -> assets::Prefab {
+	assets::Prefab outer;
+	const UID root_uid {0x20000};
+
+	assets::Prefab::BasicNode root {.name = "level", .type = "toast::Node"};
+	root.fields.push_back({"m_uid", FieldType::uid_t, false, root_uid});
+	outer.nodes.push_back(std::move(root));
+
+	for (size_t i = 0; i < outer_children; ++i) {
+		if (i % (outer_children / nested_instances) == 0) {
+			assets::Prefab::BasicNode placement {.name = "placement_" + std::to_string(i), .type = "toast::Node3D"};
+			placement.fields.push_back({"m_uid", FieldType::uid_t, false, UID(0x30000 + i)});
+			placement.fields.push_back({"m_parent", FieldType::uid_t, false, root_uid});
+			placement.fields.push_back({"m_source_prefab", FieldType::uid_t, false, UID(inner_asset)});
+			outer.nodes.push_back(std::move(placement));
+		}
+
+		assets::Prefab::BasicNode child {.name = "prop_" + std::to_string(i), .type = i % 2 ? "toast::Node3D" : "toast::Node"};
+		child.fields.push_back({"m_uid", FieldType::uid_t, false, UID(0x40000 + i)});
+		child.fields.push_back({"m_parent", FieldType::uid_t, false, root_uid});
+		outer.nodes.push_back(std::move(child));
+	}
+	return outer;
+}
+
+struct Snapshot {
+	std::string text;
+	std::vector<uint64_t> slot_order;
+};
+
+auto instantiateAs(World& world, const assets::Handle<assets::Prefab>& outer, assets::Prefab& inner, bool parallel) -> Snapshot {
+	INodeOwner::InstantiateContext context;
+	context.resolver = [&inner](UID uid) {
+		return uid.data() == inner_asset ? assets::Handle<assets::Prefab>(&inner, uid, "") : assets::Handle<assets::Prefab> {};
+	};
+	context.parallel = parallel;
+
+	const size_t before = world.nodeCount();
+	Box<Node> root = WorldTestAccess::instantiate(world, outer, context);
+	assert(root.exists());
+	assert(world.nodeCount() == before + 1 + outer_children + nested_instances * inner_nodes);
+
+	// Nested instance roots take the placement UID and their content is interior
+	const auto& placement = WorldTestAccess::childrenOf(*root)[0];
+	assert(placement->uid().data() == 0x30000);
+	assert(placement->isInstanceRoot());
+	assert(WorldTestAccess::isPrefabInterior(*WorldTestAccess::childrenOf(*placement)[0]));
+
+	Snapshot snapshot {assets::Prefab(*root).toFile(), WorldTestAccess::nodeUids(world)};
+
+	std::vector<Node*> victims;
+	auto collect = [&victims](this auto&& self, Node& node) -> void {
+		victims.push_back(&node);
+		for (const auto& child : WorldTestAccess::childrenOf(node)) {
+			self(const_cast<Node&>(*child));
+		}
+	};
+	collect(*root);
+	root = {};
+	WorldTestAccess::freeNodes(world, victims);
+	assert(world.nodeCount() == before);
+	return snapshot;
+}
+
+}
+
+TOAST_TEST_NAMED("World", "world/05-parallel-instantiate", test_world_05_parallel_instantiate) {
+	assets::Prefab inner = makeInner();
+	assets::Prefab outer = makeOuter();
+	assets::Handle<assets::Prefab> handle(&outer, UID(0xB0B), "");
+	auto world = WorldTestAccess::createWorld();
+
+	// Batches finish in any order, yet the tree, the UIDs and the slot layout match the serial path
+	const Snapshot serial = instantiateAs(*world, handle, inner, false);
+	for (int run = 0; run < 4; ++run) {
+		const Snapshot parallel = instantiateAs(*world, handle, inner, true);
+		assert(parallel.text == serial.text);
+		assert(parallel.slot_order == serial.slot_order);
+	}
+}
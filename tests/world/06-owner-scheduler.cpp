@@ -0,0 +1,171 @@
+#include "test_registry.hpp"
+#include "toast/world/world_test_access.hpp"
+
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <future>
+#include <thread>
+#include <toast/thread_pool.hpp>
+#include <toast/world/owner_scheduler.hpp>
+#include <vector>
+
+using namespace toast;
+using WorldTestAccess = toast::_detail::WorldTestAccess;
+
+namespace {
+
+std::atomic<uint32_t> owner_clock = 0;
+
+// Records when it ticked on a global clock; does nothing else
+class RecordingOwner : public INodeOwner {
+public:
+	uint32_t started = 0;
+	uint32_t finished = 0;
+	uint32_t ticks = 0;
+	std::function<void()> work;
+
+	auto name() -> std::string override {
+		return "RecordingOwner";
+	}
+
+	void tick() override {
+		started = ++owner_clock;
+		if (work) {
+			work();
+		}
+		++ticks;
+		finished = ++owner_clock;
+	}
+
+	[[nodiscard]]
+	auto participatesIn(NodeOwnerParticipation /*use*/) const noexcept -> bool override {
+		return true;
+	}
+
+	void registerDependency(Node& /*from*/, Node& /*to*/) override { }
+	void unregisterDependency(Node& /*from*/, Node& /*to*/) override { }
+
+	auto findFrom(const Node& /*origin*/, std::string_view /*query*/) -> Box<Node> override {
+		return {};
+	}
+
+	auto findFrom(const Node& /*origin*/, const UID& /*uid*/) -> Box<Node> override {
+		return {};
+	}
+
+	auto searchFrom(const Node& /*origin*/, std::string_view /*query*/) -> std::vector<Box<Node>> override {
+		return {};
+	}
+
+protected:
+	void applyActiveCamera() override { }
+};
+
+void tickAll(OwnerScheduler& scheduler, std::span<const OwnerScheduler::Entry> owners) {
+	scheduler.run(owners, [](INodeOwner& owner) { owner.tick(); });
+}
+
+}
+
+TOAST_TEST_NAMED("World", "world/06-owner-scheduler", test_world_06_owner_scheduler) {
+	WorldTestAccess::initThreadPool();
+
+	std::vector<RecordingOwner> owners(4);
+	std::vector<OwnerScheduler::Entry> entries;
+	for (uint64_t i = 0; i < owners.size(); ++i) {
+		entries.push_back({UID(i + 1), &owners[i]});
+	}
+	RecordingOwner& a = owners[0];
+	RecordingOwner& b = owners[1];
+	RecordingOwner& c = owners[2];
+	RecordingOwner& d = owners[3];
+
+	// Independent owners tick at the same time: each waits for the other to show up
+	{
+		OwnerScheduler scheduler;
+		std::atomic<int> arrived = 0;
+		std::atomic<bool> met = true;
+		auto rendezvous = [&arrived, &met] {
+			++arrived;
+			const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+			while (arrived.load() < 2) {
+				if (std::chrono::steady_clock::now() > deadline) {
+					met = false;
+					return;
+				}
+				std::this_thread::yield();
+			}
+		};
+		a.work = rendezvous;
+		b.work = rendezvous;
+
+		tickAll(scheduler, std::span(entries).first(2));
+		assert(scheduler.waves().size() == 1);
+		assert(met);
+		a.work = {};
+		b.work = {};
+	}
+
+	// a, b -> c -> d: c starts only after both a and b finished, d only after c
+	{
+		OwnerScheduler scheduler;
+		scheduler.addDependency(UID(1), UID(3));
+		scheduler.addDependency(UID(2), UID(3));
+		scheduler.addDependency(UID(3), UID(4));
+		scheduler.addDependency(UID(3), UID(4));    // duplicates are ignored
+
+		for (int run = 0; run < 50; ++run) {
+			tickAll(scheduler, entries);
+			assert(c.started > a.finished and c.started > b.finished);
+			assert(d.started > c.finished);
+		}
+		assert((scheduler.waves() == std::vector<std::vector<uint32_t>> {{0, 1}, {2}, {3}}));
+		assert(a.ticks == 50 and b.ticks == 50 and c.ticks == 50 and d.ticks == 50);
+
+		// Destroying c drops its edges; everyone left is independent again
+		scheduler.removeOwner(UID(3));
+		std::vector<OwnerScheduler::Entry> remaining {entries[0], entries[1], entries[3]};
+		tickAll(scheduler, remaining);
+		assert(scheduler.waves().size() == 1);
+	}
+
+	// A cycle still ticks every owner exactly once, one after another
+	{
+		OwnerScheduler scheduler;
+		scheduler.addDependency(UID(1), UID(2));
+		scheduler.addDependency(UID(2), UID(1));
+		const uint32_t before = a.ticks;
+		tickAll(scheduler, entries);
+		assert(a.ticks == before + 1 and b.ticks == before + 1);
+		assert(scheduler.waves().size() == 2 + 1);    // {c, d}, then a and b alone
+		assert(a.finished < b.started);
+	}
+
+	// Owners fanning out their own jobs from inside the pool don't starve it
+	{
+		std::vector<RecordingOwner> busy(12);
+		std::vector<OwnerScheduler::Entry> busy_entries;
+		for (uint64_t i = 0; i < busy.size(); ++i) {
+			busy[i].work = [] {
+				std::vector<std::future<void>> jobs;
+				for (int j = 0; j < 16; ++j) {
+					jobs.emplace_back(ThreadPool::push([] { std::this_thread::sleep_for(std::chrono::microseconds(50)); }));
+				}
+				for (auto& job : jobs) {
+					ThreadPool::wait(job);
+					job.get();
+				}
+			};
+			busy_entries.push_back({UID(100 + i), &busy[i]});
+		}
+
+		OwnerScheduler scheduler;
+		for (int run = 0; run < 10; ++run) {
+			tickAll(scheduler, busy_entries);
+		}
+		for (const RecordingOwner& owner : busy) {
+			assert(owner.ticks == 10);
+		}
+	}
+}
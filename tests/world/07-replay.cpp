@@ -0,0 +1,251 @@
+#include "test_registry.hpp"
+#include "toast/world/world_test_access.hpp"
+
+#include <cassert>
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <string>
+#include <toast/events/listener.hpp>
+#include <toast/input/input_events.hpp>
+#include <toast/input/input_system.hpp>
+#include <toast/replay.hpp>
+#include <toast/time.hpp>
+#include <toast/window/window_events.hpp>
+#include <toast/world/node_3d.hpp>
+
+using namespace toast;
+using WorldTestAccess = toast::_detail::WorldTestAccess;
+
+namespace {
+
+constexpr size_t replay_movers = 16;
+constexpr int replay_frames = 120;
+constexpr uint16_t replay_checkpoint_interval = 10;
+constexpr int replay_push_key = ' ';    // SDLK_SPACE, what "keyboard/space" binds to
+
+constexpr uint64_t level_asset = 0x7100;
+constexpr uint64_t crate_asset = 0x7200;
+constexpr uint64_t push_asset = 0x7300;
+constexpr uint64_t level_root = 0x7400;
+constexpr uint64_t crate_root = 0x7500;
+
+void writeFile(const std::filesystem::path& path, std::string_view contents) {
+	std::ofstream out(path, std::ios::binary | std::ios::trunc);
+	assert(out.is_open());
+	out.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+}
+
+// A level of Node3D movers, a crate prefab spawned at runtime and an action on the space bar
+void writeAssets(const std::filesystem::path& assets_dir, const std::filesystem::path& cache_dir) {
+	std::string level =
+	    std::format("~format @int = 2\n\n[level type=toast::Node3D]\nm_uid @uid = {}\n", UID::toString(level_root));
+	for (size_t i = 0; i < replay_movers; ++i) {
+		level += std::format(
+		    "\n[mover_{} type=toast::Node3D]\nm_uid @uid = {}\nm_parent @uid = {}\nposition @vec3 = {} 0 0\n",
+		    i,
+		    UID::toString(level_root + 1 + i),
+		    UID::toString(level_root),
+		    i
+		);
+	}
+	writeFile(assets_dir / "level.node", level);
+	writeFile(
+	    assets_dir / "crate.node",
+	    std::format("~format @int = 2\n\n[crate type=toast::Node3D]\nm_uid @uid = {}\n", UID::toString(crate_root))
+	);
+	writeFile(
+	    assets_dir / "push.action",
+	    "name = \"push\"\n"
+	    "function_name = \"onPush\"\n"
+	    "type = \"Action0D\"\n"
+	    "accumulation = true\n"
+	    "[[bind]]\n"
+	    "keycode = \"keyboard/space\"\n"
+	    "[[bind.trigger]]\n"
+	    "name = \"start\"\n"
+	    "threshold = 0.5\n"
+	    "value = true\n"
+	    "countdown = 0\n"
+	);
+	writeFile(
+	    cache_dir / "database.json",
+	    std::format(
+	        R"({{"node":{{"{}":"assets://level.node","{}":"assets://crate.node"}},"input_action":{{"{}":"assets://push.action"}}}})",
+	        UID::toString(level_asset),
+	        UID::toString(crate_asset),
+	        UID::toString(push_asset)
+	    )
+	);
+}
+
+struct ReplayRun;
+ReplayRun* replay_run = nullptr;
+
+// One run of the scene: the world, its clock and input, and the gameplay reacting to them. A recording
+// and each playback get a fresh one, so nothing carries over but the replay file
+struct ReplayRun {
+	WorldTestAccess::WorldPtr world = WorldTestAccess::createWorld();
+	std::unique_ptr<Time> time = WorldTestAccess::createTime();
+	input::InputSystem input;
+	event::Listener listener;
+	Box<Node> driver;
+	float push = 1.0f;    ///< x speed of everything under the level; each press of the push action flips it
+	bool key_down = false;
+	int pushes = 0;
+	int destroyed = 0;
+
+	ReplayRun() {
+		listener.subscribe<event::InputEvent>([this](const event::InputEvent& e) {
+			if (e.type == input::ActionEvent::start) {
+				push = -push;
+				++pushes;
+			}
+			return false;
+		});
+
+		// Gameplay runs inside the fixed steps, so it only moves as far as Time lets it
+		driver = WorldTestAccess::createNode(*world, "replay_driver");
+		replay_run = this;
+		WorldTestAccess::addTickStage(*driver, TickFunctionList::tick, [](void*) { replay_run->tick(); });
+		WorldTestAccess::computeDependencyGraph(*world);
+
+		// The level lands through the load queue on the first frame
+		World::loadNode(UID(level_asset), true);
+		WorldTestAccess::waitForLoads(*world);
+	}
+
+	~ReplayRun() {
+		// Queued input events point at the actions this run owns
+		event::pollEvents();
+		replay_run = nullptr;
+	}
+
+	void tick() {
+		Box<Node> level = WorldTestAccess::findNode(UID(level_root));
+		if (not level.exists()) {
+			return;
+		}
+		for (const auto& child : WorldTestAccess::childrenOf(*level)) {
+			auto& node = dynamic_cast<Node3D&>(const_cast<Node&>(*child));
+			node.position.x += push * static_cast<float>(Time::delta());
+		}
+	}
+
+	// Live runs roll the dice for the frame time and the push key; playback passes nothing and relies on
+	// the replay to supply both. Spawns and destroys follow from the frame number and what's in the tree,
+	// so a faithful playback asks for them on the frames the recording did
+	void frame(int frame, std::mt19937* live, bool destroy = true) {
+		std::uniform_real_distribution<double> frame_delta(0.004, 0.033);
+		double delta = 0.0;
+		if (live) {
+			delta = frame_delta(*live);
+			if ((*live)() % 5 == 0) {
+				key_down = not key_down;
+				event::send<event::WindowKey>(
+				    replay_push_key, 0, key_down ? event::window_input_pressed : event::window_input_released, 0
+				);
+			}
+		}
+		WorldTestAccess::runFrame(*world, delta, &input);
+
+		Box<Node> level = WorldTestAccess::findNode(UID(level_root));
+		if (not level.exists()) {
+			return;
+		}
+		if (frame % 12 == 0) {
+			WorldTestAccess::spawn(UID(crate_asset), *level);
+		} else if (frame % 12 == 3) {
+			// Gives the worker time to finish before the destroy below; the queue still decides the frame
+			WorldTestAccess::waitForLoads(*world);
+		}
+		if (destroy and frame % 24 == 6) {
+			Box<Node> crate;
+			for (const auto& child : WorldTestAccess::childrenOf(*level)) {
+				if (child->name() == "crate") {
+					crate = child;
+					break;
+				}
+			}
+			if (crate.exists()) {
+				World::cacheNode(*crate);
+				World::destroyNode(*crate);
+				++destroyed;
+			}
+		}
+	}
+};
+
+}
+
+// Records a run through the engine's own hooks (Time, InputSystem and the World's load, spawn and destroy
+// queues) and plays it back with no live input; the world must end up in the same state
+TOAST_TEST_NAMED("World", "world/07-replay", test_world_07_replay) {
+	namespace fs = std::filesystem;
+	const fs::path tmp = fs::temp_directory_path() / "toast_replay_test";
+	const fs::path assets_dir = tmp / "assets";
+	const fs::path cache_dir = tmp / "cache";
+	const fs::path path = tmp / "run.trpl";
+
+	std::error_code ec;
+	fs::remove_all(tmp, ec);
+	fs::create_directories(assets_dir);
+	fs::create_directories(cache_dir);
+	writeAssets(assets_dir, cache_dir);
+
+	WorldTestAccess::initAssetManager(assets_dir.string(), cache_dir.string());
+	WorldTestAccess::initThreadPool();
+
+	// Record
+	uint64_t recorded_hash = 0;
+	{
+		Replay recorder(Replay::Mode::record, path, replay_checkpoint_interval);
+		assert(recorder.valid() && recorder.recording());
+		assert(Replay::get() == &recorder);
+
+		std::mt19937 rng(1234);
+		ReplayRun run;
+		for (int frame = 0; frame < replay_frames; ++frame) {
+			run.frame(frame, &rng);
+		}
+
+		// The run has to exercise every queue for the playback to mean anything
+		Box<Node> level = WorldTestAccess::findNode(UID(level_root));
+		assert(level.exists());
+		assert(WorldTestAccess::childrenOf(*level).size() > replay_movers);
+		assert(run.pushes > 0);
+		assert(run.destroyed > 0);
+		recorded_hash = run.world->stateHash();
+	}
+	assert(Replay::get() == nullptr);
+
+	// Play back with no live input or frame times; every checkpoint and the final state match
+	{
+		Replay player(Replay::Mode::play, path);
+		assert(player.valid() && player.playing());
+		assert(player.checkpointInterval() == replay_checkpoint_interval);
+
+		ReplayRun run;
+		for (int frame = 0; frame < replay_frames; ++frame) {
+			run.frame(frame, nullptr);
+		}
+		assert(not player.diverged());
+		assert(run.world->stateHash() == recorded_hash);
+	}
+
+	// A playback that skips the recorded destroys strays from the recording and is caught
+	{
+		Replay player(Replay::Mode::play, path);
+		ReplayRun run;
+		for (int frame = 0; frame < replay_frames; ++frame) {
+			run.frame(frame, nullptr, false);
+		}
+		assert(player.diverged());
+		assert(run.world->stateHash() != recorded_hash);
+	}
+
+	fs::remove_all(tmp, ec);
+}
@@ -0,0 +1,93 @@
+#include "test_registry.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <glm/gtc/matrix_transform.hpp>
+#include <random>
+#include <toast/world/volume_index.hpp>
+#include <vector>
+
+using namespace toast;
+
+namespace {
+
+auto containing(const std::vector<physics::Aabb>& bounds, glm::vec3 point) -> std::vector<uint32_t> {
+	std::vector<uint32_t> hits;
+	for (uint32_t i = 0; i < bounds.size(); ++i) {
+		const physics::Aabb& box = bounds[i];
+		if (glm::all(glm::greaterThanEqual(point, box.min)) and glm::all(glm::lessThanEqual(point, box.max))) {
+			hits.push_back(i);
+		}
+	}
+	return hits;
+}
+
+}
+
+TOAST_TEST_NAMED("World", "world/08-volume-index", test_world_08_volume_index) {
+	std::mt19937 rng(77);
+	std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+	// Same hits as testing every box, across sizes that give one leaf, a few levels and a deep tree
+	for (const size_t count : {0uz, 3uz, 17uz, 600uz}) {
+		std::vector<physics::Aabb> bounds(count);
+		for (physics::Aabb& box : bounds) {
+			const glm::vec3 center = glm::vec3 {unit(rng), unit(rng), unit(rng)} * 100.0f;
+			const glm::vec3 half = glm::vec3 {unit(rng), unit(rng), unit(rng)} * 8.0f + 0.5f;
+			box = {center - half, center + half};
+		}
+
+		BoundsTree tree;
+		tree.build(bounds);
+		assert(tree.size() == count);
+
+		std::vector<uint32_t> hits;
+		for (int i = 0; i < 500; ++i) {
+			const glm::vec3 point = glm::vec3 {unit(rng), unit(rng), unit(rng)} * 110.0f - 5.0f;
+			hits.clear();
+			tree.query(point, hits);
+			std::ranges::sort(hits);
+			assert(hits == containing(bounds, point));
+		}
+	}
+
+	// Identical boxes can't be split apart by their centers and still all come back
+	{
+		std::vector<physics::Aabb> bounds(40, physics::Aabb {glm::vec3(-1.0f), glm::vec3(1.0f)});
+		BoundsTree tree;
+		tree.build(bounds);
+		std::vector<uint32_t> hits;
+		tree.query(glm::vec3(0.0f), hits);
+		assert(hits.size() == bounds.size());
+	}
+
+	// A rotated, scaled cube: every corner and the blend margin fit in its world bounds
+	{
+		glm::mat4 world = glm::translate(glm::mat4(1.0f), {10.0f, -4.0f, 2.0f});
+		world = glm::rotate(world, 0.7f, glm::normalize(glm::vec3 {1.0f, 2.0f, 0.5f}));
+		world = glm::scale(world, {4.0f, 1.0f, 2.5f});
+
+		const float blend = 1.5f;
+		const physics::Aabb box = VolumeIndex::worldBounds(world, blend);
+		for (int corner = 0; corner < 8; ++corner) {
+			const glm::vec3 local {corner & 1 ? 0.5f : -0.5f, corner & 2 ? 0.5f : -0.5f, corner & 4 ? 0.5f : -0.5f};
+			const glm::vec3 point = world * glm::vec4(local, 1.0f);
+			assert(glm::all(glm::greaterThanEqual(point - blend, box.min - 1e-4f)));
+			assert(glm::all(glm::lessThanEqual(point + blend, box.max + 1e-4f)));
+		}
+
+		// Tight: the box touches the rotated cube's extremes on every axis
+		const physics::Aabb plain = VolumeIndex::worldBounds(world, 0.0f);
+		glm::vec3 lo(INFINITY);
+		glm::vec3 hi(-INFINITY);
+		for (int corner = 0; corner < 8; ++corner) {
+			const glm::vec3 local {corner & 1 ? 0.5f : -0.5f, corner & 2 ? 0.5f : -0.5f, corner & 4 ? 0.5f : -0.5f};
+			const glm::vec3 point = world * glm::vec4(local, 1.0f);
+			lo = glm::min(lo, point);
+			hi = glm::max(hi, point);
+		}
+		assert(glm::all(glm::lessThan(glm::abs(plain.min - lo), glm::vec3(1e-4f))));
+		assert(glm::all(glm::lessThan(glm::abs(plain.max - hi), glm::vec3(1e-4f))));
+	}
+}
@@ -0,0 +1,205 @@
+#include "test_registry.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <toast/world/hierarchy_journal.hpp>
+#include <unordered_map>
+#include <vector>
+
+using namespace toast;
+
+namespace {
+
+// Stand-in for a node tree; the journal only ever sees it through a preorder walk
+struct JournalTree {
+	struct Node {
+		uint64_t parent = 0;
+		std::string name;
+		std::string type;
+		bool enabled = true;
+		bool is_prefab = false;
+		std::vector<uint64_t> children;
+	};
+
+	std::unordered_map<uint64_t, Node> nodes;
+	uint64_t root = 0;
+	uint64_t next_uid = 0x1000;
+
+	auto add(uint64_t parent, std::size_t index, std::string type) -> uint64_t {
+		const uint64_t uid = next_uid++;
+		nodes[uid] = {.parent = parent, .name = "node_" + std::to_string(uid), .type = std::move(type)};
+		if (parent == 0) {
+			root = uid;
+		} else {
+			auto& siblings = nodes[parent].children;
+			siblings.insert(siblings.begin() + static_cast<std::ptrdiff_t>(std::min(index, siblings.size())), uid);
+		}
+		return uid;
+	}
+
+	void remove(uint64_t uid) {
+		for (const uint64_t child : std::vector(nodes[uid].children)) {
+			remove(child);
+		}
+		std::erase(nodes[nodes[uid].parent].children, uid);
+		nodes.erase(uid);
+	}
+
+	void move(uint64_t uid, uint64_t parent, std::size_t index) {
+		std::erase(nodes[nodes[uid].parent].children, uid);
+		nodes[uid].parent = parent;
+		auto& siblings = nodes[parent].children;
+		siblings.insert(siblings.begin() + static_cast<std::ptrdiff_t>(std::min(index, siblings.size())), uid);
+	}
+
+	[[nodiscard]]
+	auto isInside(uint64_t uid, uint64_t ancestor) const -> bool {
+		for (; uid != 0; uid = nodes.at(uid).parent) {
+			if (uid == ancestor) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	void walk(HierarchyJournal& journal) const {
+		journal.begin();
+		if (root != 0) {
+			visit(journal, root, 0);
+		}
+	}
+
+	void visit(HierarchyJournal& journal, uint64_t uid, uint32_t index) const {
+		const Node& node = nodes.at(uid);
+		journal.visit(uid, node.parent, index, node.name, node.type, node.enabled, node.is_prefab);
+		for (uint32_t i = 0; i < node.children.size(); ++i) {
+			visit(journal, node.children[i], i);
+		}
+	}
+
+	auto randomNode(std::mt19937& rng) const -> uint64_t {
+		auto it = nodes.begin();
+		std::advance(it, std::uniform_int_distribution<std::size_t>(0, nodes.size() - 1)(rng));
+		return it->first;
+	}
+};
+
+// The editor's copy has to be the tree itself: same nodes, same fields, same sibling order
+void assertMirrors(const HierarchyMirror& mirror, const JournalTree& tree) {
+	assert(mirror.size() == tree.nodes.size());
+	assert(mirror.root().data() == tree.root);
+	for (const auto& [uid, node] : tree.nodes) {
+		const HierarchyMirror::Entry* entry = mirror.find(uid);
+		assert(entry != nullptr);
+		assert(entry->parent.data() == node.parent);
+		assert(entry->name == node.name and entry->type == node.type);
+		assert(entry->enabled == node.enabled and entry->is_prefab == node.is_prefab);
+		assert(entry->children == node.children);
+	}
+}
+
+}
+
+TOAST_TEST_NAMED("World", "world/09-hierarchy-journal", test_world_09_hierarchy_journal) {
+	JournalTree tree;
+	const uint64_t level = tree.add(0, 0, "toast::Node3D");
+	for (int i = 0; i < 20; ++i) {
+		tree.add(i < 5 ? level : tree.next_uid - 1 - (i % 5), 0, "toast::Node3D");
+	}
+
+	HierarchyJournal journal;
+	HierarchyMirror editor;
+
+	// The first pass is a snapshot: the editor builds it from the whole tree
+	assert(journal.needsSnapshot());
+	tree.walk(journal);
+	std::vector<HierarchyChange> changes = journal.end();
+	for (const auto& change : changes) {
+		editor.apply(change);
+	}
+	assert(not journal.needsSnapshot());
+	assert(journal.sequence() == 1);
+	assertMirrors(journal.mirror(), tree);
+	assertMirrors(editor, tree);
+
+	// Idle: nothing to send and the sequence stays put
+	tree.walk(journal);
+	assert(journal.end().empty());
+	assert(journal.sequence() == 1);
+
+	// One rename is one update, not a resend
+	const uint64_t renamed = tree.nodes.at(level).children.front();
+	tree.nodes.at(renamed).name = "renamed";
+	tree.walk(journal);
+	changes = journal.end();
+	assert(changes.size() == 1 and changes.front().kind == HierarchyChange::Kind::update);
+	editor.apply(changes.front());
+	assert(editor.checksum() == journal.mirror().checksum());
+
+	// Random edits, several per batch; replaying every batch keeps the editor identical to the tree
+	std::mt19937 rng(4711);
+	std::uniform_int_distribution<int> edit(0, 5);
+	std::uniform_int_distribution<std::size_t> position(0, 6);
+	uint64_t sequence = journal.sequence();
+	for (int batch = 0; batch < 300; ++batch) {
+		const int edits = batch % 7;
+		for (int e = 0; e < edits; ++e) {
+			const uint64_t target = tree.randomNode(rng);
+			switch (edit(rng)) {
+				case 0:
+				case 1: tree.add(target, position(rng), batch % 2 ? "toast::Node3D" : "toast::Node"); break;
+				case 2:
+					if (target != tree.root and tree.nodes.size() > 8) {
+						tree.remove(target);
+					}
+					break;
+				case 3: {
+					const uint64_t parent = tree.randomNode(rng);
+					if (target != tree.root and not tree.isInside(parent, target)) {
+						tree.move(target, parent, position(rng));
+					}
+					break;
+				}
+				case 4: tree.nodes.at(target).name += "_"; break;
+				case 5: tree.nodes.at(target).enabled = not tree.nodes.at(target).enabled; break;
+			}
+		}
+
+		tree.walk(journal);
+		changes = journal.end();
+		if (not changes.empty()) {
+			assert(journal.sequence() == ++sequence);
+		}
+		for (const auto& change : changes) {
+			editor.apply(change);
+		}
+		assertMirrors(journal.mirror(), tree);
+		assertMirrors(editor, tree);
+		assert(editor.checksum() == journal.mirror().checksum());
+	}
+
+	// A batch that never arrived shows up in the checksum, which is the editor's cue to ask for a snapshot
+	tree.add(tree.root, 0, "toast::Node3D");
+	tree.walk(journal);
+	assert(not journal.end().empty());
+	tree.nodes.at(tree.root).name = "level_renamed";
+	tree.walk(journal);
+	for (const auto& change : journal.end()) {
+		editor.apply(change);
+	}
+	assert(editor.checksum() != journal.mirror().checksum());
+
+	// Resync: the next pass is a snapshot again and a fresh mirror built from it matches
+	journal.reset();
+	assert(journal.needsSnapshot());
+	tree.walk(journal);
+	HierarchyMirror resynced;
+	for (const auto& change : journal.end()) {
+		resynced.apply(change);
+	}
+	assertMirrors(resynced, tree);
+	assert(resynced.checksum() == journal.mirror().checksum());
+}
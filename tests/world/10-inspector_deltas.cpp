@@ -0,0 +1,108 @@
+#include "test_registry.hpp"
+#include "toast/world/world_test_access.hpp"
+
+#include <cassert>
+#include <cstdint>
+#include <string>
+#include <toast/events/listener.hpp>
+#include <toast/world/node_3d.hpp>
+#include <toast/world/workspace.hpp>
+#include <toast/world/workspace_events.hpp>
+#include <variant>
+#include <vector>
+
+using namespace toast;
+using WorldTestAccess = toast::_detail::WorldTestAccess;
+
+namespace {
+
+// What the editor would have received since the last check
+struct InspectorInbox {
+	event::Listener listener;
+	int contents = 0;
+	int deltas = 0;
+	size_t content_fields = 0;
+	std::vector<event::InspectorDelta::FieldDelta> delta_fields;
+
+	InspectorInbox() {
+		listener.subscribe<event::InspectorContent>([this](const event::InspectorContent& e) {
+			++contents;
+			content_fields = e.parameters.size();
+			return false;
+		});
+		listener.subscribe<event::InspectorDelta>([this](const event::InspectorDelta& e) {
+			++deltas;
+			delta_fields = e.fields;
+			return false;
+		});
+	}
+
+	void clear() {
+		contents = 0;
+		deltas = 0;
+		content_fields = 0;
+		delta_fields.clear();
+	}
+};
+
+// Index of a reflected field in the order the inspector lists them, most derived type first
+auto inspectorIndex(const Node& node, std::string_view name) -> uint32_t {
+	uint32_t index = 0;
+	for (const NodeInfo* type = node.info(); type != nullptr; type = type->base_type) {
+		for (const auto& field : type->all_fields) {
+			if (field.name == name) {
+				return index;
+			}
+			++index;
+		}
+	}
+	assert(false && "field not reflected");
+	return index;
+}
+
+}
+
+// The inspector stream only sends what changed: a full InspectorContent when a node gets focused or the
+// editor asks again, nothing while the node sits still, and an InspectorDelta naming each moved field
+TOAST_TEST_NAMED("World", "world/10-inspector_deltas", test_world_10_inspector_deltas) {
+	Workspace workspace("toast::Node3D", UID(0x1D5));
+	assert(workspace.isValid());
+	auto& root = const_cast<Node3D&>(dynamic_cast<const Node3D&>(workspace.rootNode()));
+
+	InspectorInbox inbox;
+	auto stream = [&] {
+		inbox.clear();
+		WorldTestAccess::streamInspector(workspace);
+		event::pollEvents();
+	};
+
+	// Focusing sends everything once
+	WorldTestAccess::focusInspector(workspace, root.uid());
+	stream();
+	assert(inbox.contents == 1 && inbox.deltas == 0);
+	assert(inbox.content_fields > 0);
+
+	// An idle node sends nothing
+	stream();
+	assert(inbox.contents == 0 && inbox.deltas == 0);
+
+	// One member moves, one typed field goes out
+	root.position = glm::vec3 {1.0f, 2.0f, 3.0f};
+	stream();
+	assert(inbox.contents == 0 && inbox.deltas == 1);
+	assert(inbox.delta_fields.size() == 1);
+	assert(inbox.delta_fields[0].index == inspectorIndex(root, "position"));
+	const auto* position = std::get_if<std::vector<float>>(&inbox.delta_fields[0].value);
+	assert(position != nullptr);
+	assert((*position == std::vector<float> {1.0f, 2.0f, 3.0f}));
+
+	stream();
+	assert(inbox.contents == 0 && inbox.deltas == 0);
+
+	// The editor lost its copy; it gets the whole field set again, then only deltas
+	WorldTestAccess::requestInspectorContent(workspace);
+	stream();
+	assert(inbox.contents == 1 && inbox.deltas == 0);
+	stream();
+	assert(inbox.contents == 0 && inbox.deltas == 0);
+}
@@ -0,0 +1,27 @@
+#include "test_registry.hpp"
+#include "toast/world/world_test_access.hpp"
+
+#include <cassert>
+#include <cstdint>
+#include <toast/memory_tracker.hpp>
+#include <vector>
+
+using namespace toast;
+using WorldTestAccess = toast::_detail::WorldTestAccess;
+
+// The node pools outlive every World, so the leak report at shutdown must only count nodes still
+// alive, not the slabs a pool keeps around for the next one
+TOAST_TEST_NAMED("World", "world/11-leak_report", test_world_11_leak_report) {
+	const uint64_t before = MemoryTracker::counters(MemoryTag::nodes).live_blocks;
+	{
+		auto world = WorldTestAccess::createWorld();
+		std::vector<Box<Node>> nodes;
+		for (int i = 0; i < 200; ++i) {
+			nodes.push_back(WorldTestAccess::allocateNode(*world, i % 2 ? "toast::Node3D" : "toast::Node"));
+		}
+		assert(MemoryTracker::counters(MemoryTag::nodes).live_blocks == before + 200);
+	}
+
+	assert(MemoryTracker::counters(MemoryTag::nodes).current == 0);
+	assert(MemoryTracker::reportLeaks() == 0);
+}
@@ -1,4 +1,5 @@
 use crate::proto::{LogBatch, LogData};
+use crate::tlog;
 use crate::tui::Tui;
 use anyhow::Result;
 use crossterm::event::{self, Event, KeyCode, KeyEvent, KeyEventKind, KeyModifiers};
@@ -105,7 +106,7 @@ pub struct App {
 }
 
 impl App {
-    pub fn new(csv_path: Option<String>) -> Self {
+    pub fn new(file_path: Option<String>) -> Self {
         let mut app = Self {
             logs: Vec::new(),
             filtered_logs: Vec::new(),
@@ -137,8 +138,8 @@ impl App {
             should_exit: false,
         };
 
-        if let Some(path) = csv_path {
-            app.load_csv(&path);
+        if let Some(path) = file_path {
+            app.load_file(&path);
         }
 
         app
@@ -296,7 +297,7 @@ impl App {
                 PopupOption::CsvFile => {
                     let path = self.input_buffer.value().to_string();
                     if !path.is_empty() {
-                        self.load_csv(&path);
+                        self.load_file(&path);
                     }
                 }
             },
@@ -596,6 +597,29 @@ impl App {
         self.state = ConnectionState::Disconnected;
     }
 
+    /// Opens either a .tlog file or a CSV, going by the file's first bytes rather than its extension
+    fn load_file(&mut self, path: &str) {
+        match std::fs::read(path) {
+            Ok(bytes) if tlog::is_tlog(&bytes) => self.load_tlog(path, &bytes),
+            Ok(_) => self.load_csv(path),
+            Err(_) => self.state = ConnectionState::Disconnected,
+        }
+    }
+
+    fn load_tlog(&mut self, path: &str, bytes: &[u8]) {
+        match tlog::parse(bytes) {
+            Ok(logs) => {
+                self.logs.clear();
+                for log in logs {
+                    self.process_log(log);
+                }
+                self.state = ConnectionState::CsvMode(path.to_string());
+                self.update_filtered_logs();
+            }
+            Err(_) => self.state = ConnectionState::Disconnected,
+        }
+    }
+
     fn load_csv(&mut self, path: &str) {
         match csv::Reader::from_path(path) {
             Ok(mut rdr) => {
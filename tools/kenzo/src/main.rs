@@ -4,6 +4,7 @@ use clap::Parser;
 pub mod proto;
 
 mod app;
+mod tlog;
 mod tui;
 mod ui;
 
@@ -14,6 +15,10 @@ struct Args {
     /// Path to a CSV log file to open directly
     #[arg(long)]
     csv: Option<String>,
+
+    /// Path to a binary .tlog file the engine wrote without a log server
+    #[arg(long)]
+    tlog: Option<String>,
 }
 
 #[tokio::main]
@@ -31,7 +36,7 @@ async fn main() -> Result<()> {
     let mut terminal = tui::init()?;
 
     // Create App
-    let mut app = App::new(args.csv);
+    let mut app = App::new(args.csv.or(args.tlog));
 
     // Run Main Loop
     let res = app.run(&mut terminal).await;
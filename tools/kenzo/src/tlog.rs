@@ -0,0 +1,51 @@
+// Reader for the engine's binary log files (.tlog), written when no log server is running.
+// The layout is documented in engine/src/toast/log_file.hpp
+use crate::proto::LogData;
+use anyhow::{bail, Result};
+
+pub const MAGIC: &[u8; 4] = b"TLOG";
+const FILE_HEADER_SIZE: usize = 8;
+const RECORD_HEADER_SIZE: usize = 24;
+
+/// True when the bytes start like a .tlog file
+pub fn is_tlog(bytes: &[u8]) -> bool {
+    bytes.len() >= FILE_HEADER_SIZE && &bytes[..4] == MAGIC
+}
+
+/// Parses every complete record; a record cut short by a crash ends the file instead of failing it
+pub fn parse(bytes: &[u8]) -> Result<Vec<LogData>> {
+    if !is_tlog(bytes) {
+        bail!("not a .tlog file");
+    }
+    let version = u16::from_le_bytes([bytes[4], bytes[5]]);
+    if version != 1 {
+        bail!("unsupported .tlog version {version}");
+    }
+
+    let mut logs = Vec::new();
+    let mut offset = FILE_HEADER_SIZE;
+    while bytes.len() - offset >= RECORD_HEADER_SIZE {
+        let header = &bytes[offset..offset + RECORD_HEADER_SIZE];
+        let size = 4 + u32::from_le_bytes(header[0..4].try_into()?) as usize;
+        let sink_size = header[17] as usize;
+        let file_size = u16::from_le_bytes(header[18..20].try_into()?) as usize;
+        let message_size = u32::from_le_bytes(header[20..24].try_into()?) as usize;
+        if bytes.len() - offset < size || size < RECORD_HEADER_SIZE + sink_size + file_size + message_size {
+            break;
+        }
+
+        let text = &bytes[offset + RECORD_HEADER_SIZE..];
+        logs.push(LogData {
+            timestamp: i64::from_le_bytes(header[4..12].try_into()?) as u64,
+            severity: header[16] as i32,
+            filepath: String::from_utf8_lossy(&text[sink_size..sink_size + file_size]).into_owned(),
+            line_number: u32::from_le_bytes(header[12..16].try_into()?),
+            sink: String::from_utf8_lossy(&text[..sink_size]).into_owned(),
+            message: String::from_utf8_lossy(&text[sink_size + file_size..sink_size + file_size + message_size])
+                .into_owned(),
+        });
+        offset += size;
+    }
+    Ok(logs)
+}
+
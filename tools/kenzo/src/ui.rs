@@ -124,7 +124,7 @@ fn render_disconnected(f: &mut Frame, app: &mut App, area: Rect) {
     } else {
         ""
     };
-    let csv_text = format!("  Open CSV: {}", csv_input);
+    let csv_text = format!("  Open CSV or .tlog: {}", csv_input);
     f.render_widget(Paragraph::new(csv_text).style(csv_style), chunks[5]);
 }
 
@@ -7,7 +7,37 @@ internal class Program {
 	// Caps the tick loop rate to 500
 	private const double TargetTickHz = 500.0;
 
-	public static void Main() {
+	// Headless CI and soak runs: --headless [--frames N] [--scene <uid|uri>] [--report <file.csv>]
+	// Replays: --record <file.trpl> or --replay <file.trpl>, with or without --headless
+	// --fail-over-budget exits with 1 if any frame went over a [profiler] budget
+	private record Options(bool Headless, int Frames, string? Scene, string Report, string? Record, string? Replay, bool FailOverBudget);
+
+	private static Options ParseArgs(string[] args) {
+		var headless = false;
+		var frames = 1000;
+		string? scene = null;
+		var report = "frame_report.csv";
+		string? record = null;
+		string? replay = null;
+		var failOverBudget = false;
+
+		for (var i = 0; i < args.Length; i++) {
+			switch (args[i]) {
+				case "--headless": headless = true; break;
+				case "--frames" when i + 1 < args.Length: frames = int.Parse(args[++i]); break;
+				case "--scene" when i + 1 < args.Length: scene = args[++i]; break;
+				case "--report" when i + 1 < args.Length: report = args[++i]; break;
+				case "--record" when i + 1 < args.Length: record = args[++i]; break;
+				case "--replay" when i + 1 < args.Length: replay = args[++i]; break;
+				case "--fail-over-budget": failOverBudget = true; break;
+			}
+		}
+
+		return new Options(headless, frames, scene, report, record, replay, failOverBudget);
+	}
+
+	public static int Main(string[] args) {
+		var options = ParseArgs(args);
 		var engine = new ToastEngine();
 		var game = new ApplicationLayer();
 
@@ -29,9 +59,37 @@ internal class Program {
 			engine.MountPack(scheme, pakFile);
 		}
 
+		if (options.Headless) {
+			engine.SetHeadless(true);
+			engine.Init();
+			StartReplay(engine, options);
+			engine.StartGame(options.Scene);
+
+			// Uncapped: the report is about how long frames take, not how often they're shown
+			for (var frame = 0; frame < options.Frames; frame++) {
+				engine.Tick();
+			}
+
+			engine.StopReplay();
+			var written = engine.WriteFrameReport(options.Report);
+			var overBudget = engine.ProfilerOverBudgetFrames();
+			if (overBudget > 0) {
+				Console.Error.WriteLine($"{overBudget} frame(s) went over budget");
+				foreach (var zone in engine.ProfilerStats().Where(z => z.OverBudget > 0))
+					Console.Error.WriteLine($"  {zone.Name}: max {zone.MaxMs:F3} ms, budget {zone.BudgetMs:F3} ms, over in {zone.OverBudget} frame(s)");
+			}
+
+			game.Dispose();
+			engine.Dispose();
+			if (!written)
+				return 1;
+			return options.FailOverBudget && overBudget > 0 ? 1 : 0;
+		}
+
 		engine.Init();
 		engine.CreateSdlWindow("Toast Engine");
-		engine.StartGame();
+		StartReplay(engine, options);
+		engine.StartGame(options.Scene);
 
 		var targetInterval = TimeSpan.FromSeconds(1.0 / TargetTickHz);
 		var stopwatch = Stopwatch.StartNew();
@@ -52,7 +110,16 @@ internal class Program {
 			}
 		}
 
+		engine.StopReplay();
 		game.Dispose();
 		engine.Dispose();
+		return 0;
+	}
+
+	private static void StartReplay(ToastEngine engine, Options options) {
+		if (options.Record is not null && !engine.RecordReplay(options.Record))
+			Console.Error.WriteLine($"Cannot record to {options.Record}");
+		if (options.Replay is not null && !engine.PlayReplay(options.Replay))
+			Console.Error.WriteLine($"Cannot play {options.Replay}");
 	}
 }
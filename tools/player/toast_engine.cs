@@ -52,8 +52,66 @@ public class ToastEngine : IDisposable {
 		toast_mount_pack(scheme, pakPath);
 	}
 
-	public void StartGame() {
-		toast_start_game();
+	public void StartGame(string? scene = null) {
+		if (scene is null)
+			toast_start_game();
+		else
+			toast_start_scene(scene);
+	}
+
+	public void SetHeadless(bool headless) {
+		toast_set_headless(headless ? 1 : 0);
+	}
+
+	public bool RecordReplay(string path) {
+		return toast_replay_record(path) != 0;
+	}
+
+	public bool PlayReplay(string path) {
+		return toast_replay_play(path) != 0;
+	}
+
+	public void StopReplay() {
+		toast_replay_stop();
+	}
+
+	public bool WriteFrameReport(string path) {
+		return toast_write_frame_report(path) != 0;
+	}
+
+	// Mirrors toast_profiler_zone_t
+	[StructLayout(LayoutKind.Sequential)]
+	private struct NativeProfilerZone {
+		public IntPtr Name;
+		public double LastMs;
+		public double P50Ms;
+		public double P99Ms;
+		public double MaxMs;
+		public double BudgetMs;
+		public ulong OverBudget;
+	}
+
+	public record ProfilerZone(string Name, double LastMs, double P50Ms, double P99Ms, double MaxMs, double BudgetMs, ulong OverBudget);
+
+	public IReadOnlyList<ProfilerZone> ProfilerStats() {
+		var count = toast_profiler_stats(null, 0);
+		var native = new NativeProfilerZone[count];
+		count = Math.Min(count, toast_profiler_stats(native, native.Length));
+
+		var zones = new List<ProfilerZone>(count);
+		for (var i = 0; i < count; i++) {
+			var z = native[i];
+			zones.Add(new ProfilerZone(Marshal.PtrToStringUTF8(z.Name) ?? "", z.LastMs, z.P50Ms, z.P99Ms, z.MaxMs, z.BudgetMs, z.OverBudget));
+		}
+		return zones;
+	}
+
+	public void SetProfilerBudget(string zone, double ms) {
+		toast_profiler_set_budget(zone, ms);
+	}
+
+	public ulong ProfilerOverBudgetFrames() {
+		return toast_profiler_over_budget_frames();
 	}
 
 	~ToastEngine() {
@@ -91,4 +149,31 @@ public class ToastEngine : IDisposable {
 
 	[DllImport("__ENGINE_LIB__", CallingConvention = CallingConvention.Cdecl)]
 	private static extern void toast_start_game();
+
+	[DllImport("__ENGINE_LIB__", CallingConvention = CallingConvention.Cdecl)]
+	private static extern void toast_start_scene(string scene);
+
+	[DllImport("__ENGINE_LIB__", CallingConvention = CallingConvention.Cdecl)]
+	private static extern void toast_set_headless(int headless);
+
+	[DllImport("__ENGINE_LIB__", CallingConvention = CallingConvention.Cdecl)]
+	private static extern int toast_write_frame_report(string path);
+
+	[DllImport("__ENGINE_LIB__", CallingConvention = CallingConvention.Cdecl)]
+	private static extern int toast_replay_record(string path);
+
+	[DllImport("__ENGINE_LIB__", CallingConvention = CallingConvention.Cdecl)]
+	private static extern int toast_replay_play(string path);
+
+	[DllImport("__ENGINE_LIB__", CallingConvention = CallingConvention.Cdecl)]
+	private static extern void toast_replay_stop();
+
+	[DllImport("__ENGINE_LIB__", CallingConvention = CallingConvention.Cdecl)]
+	private static extern int toast_profiler_stats([Out] NativeProfilerZone[]? zones, int capacity);
+
+	[DllImport("__ENGINE_LIB__", CallingConvention = CallingConvention.Cdecl)]
+	private static extern void toast_profiler_set_budget(string zone, double ms);
+
+	[DllImport("__ENGINE_LIB__", CallingConvention = CallingConvention.Cdecl)]
+	private static extern ulong toast_profiler_over_budget_frames();
 }
@@ -31,8 +31,11 @@ pub fn generate_files(nodes: &[NodeInfo], output: &Path, register_fn: &str, spli
         None
     };
 
-    for node in nodes {
-        let mut ctx = build_template_context(node);
+    // Contexts are built up front so each type can fold its ancestors into its lookup tables
+    let mut node_ctxs: Vec<json_t> = nodes.iter().map(build_template_context).collect();
+    attach_lookup_tables(&mut node_ctxs);
+
+    for (node, mut ctx) in nodes.iter().zip(node_ctxs) {
         if split_typeinfo && let json_t::Object(map) = &mut ctx {
             map.insert("split_typeinfo".to_string(), json_t::Bool(true));
         }
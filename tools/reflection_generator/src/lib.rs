@@ -1,11 +1,13 @@
 //! Re-exports for the integration test crate
 
 mod generator;
+mod lookup;
 mod lua_stubs;
 mod node;
 mod parser;
 
 pub use generator::*;
+pub use lookup::*;
 pub use lua_stubs::*;
 pub use node::*;
 pub use parser::*;
@@ -0,0 +1,149 @@
+//! Builds the flattened, inheritance-resolved name lookup tables emitted next to each NodeInfo
+//!
+//! Every type gets one perfect-hash table for fields and one for methods. The tables fold in
+//! every ancestor that is part of the same generator run, so a runtime lookup is one hash, one
+//! slot load and one string compare. Ancestors outside the run (e.g. a game node deriving from an
+//! engine node) are reached through `lookup_base`, which the runtime walks after a miss.
+//!
+//! The hash must stay in sync with `toast::NameLookup::hash` in reflect_node.hpp
+
+use crate::*;
+
+use std::collections::{HashMap, HashSet};
+
+/// Seeds tried per table size before the table is doubled
+const SEED_ATTEMPTS: u32 = 1024;
+
+pub fn lookup_hash(name: &str, seed: u32) -> u32 {
+    let mut h: u32 = 2166136261 ^ seed;
+    for b in name.bytes() {
+        h ^= b as u32;
+        h = h.wrapping_mul(16777619);
+    }
+    // FNV has weak low bits and we mask with the table size, so finish with a small avalanche
+    h ^= h >> 16;
+    h = h.wrapping_mul(0x7feb352d);
+    h ^= h >> 15;
+    h
+}
+
+/// Finds a seed and a power-of-two size that place every name in its own slot
+/// Returns (seed, slots) where slots[i] is the index into `names` or None for an empty slot
+pub fn build_perfect_hash(names: &[&str]) -> (u32, Vec<Option<usize>>) {
+    if names.is_empty() {
+        return (0, vec![]);
+    }
+
+    let mut size = (names.len() * 2).next_power_of_two();
+    loop {
+        for seed in 0..SEED_ATTEMPTS {
+            let mut slots: Vec<Option<usize>> = vec![None; size];
+            let placed = names.iter().enumerate().all(|(i, name)| {
+                let slot = (lookup_hash(name, seed) as usize) & (size - 1);
+                if slots[slot].is_some() {
+                    return false;
+                }
+                slots[slot] = Some(i);
+                true
+            });
+            if placed {
+                return (seed, slots);
+            }
+        }
+        size *= 2;
+    }
+}
+
+struct Entry {
+    name: String,
+    /// C++ expression yielding a pointer to the FieldInfo / FunctionInfo
+    expr: String,
+}
+
+fn lookup_ctx(entries: &[Entry]) -> json_t {
+    let names: Vec<&str> = entries.iter().map(|e| e.name.as_str()).collect();
+    let (seed, slots) = build_perfect_hash(&names);
+    json!({
+        "seed":  seed,
+        "slots": slots
+            .into_iter()
+            .map(|s| s.map_or("nullptr".to_string(), |i| entries[i].expr.clone()))
+            .collect::<Vec<String>>(),
+    })
+}
+
+// Unqualified parents resolve to the child's namespace first, same as C++ name lookup
+fn resolve_parent(ctx: &json_t, known: &HashMap<String, usize>) -> Result<usize, String> {
+    let parent = ctx["parent_qualified_name"].as_str().unwrap_or_default().to_string();
+    if let Some(ns) = ctx["namespace"].as_str()
+        && !parent.contains("::")
+        && let Some(&i) = known.get(&format!("{ns}::{parent}"))
+    {
+        return Ok(i);
+    }
+    known.get(&parent).copied().ok_or(parent)
+}
+
+/// Adds `field_lookup`, `method_lookup` and `lookup_base` to every template context
+///
+/// Derived entries shadow base entries with the same name, matching the old
+/// "scan this type, then walk base_type" behaviour of NodeInfo::getField/getMethod
+pub fn attach_lookup_tables(ctxs: &mut [json_t]) {
+    let known: HashMap<String, usize> = ctxs
+        .iter()
+        .enumerate()
+        .map(|(i, c)| (c["qualified_name"].as_str().unwrap_or_default().to_string(), i))
+        .collect();
+
+    let mut tables = Vec::with_capacity(ctxs.len());
+    for ctx in ctxs.iter() {
+        let mut fields: Vec<Entry> = Vec::new();
+        let mut methods: Vec<Entry> = Vec::new();
+        let mut seen_fields: HashSet<String> = HashSet::new();
+        let mut seen_methods: HashSet<String> = HashSet::new();
+        let mut lookup_base: Option<String> = None;
+        let mut visited: HashSet<usize> = HashSet::new();
+
+        let mut current = ctx;
+        loop {
+            let owner = current["qualified_name"].as_str().unwrap_or_default();
+            for f in current["all_fields_flat"].as_array().into_iter().flatten() {
+                let name = f["name"].as_str().unwrap_or_default().to_string();
+                if seen_fields.insert(name.clone()) {
+                    let idx = f["index"].as_u64().unwrap_or_default();
+                    let expr = format!("&Reflect<{owner}>::_all_field_info[{idx}]");
+                    fields.push(Entry { name, expr });
+                }
+            }
+            for (idx, m) in current["methods"].as_array().into_iter().flatten().enumerate() {
+                let name = m["name"].as_str().unwrap_or_default().to_string();
+                if seen_methods.insert(name.clone()) {
+                    let expr = format!("&Reflect<{owner}>::_method_info[{idx}]");
+                    methods.push(Entry { name, expr });
+                }
+            }
+
+            if current["parent_qualified_name"].is_null() {
+                break;
+            }
+            match resolve_parent(current, &known) {
+                Ok(i) if visited.insert(i) => current = &ctxs[i],
+                Ok(_) => break, // inheritance cycle, validation reports it elsewhere
+                Err(external) => {
+                    lookup_base = Some(external);
+                    break;
+                }
+            }
+        }
+
+        tables.push((lookup_ctx(&fields), lookup_ctx(&methods), lookup_base));
+    }
+
+    for (ctx, (field_lookup, method_lookup, lookup_base)) in ctxs.iter_mut().zip(tables) {
+        if let json_t::Object(map) = ctx {
+            map.insert("field_lookup".to_string(), field_lookup);
+            map.insert("method_lookup".to_string(), method_lookup);
+            map.insert("lookup_base".to_string(), json!(lookup_base));
+        }
+    }
+}
@@ -50,6 +50,30 @@ const RESERVED_FIELD_NAMES: &[&str] = &[
     "m_source_prefab",
 ];
 
+/// Attributes compiled into toast::FieldFlags bits; everything else only lives in the JSON
+const FIELD_FLAG_ATTRIBUTES: &[(&str, &str)] = &[
+    ("ReadOnly", "read_only"),
+    ("NoSerialize", "no_serialize"),
+    ("Hidden", "hidden"),
+    ("InspectorNoModify", "inspector_no_modify"),
+    ("Color", "color"),
+    ("Enum", "enumeration"),
+];
+
+/// C++ initializer for FieldInfo::flags, e.g. `FieldFlags::read_only | FieldFlags::hidden`
+pub fn field_flags_expr(attributes: &[Attribute]) -> String {
+    let bits: Vec<String> = FIELD_FLAG_ATTRIBUTES
+        .iter()
+        .filter(|(attr, _)| attributes.iter().any(|a| a.name == *attr))
+        .map(|(_, flag)| format!("FieldFlags::{flag}"))
+        .collect();
+    if bits.is_empty() {
+        "FieldFlags::none".to_string()
+    } else {
+        bits.join(" | ")
+    }
+}
+
 // TODO: smth with these
 fn to_snake(s: &str) -> std::string::String {
     s.to_lowercase().replace(' ', "_")
@@ -117,6 +141,7 @@ pub fn build_template_context(node: &NodeInfo) -> json_t {
             "is_enum":         f.attributes.iter().any(|a| a.name == "Enum") && !f.is_array,
             "attributes":      f.attrib_json,
             "attrs_list":      attrs_list,
+            "flags":           field_flags_expr(&f.attributes),
             "default":         f.default,
         }));
         idx
@@ -1,7 +1,10 @@
 mod common;
 
 use minijinja::Environment;
-use reflection_generator::{build_node, build_template_context, generate_files, generate_json, parse, strip_export_macros};
+use reflection_generator::{
+    attach_lookup_tables, build_node, build_perfect_hash, build_template_context, generate_files, generate_json, lookup_hash,
+    parse, strip_export_macros,
+};
 use serde_json::Value as JsonValue;
 use std::fs;
 use std::path::Path;
@@ -462,3 +465,89 @@ fn test_inspector_attributes_generate_runtime_metadata_and_enum_access() {
     assert!(generated.contains("EnumFieldAccess<toast::InspectorNode, InspectorMode"));
     assert!(generated.contains("{\"Button\", {\"Run Now\"}}"));
 }
+
+#[test]
+fn test_lookup_tables_fold_generated_bases() {
+    let source = r#"
+        namespace toast {
+        class [[ToastNode]] LookupBase {
+        public:
+            [[Reflect]] int shared = 0;
+            [[Reflect]] int base_only = 0;
+            [[Reflect]] void ping();
+        };
+
+        class [[ToastNode]] LookupDerived : public LookupBase {
+        public:
+            [[Reflect]] float shared = 0.0f;
+            [[Reflect]] float derived_only = 0.0f;
+        };
+        }
+    "#;
+
+    let classes = parse(source, "lookup_node.hpp");
+    let mut contexts: Vec<_> = classes.iter().map(|c| build_template_context(&build_node(c))).collect();
+    attach_lookup_tables(&mut contexts);
+
+    let derived = &contexts[1];
+    let slots: Vec<&str> = derived["field_lookup"]["slots"]
+        .as_array()
+        .unwrap()
+        .iter()
+        .map(|s| s.as_str().unwrap())
+        .collect();
+    assert!(slots.len().is_power_of_two());
+    assert!(slots.contains(&"&Reflect<toast::LookupDerived>::_all_field_info[0]"));
+    assert!(slots.contains(&"&Reflect<toast::LookupBase>::_all_field_info[1]"));
+    // the derived `shared` shadows the base one
+    assert!(!slots.contains(&"&Reflect<toast::LookupBase>::_all_field_info[0]"));
+    assert_eq!(slots.iter().filter(|s| **s != "nullptr").count(), 3);
+    assert!(derived["lookup_base"].is_null());
+
+    let methods = derived["method_lookup"]["slots"].as_array().unwrap();
+    assert!(methods.iter().any(|s| s == "&Reflect<toast::LookupBase>::_method_info[0]"));
+}
+
+#[test]
+fn test_perfect_hash_has_no_collisions() {
+    let names: Vec<String> = (0..64).map(|i| format!("field_{i}")).collect();
+    let refs: Vec<&str> = names.iter().map(String::as_str).collect();
+    let (seed, slots) = build_perfect_hash(&refs);
+
+    assert!(slots.len().is_power_of_two());
+    for (i, name) in refs.iter().enumerate() {
+        let slot = (lookup_hash(name, seed) as usize) & (slots.len() - 1);
+        assert_eq!(slots[slot], Some(i));
+    }
+}
+
+#[test]
+fn test_known_attributes_compile_to_field_flags() {
+    let source = r#"
+        namespace toast {
+        class [[ToastNode]] FlagNode {
+        public:
+            [[Reflect, ReadOnly, NoSerialize]] int transient = 0;
+            [[Reflect, Unit("m")]] float plain = 0.0f;
+        };
+        }
+    "#;
+
+    let classes = parse(source, "flag_node.hpp");
+    let context = build_template_context(&build_node(&classes[0]));
+    assert_eq!(context["all_fields_flat"][0]["flags"], "FieldFlags::read_only | FieldFlags::no_serialize");
+    assert_eq!(context["all_fields_flat"][1]["flags"], "FieldFlags::none");
+
+    let mut environment = Environment::new();
+    environment
+        .add_template("node", include_str!("../templates/node.generated.hpp.jinja2"))
+        .expect("template should parse");
+    let generated = environment
+        .get_template("node")
+        .expect("template should exist")
+        .render(context)
+        .expect("template should render");
+
+    assert!(generated.contains(".type_id    = &typeid(int)"));
+    assert!(generated.contains("memberAddress<toast::FlagNode, _detail::flagnode_transient_tag>"));
+}